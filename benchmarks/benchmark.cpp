@@ -25,22 +25,55 @@
 // ===============================================================================
 
 #include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <new>
 #include <numeric>
+#include <random>
+#include <string>
 #include <vector>
 
 #include <benchmark/benchmark.h>
+#include <novatel_edie/decoders/common/binary_db.hpp>
 #include <novatel_edie/decoders/common/framer_manager.hpp>
 #include <novatel_edie/decoders/common/json_db_reader.hpp>
+#include <novatel_edie/decoders/common/json_message_parser.hpp>
+#include <novatel_edie/decoders/oem/columnar_batch_decoder.hpp>
+#include <novatel_edie/decoders/oem/crc.hpp>
 #include <novatel_edie/decoders/oem/encoder.hpp>
 #include <novatel_edie/decoders/oem/file_parser.hpp>
 #include <novatel_edie/decoders/oem/framer_binary.hpp>
 #include <novatel_edie/decoders/oem/header_decoder.hpp>
 #include <novatel_edie/decoders/oem/message_decoder.hpp>
+#include <novatel_edie/decoders/oem/parallel_framer.hpp>
 #include <novatel_edie/decoders/oem/rangecmp/range_decompressor.hpp>
 
 using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
+// Count every heap allocation, so benchmarks can report allocations per iteration
+static std::atomic<uint64_t> ullAllocationCount{0};
+
+void* operator new(size_t size)
+{
+    ullAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+    throw std::bad_alloc();
+}
+
+// GCC pairs the inlined free() with the replaced operator new above and flags it as mismatched
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
 // clang-format off
 constexpr unsigned char bestposBinary[] = {0xAA, 0x44, 0x12, 0x1C, 0x2A, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x00, 0xA3, 0xB4, 0x73, 0x08, 0x98, 0x74, 0xA8, 0x13, 0x00, 0x00, 0x00, 0x02, 0xF6, 0xB1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xFC, 0xAB, 0xE1, 0x82, 0x41, 0x93, 0x49, 0x40, 0xBA, 0x32, 0x86, 0x8A, 0xF6, 0x81, 0x5C, 0xC0, 0x00, 0x10, 0xE5, 0xDF, 0x71, 0x23, 0x91, 0x40, 0x00, 0x00, 0x88, 0xC1, 0x3D, 0x00, 0x00, 0x00, 0x24, 0x21, 0xA5, 0x3F, 0xF1, 0x8F, 0x8F, 0x3F, 0x43, 0x74, 0x3C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x00, 0x00, 0x02, 0x11, 0x01, 0x55, 0xCE, 0xC3, 0x89};
 constexpr unsigned char bestposAscii[] = "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
@@ -59,6 +92,14 @@ static void LoadJson(benchmark::State& state)
     for ([[maybe_unused]] auto _ : state) { (void)LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH")); }
 }
 
+static void LoadBinary(benchmark::State& state)
+{
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "edie_load_binary_benchmark.bin";
+    WriteBinaryDbFile(*LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH")), filePath);
+    for ([[maybe_unused]] auto _ : state) { (void)LoadBinaryDbFile(filePath); }
+    std::filesystem::remove(filePath);
+}
+
 static void Parse(benchmark::State& state)
 {
     MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH"));
@@ -116,6 +157,94 @@ template <typename FramerType, size_t N> static void Frame(benchmark::State& sta
     state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
 }
 
+template <typename FramerType, size_t N> static void FrameWithGarbage(benchmark::State& state, const unsigned char (&data)[N])
+{
+    // Prefix the message with random bytes that never form a sync byte, as seen when framing a noisy or misconfigured port
+    constexpr std::array<unsigned char, 6> syncBytes = {OEM4_BINARY_SYNC1, OEM4_ASCII_SYNC, OEM4_SHORT_ASCII_SYNC, OEM4_ABBREV_ASCII_SYNC, NMEA_SYNC, '{'};
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::vector<unsigned char> input(static_cast<size_t>(state.range(0)));
+    for (auto& byte : input)
+    {
+        byte = static_cast<unsigned char>(distribution(generator));
+        while (std::find(syncBytes.begin(), syncBytes.end(), byte) != syncBytes.end()) { byte = static_cast<unsigned char>(distribution(generator)); }
+    }
+    input.insert(input.end(), data, data + sizeof(data));
+
+    std::array<unsigned char, MAX_ASCII_MESSAGE_LENGTH> buffer;
+    FramerType clFramer;
+    clFramer.SetFrameJson(true);
+    MetaDataStruct stMetaData;
+
+    for ([[maybe_unused]] auto _ : state) {
+        (void)clFramer.Write(input.data(), input.size());
+        while (clFramer.GetFrame(buffer.data(), static_cast<uint32_t>(buffer.size()), stMetaData) == STATUS::UNKNOWN) {}
+        (void)clFramer.Flush(buffer.data(), static_cast<uint32_t>(buffer.size()));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * input.size()));
+    state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static std::vector<unsigned char> MakeLargeBinaryMessage(uint16_t payloadLength)
+{
+    // Reuse the BESTPOS header with a longer payload, then append a valid CRC
+    std::vector<unsigned char> message(bestposBinary, bestposBinary + OEM4_BINARY_HEADER_LENGTH);
+    std::memcpy(message.data() + offsetof(Oem4BinaryHeader, usLength), &payloadLength, sizeof(payloadLength));
+    for (uint16_t i = 0; i < payloadLength; ++i) { message.push_back(static_cast<unsigned char>(i)); }
+
+    const uint32_t crc = CalculateBlockCrc32(message.data(), static_cast<uint32_t>(message.size()));
+    message.insert(message.end(), reinterpret_cast<const unsigned char*>(&crc), reinterpret_cast<const unsigned char*>(&crc) + sizeof(crc));
+    return message;
+}
+
+static std::vector<unsigned char> MakeLargeAsciiMessage(size_t payloadLength)
+{
+    // Reuse the BESTPOS header with a longer payload, then append a valid CRC
+    std::string message = "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;";
+    while (message.size() < payloadLength) { message += "-114.03066788586,"; }
+    message += "0";
+
+    const uint32_t crc = CalculateBlockCrc32(reinterpret_cast<const unsigned char*>(message.data()) + 1, static_cast<uint32_t>(message.size() - 1));
+    std::array<char, OEM4_ASCII_CRC_LENGTH + 1> crcString;
+    std::snprintf(crcString.data(), crcString.size(), "%08x", crc);
+    message += "*" + std::string(crcString.data()) + "\r\n";
+    return {message.begin(), message.end()};
+}
+
+template <typename FramerType> static void FrameLargeMessage(benchmark::State& state, const std::vector<unsigned char>& message)
+{
+    std::vector<unsigned char> buffer(MESSAGE_SIZE_MAX);
+    FramerType clFramer;
+    MetaDataStruct stMetaData;
+
+    for ([[maybe_unused]] auto _ : state) {
+        (void)clFramer.Write(message.data(), message.size());
+        (void)clFramer.GetFrame(buffer.data(), static_cast<uint32_t>(buffer.size()), stMetaData);
+        (void)clFramer.Flush(buffer.data(), static_cast<uint32_t>(buffer.size()));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * message.size()));
+    state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+template <typename FramerType> static void FrameLargeMessageView(benchmark::State& state, const std::vector<unsigned char>& message)
+{
+    FramerType clFramer;
+    MetaDataStruct stMetaData;
+    FrameView stFrameView;
+
+    for ([[maybe_unused]] auto _ : state) {
+        (void)clFramer.Write(message.data(), message.size());
+        (void)clFramer.GetFrameView(stFrameView, stMetaData);
+        benchmark::DoNotOptimize(stFrameView.data());
+        clFramer.Consume();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * message.size()));
+    state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
 template <size_t N> static void FrameManager(benchmark::State& state, const unsigned char(&data)[N])
 {
     std::array<unsigned char, MAX_ASCII_MESSAGE_LENGTH> buffer;
@@ -131,6 +260,106 @@ template <size_t N> static void FrameManager(benchmark::State& state, const unsi
     state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
 }
 
+static std::vector<unsigned char> MakeLargeAbbAsciiMessage(size_t payloadLength)
+{
+    // Reuse the BESTPOS header with as many body lines as fit in the payload length
+    std::string message = "<BESTPOS COM1 0 72.0 FINESTEERING 2215 148248.000 02000020 cdba 32768\r\n";
+    while (message.size() < payloadLength) { message += "<     SOL_COMPUTED SINGLE 51.15043711386 -114.03067767000 1097.2099\r\n"; }
+    return {message.begin(), message.end()};
+}
+
+static void FrameChunkedFramerManager(benchmark::State& state, const std::string& framerName, const std::vector<unsigned char>& message)
+{
+    // Deliver the message in serial-sized reads, polling for a frame after each one
+    const auto chunkSize = static_cast<size_t>(state.range(0));
+    std::vector<unsigned char> buffer(MESSAGE_SIZE_MAX);
+    FramerManager clFramerManager({framerName});
+    MetaDataBase* stMetaData;
+
+    for ([[maybe_unused]] auto _ : state) {
+        for (size_t written = 0; written < message.size(); written += chunkSize)
+        {
+            (void)clFramerManager.Write(message.data() + written, std::min(chunkSize, message.size() - written));
+            benchmark::DoNotOptimize(clFramerManager.GetFrame(buffer.data(), static_cast<uint32_t>(buffer.size()), stMetaData));
+        }
+        (void)clFramerManager.Flush(buffer.data(), static_cast<uint32_t>(buffer.size()));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * message.size()));
+}
+
+static std::vector<unsigned char> MakeMixedStream(size_t length)
+{
+    // Interleave the supported formats in a random order, as seen when logging several ports to one file
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 2);
+    std::vector<unsigned char> stream;
+    while (stream.size() < length)
+    {
+        switch (distribution(generator))
+        {
+        case 0: stream.insert(stream.end(), bestposAscii, bestposAscii + sizeof(bestposAscii) - 1); break;
+        case 1: stream.insert(stream.end(), bestposBinary, bestposBinary + sizeof(bestposBinary)); break;
+        default: stream.insert(stream.end(), bestposAbbAscii, bestposAbbAscii + sizeof(bestposAbbAscii) - 1); break;
+        }
+    }
+    return stream;
+}
+
+static std::vector<unsigned char> MakeNoisyStream(size_t length)
+{
+    // Random bytes with a valid log every 64 KB, as seen when reading a corrupt file or a misconfigured port
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::vector<unsigned char> stream;
+    while (stream.size() < length)
+    {
+        for (size_t i = 0; i < (64 << 10); ++i) { stream.push_back(static_cast<unsigned char>(distribution(generator))); }
+        stream.insert(stream.end(), bestposAscii, bestposAscii + sizeof(bestposAscii) - 1);
+        stream.insert(stream.end(), bestposBinary, bestposBinary + sizeof(bestposBinary));
+    }
+    return stream;
+}
+
+template <bool Batch> static void FrameManagerStream(benchmark::State& state, const std::vector<unsigned char>& stream, bool skipAhead = false)
+{
+    std::array<unsigned char, MAX_ASCII_MESSAGE_LENGTH> buffer;
+    std::array<FrameDescriptor, 256> frames;
+    FramerManager clFramerManager({"OEM_ASCII", "OEM_ABB_ASCII", "OEM_BINARY"});
+    clFramerManager.SetSkipAheadResync(skipAhead);
+    MetaDataBase* stMetaData;
+    size_t frameCount = 0;
+
+    for ([[maybe_unused]] auto _ : state) {
+        for (size_t written = 0; written < stream.size();)
+        {
+            written += clFramerManager.Write(stream.data() + written, std::min(clFramerManager.GetAvailableSpace(), stream.size() - written));
+            if constexpr (Batch)
+            {
+                const unsigned char* frameData;
+                while (const size_t count = clFramerManager.GetFrames(frames.data(), frames.size(), frameData))
+                {
+                    benchmark::DoNotOptimize(frameData);
+                    frameCount += count;
+                }
+            }
+            else
+            {
+                STATUS status;
+                while ((status = clFramerManager.GetFrame(buffer.data(), static_cast<uint32_t>(buffer.size()), stMetaData)) == STATUS::SUCCESS ||
+                       status == STATUS::UNKNOWN)
+                {
+                    frameCount++;
+                }
+            }
+        }
+        (void)clFramerManager.Flush(buffer.data(), static_cast<uint32_t>(buffer.size()));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * stream.size()));
+    state.counters["frames_per_second"] = benchmark::Counter(static_cast<double>(frameCount), benchmark::Counter::kIsRate);
+}
+
 static void FrameAscii(benchmark::State& state)
 {
     Frame<oem::Framer>(state, bestposAscii);
@@ -151,6 +380,36 @@ static void FrameJson(benchmark::State& state)
     Frame<oem::Framer>(state, bestsatsJson);
 }
 
+static void FrameAsciiHighGarbage(benchmark::State& state)
+{
+    FrameWithGarbage<oem::Framer>(state, bestposAscii);
+}
+
+static void FrameBinaryHighGarbage(benchmark::State& state)
+{
+    FrameWithGarbage<oem::Framer>(state, bestposBinary);
+}
+
+static void FrameAsciiLarge(benchmark::State& state)
+{
+    FrameLargeMessage<oem::Framer>(state, MakeLargeAsciiMessage(static_cast<size_t>(state.range(0))));
+}
+
+static void FrameBinaryLarge(benchmark::State& state)
+{
+    FrameLargeMessage<oem::Framer>(state, MakeLargeBinaryMessage(static_cast<uint16_t>(state.range(0))));
+}
+
+static void FrameAsciiLargeView(benchmark::State& state)
+{
+    FrameLargeMessageView<oem::Framer>(state, MakeLargeAsciiMessage(static_cast<size_t>(state.range(0))));
+}
+
+static void FrameBinaryLargeView(benchmark::State& state)
+{
+    FrameLargeMessageView<oem::Framer>(state, MakeLargeBinaryMessage(static_cast<uint16_t>(state.range(0))));
+}
+
 static void FrameAsciiFramerManager(benchmark::State& state)
 {
     FrameManager(state, bestposAscii);
@@ -166,11 +425,130 @@ static void FrameBinaryFramerManager(benchmark::State& state)
     FrameManager(state, bestposBinary);
 }
 
-template <size_t N> static void DecodeLog(benchmark::State& state, const unsigned char (&data)[N])
+static void FrameChunkedAsciiFramerManager(benchmark::State& state)
+{
+    FrameChunkedFramerManager(state, "OEM_ASCII", MakeLargeAsciiMessage(24 << 10));
+}
+
+static void FrameChunkedAbbAsciiFramerManager(benchmark::State& state)
+{
+    FrameChunkedFramerManager(state, "OEM_ABB_ASCII", MakeLargeAbbAsciiMessage(24 << 10));
+}
+
+static void FrameChunkedOemFramerManager(benchmark::State& state)
+{
+    FrameChunkedFramerManager(state, "OEM", MakeLargeAsciiMessage(24 << 10));
+}
+
+static void FrameMixedStreamFramerManager(benchmark::State& state)
+{
+    FrameManagerStream<false>(state, MakeMixedStream(4 << 20));
+}
+
+static void FrameMixedStreamFramerManagerBatch(benchmark::State& state)
+{
+    FrameManagerStream<true>(state, MakeMixedStream(4 << 20));
+}
+
+static void FrameNoisyStreamFramerManager(benchmark::State& state)
+{
+    FrameManagerStream<false>(state, MakeNoisyStream(10 << 20));
+}
+
+static void FrameNoisyStreamFramerManagerSkipAhead(benchmark::State& state)
+{
+    FrameManagerStream<false>(state, MakeNoisyStream(10 << 20), true);
+}
+
+static void FrameParallel(benchmark::State& state)
+{
+    static const std::vector<unsigned char> capture = MakeMixedStream(64 << 20);
+    ParallelFramer clParallelFramer(static_cast<size_t>(state.range(0)));
+    size_t frameCount = 0;
+
+    for ([[maybe_unused]] auto _ : state) { frameCount += clParallelFramer.Frame(capture.data(), capture.size()).size(); }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * capture.size()));
+    state.counters["frames_per_second"] = benchmark::Counter(static_cast<double>(frameCount), benchmark::Counter::kIsRate);
+}
+
+// The capture is split into chunks of the given size, one per thread, so every halving of the chunk size doubles the
+// boundaries to stitch. Stitching a boundary only frames up to the first frame the chunk also found, so throughput
+// should not drop as the chunks shrink.
+static void FrameParallelChunkSize(benchmark::State& state)
+{
+    static const std::vector<unsigned char> capture = MakeMixedStream(64 << 20);
+    const auto chunkSize = static_cast<uint64_t>(state.range(0));
+    ParallelFramer clParallelFramer(static_cast<size_t>(capture.size() / chunkSize));
+    clParallelFramer.SetMinChunkSize(chunkSize);
+    size_t frameCount = 0;
+
+    for ([[maybe_unused]] auto _ : state) { frameCount += clParallelFramer.Frame(capture.data(), capture.size()).size(); }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * capture.size()));
+    state.counters["boundaries"] = static_cast<double>(clParallelFramer.GetThreadCount() - 1);
+    state.counters["frames_per_second"] = benchmark::Counter(static_cast<double>(frameCount), benchmark::Counter::kIsRate);
+}
+
+template <bool Mapped> static void ReadFile(benchmark::State& state)
 {
     MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH"));
-    const HeaderDecoder headerDecoder(clJsonDb);
-    const MessageDecoder messageDecoder(clJsonDb);
+    const auto fileSize = static_cast<size_t>(state.range(0));
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "edie_read_file_benchmark.bin";
+    {
+        const std::vector<unsigned char> stream = MakeMixedStream(64 << 20);
+        std::ofstream ofs(filePath, std::ios::binary);
+        for (size_t written = 0; written < fileSize; written += stream.size())
+        {
+            ofs.write(reinterpret_cast<const char*>(stream.data()), static_cast<std::streamsize>(std::min(stream.size(), fileSize - written)));
+        }
+    }
+
+    // Only keep a log that is not in the file, so that reads cover the input source, framing and header decoding
+    FileParser clFileParser(clJsonDb);
+    auto clFilter = std::make_shared<Filter>();
+    clFilter->IncludeMessageId(1);
+    clFileParser.SetFilter(clFilter);
+    MetaDataStruct stMetaData;
+    MessageDataStruct stMessageData;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        if constexpr (Mapped) { (void)clFileParser.SetFile(filePath); }
+        else { (void)clFileParser.SetStream(std::make_shared<std::ifstream>(filePath, std::ios::binary)); }
+
+        while (clFileParser.Read(stMessageData, stMetaData) != STATUS::STREAM_EMPTY) {}
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * fileSize));
+    std::filesystem::remove(filePath);
+}
+
+static void ReadFileStream(benchmark::State& state)
+{
+    ReadFile<false>(state);
+}
+
+static void ReadFileMapped(benchmark::State& state)
+{
+    ReadFile<true>(state);
+}
+
+// ReuseMessage decodes every log into the same CompositeField, which recycles its storage between logs
+template <bool ReuseMessage, bool ViewDecoding = false, size_t N> static void DecodeLog(benchmark::State& state, const unsigned char (&data)[N])
+{
+    MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH"));
+    HeaderDecoder headerDecoder(clJsonDb);
+    MessageDecoder messageDecoder(clJsonDb);
+    messageDecoder.SetViewDecoding(ViewDecoding);
+    // Decode the header and body of JSON logs from a single parse, as the Parser does
+    const auto pclJsonParser = std::make_shared<JsonMessageParser>();
+    headerDecoder.SetJsonParser(pclJsonParser);
+    messageDecoder.SetJsonParser(pclJsonParser);
+
+    IntermediateHeader reusedHeader;
+    CompositeField reusedMessage;
+    const uint64_t ullStartAllocations = ullAllocationCount.load(std::memory_order_relaxed);
 
     for ([[maybe_unused]] auto _ : state)
     {
@@ -179,44 +557,204 @@ template <size_t N> static void DecodeLog(benchmark::State& state, const unsigne
         IntermediateHeader header;
         CompositeField message;
 
-        (void)headerDecoder.Decode(dataPtr, header, metaData);
+        (void)headerDecoder.Decode(dataPtr, ReuseMessage ? reusedHeader : header, metaData);
         dataPtr += metaData.uiHeaderLength;
-        (void)messageDecoder.Decode(dataPtr, message, metaData);
+        (void)messageDecoder.Decode(dataPtr, ReuseMessage ? reusedMessage : message, metaData);
     }
 
+    const uint64_t ullAllocations = ullAllocationCount.load(std::memory_order_relaxed) - ullStartAllocations;
     state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+    state.counters["allocs_per_log"] = benchmark::Counter(static_cast<double>(ullAllocations), benchmark::Counter::kAvgIterations);
 }
 
 static void DecodeAsciiLog(benchmark::State& state)
 {
-    DecodeLog(state, bestposAscii);
+    DecodeLog<false>(state, bestposAscii);
 }
 
 static void DecodeAsciiRangeLog(benchmark::State& state)
 {
-    DecodeLog(state, rangeAscii);
+    DecodeLog<false>(state, rangeAscii);
 }
 
 static void DecodeAbbrevAsciiLog(benchmark::State& state)
 {
-    DecodeLog(state, bestposAbbAscii);
+    DecodeLog<false>(state, bestposAbbAscii);
 }
 
 static void DecodeAbbrevAsciiRangeLog(benchmark::State& state)
 {
-    DecodeLog(state, rangeAbbAscii);
+    DecodeLog<false>(state, rangeAbbAscii);
 }
 
 static void DecodeBinaryLog(benchmark::State& state)
 {
-    DecodeLog(state, bestposBinary);
+    DecodeLog<false>(state, bestposBinary);
 }
 
 static void DecodeJsonLog(benchmark::State& state)
 { 
-    DecodeLog(state, bestsatsJson);
+    DecodeLog<false>(state, bestsatsJson);
+}
+
+static void DecodeAsciiRangeLogReused(benchmark::State& state)
+{
+    DecodeLog<true>(state, rangeAscii);
+}
+
+static void DecodeAbbrevAsciiRangeLogReused(benchmark::State& state)
+{
+    DecodeLog<true>(state, rangeAbbAscii);
+}
+
+static void DecodeBinaryLogReused(benchmark::State& state)
+{
+    DecodeLog<true>(state, bestposBinary);
+}
+
+static void DecodeJsonLogReused(benchmark::State& state)
+{
+    DecodeLog<true>(state, bestsatsJson);
+}
+
+static void DecodeBinaryLogView(benchmark::State& state)
+{
+    DecodeLog<true, true>(state, bestposBinary);
+}
+
+// Decode only a few fields of each log
+template <size_t N>
+static void DecodeLogProjected(benchmark::State& state, const unsigned char (&data)[N], const std::string& messageName,
+                               const std::vector<std::string>& fieldNames)
+{
+    MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH"));
+    const HeaderDecoder headerDecoder(clJsonDb);
+    MessageDecoder messageDecoder(clJsonDb);
+    messageDecoder.SetProjection(messageName, fieldNames);
+
+    IntermediateHeader header;
+    CompositeField message;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const unsigned char* dataPtr = data;
+        MetaDataStruct metaData;
+
+        (void)headerDecoder.Decode(dataPtr, header, metaData);
+        dataPtr += metaData.uiHeaderLength;
+        (void)messageDecoder.Decode(dataPtr, message, metaData);
+    }
+
+    state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void DecodeAsciiLogProjected(benchmark::State& state)
+{
+    DecodeLogProjected(state, bestposAscii, "BESTPOS", {"solution_status", "position_type"});
+}
+
+static void DecodeBinaryLogProjected(benchmark::State& state)
+{
+    DecodeLogProjected(state, bestposBinary, "BESTPOS", {"solution_status", "position_type"});
+}
+
+// Decode logs lazily and read a few fields of each, as a filter would
+template <size_t N> static void DecodeLogLazy(benchmark::State& state, const unsigned char (&data)[N], const std::vector<std::string>& fieldNames)
+{
+    MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH"));
+    const HeaderDecoder headerDecoder(clJsonDb);
+    const MessageDecoder messageDecoder(clJsonDb);
+
+    IntermediateHeader header;
+    LazyCompositeField message;
+    int64_t llFieldSum = 0;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const unsigned char* dataPtr = data;
+        MetaDataStruct metaData;
+
+        (void)headerDecoder.Decode(dataPtr, header, metaData);
+        dataPtr += metaData.uiHeaderLength;
+        (void)messageDecoder.DecodeLazy(dataPtr, message, metaData);
+        for (const std::string& fieldName : fieldNames) { llFieldSum += message.GetFieldValueByName<int32_t>(fieldName); }
+    }
+
+    benchmark::DoNotOptimize(llFieldSum);
+    state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
 }
 
+static void DecodeAsciiLogLazy(benchmark::State& state)
+{
+    DecodeLogLazy(state, bestposAscii, {"solution_status", "position_type"});
+}
+
+static void DecodeAbbrevAsciiLogLazy(benchmark::State& state)
+{
+    DecodeLogLazy(state, bestposAbbAscii, {"solution_status", "position_type"});
+}
+
+// Read fields of a decoded log by name, or through handles resolved once
+template <bool UseHandles> static void ReadFields(benchmark::State& state)
+{
+    MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH"));
+    const HeaderDecoder headerDecoder(clJsonDb);
+    const MessageDecoder messageDecoder(clJsonDb);
+    const std::vector<std::string> fieldNames{"latitude", "longitude", "orthometric_height"};
+
+    const unsigned char* dataPtr = bestposBinary;
+    MetaDataStruct metaData;
+    IntermediateHeader header;
+    CompositeField message;
+    (void)headerDecoder.Decode(dataPtr, header, metaData);
+    dataPtr += metaData.uiHeaderLength;
+    (void)messageDecoder.Decode(dataPtr, message, metaData);
+
+    std::vector<FieldHandle> handles;
+    for (const std::string& fieldName : fieldNames) { handles.push_back(message.GetFieldInfo()->GetFieldHandle(fieldName)); }
+    double dFieldSum = 0.0;
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        if constexpr (UseHandles)
+        {
+            for (const FieldHandle& handle : handles) { dFieldSum += message.GetFieldValue<double>(handle); }
+        }
+        else
+        {
+            for (const std::string& fieldName : fieldNames) { dFieldSum += message.GetFieldValueByName<double>(fieldName); }
+        }
+    }
+
+    benchmark::DoNotOptimize(dFieldSum);
+    state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void ReadFieldsByName(benchmark::State& state) { ReadFields<false>(state); }
+
+static void ReadFieldsByHandle(benchmark::State& state) { ReadFields<true>(state); }
+
+// Decode logs into columns, appending each to a batch that is cleared when full
+template <size_t N>
+static void DecodeLogColumnar(benchmark::State& state, const unsigned char (&data)[N], const std::string& messageName,
+                              const std::vector<std::string>& fieldNames)
+{
+    constexpr size_t batchSize = 1024;
+    MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH"));
+    ColumnarBatchDecoder decoder(clJsonDb, messageName, fieldNames);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        MetaDataStruct metaData;
+        (void)decoder.Append(data, metaData);
+        if (decoder.GetTable().size() == batchSize) { decoder.Clear(); }
+    }
+
+    state.counters["logs_per_second"] = benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+static void DecodeAsciiRangeLogColumnar(benchmark::State& state) { DecodeLogColumnar(state, rangeAscii, "RANGE", {"obs"}); }
+
 template <size_t N> static void DecodeHeader(benchmark::State& state, const unsigned char (&data)[N])
 {
     MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH"));
@@ -289,6 +827,28 @@ static void EncodeAbbrevAsciiLog(benchmark::State& state) { EncodeLog<ENCODE_FOR
 static void EncodeBinaryLog(benchmark::State& state) { EncodeLog<ENCODE_FORMAT::BINARY>(state, bestposBinary); }
 static void EncodeJsonLog(benchmark::State& state) { EncodeLog<ENCODE_FORMAT::JSON>(state, bestposBinary); }
 
+template <uint32_t (*CrcFunction)(const unsigned char*, uint32_t, uint32_t)> static void CalculateCrc32(benchmark::State& state)
+{
+    std::vector<unsigned char> data(static_cast<size_t>(state.range(0)));
+    std::iota(data.begin(), data.end(), static_cast<unsigned char>(0));
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        benchmark::DoNotOptimize(CrcFunction(data.data(), static_cast<uint32_t>(data.size()), 0));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+static uint32_t Crc32SliceBy8(const unsigned char* buffer, uint32_t count, uint32_t initialCrc)
+{
+    return CalculateBlockCrc<uint32_t, 0xEDB88320UL, true>(buffer, count, initialCrc);
+}
+
+static void CalculateCrc32SliceBy8(benchmark::State& state) { CalculateCrc32<Crc32SliceBy8>(state); }
+static void CalculateCrc32Folding(benchmark::State& state) { CalculateCrc32<CalculateBlockCrc32Folding>(state); }
+static void CalculateCrc32Oem(benchmark::State& state) { CalculateCrc32<oem::CalculateBlockCrc32>(state); }
+
 static void DecompressRangeCmpGeneral(benchmark::State& state, uint32_t id, const char* compressedData)
 {
     MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH"));
@@ -320,15 +880,44 @@ BENCHMARK(FrameAscii)->MinTime(2.0);
 BENCHMARK(FrameAbbAscii)->MinTime(2.0);
 BENCHMARK(FrameBinary)->MinTime(2.0);
 BENCHMARK(FrameJson)->MinTime(2.0);
+BENCHMARK(FrameAsciiHighGarbage)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 16);
+BENCHMARK(FrameBinaryHighGarbage)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 16);
+BENCHMARK(FrameAsciiLarge)->Arg(1 << 10)->Arg(1 << 12)->Arg(1 << 14);
+BENCHMARK(FrameBinaryLarge)->Arg(1 << 10)->Arg(1 << 12)->Arg(1 << 14);
+BENCHMARK(FrameAsciiLargeView)->Arg(1 << 10)->Arg(1 << 12)->Arg(1 << 14);
+BENCHMARK(FrameBinaryLargeView)->Arg(1 << 10)->Arg(1 << 12)->Arg(1 << 14);
 BENCHMARK(FrameAsciiFramerManager)->MinTime(2.0);
 BENCHMARK(FrameAbbAsciiFramerManager)->MinTime(2.0);
 BENCHMARK(FrameBinaryFramerManager)->MinTime(2.0);
+BENCHMARK(FrameChunkedAsciiFramerManager)->Arg(64)->Arg(1 << 10)->Arg(24 << 10);
+BENCHMARK(FrameChunkedAbbAsciiFramerManager)->Arg(64)->Arg(1 << 10)->Arg(24 << 10);
+BENCHMARK(FrameChunkedOemFramerManager)->Arg(64)->Arg(1 << 10)->Arg(24 << 10);
+BENCHMARK(FrameMixedStreamFramerManager);
+BENCHMARK(FrameMixedStreamFramerManagerBatch);
+BENCHMARK(FrameNoisyStreamFramerManager)->Unit(benchmark::kMillisecond);
+BENCHMARK(FrameNoisyStreamFramerManagerSkipAhead)->Unit(benchmark::kMillisecond);
+BENCHMARK(FrameParallel)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(FrameParallelChunkSize)->RangeMultiplier(2)->Range(1 << 20, 32 << 20)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(ReadFileStream)->Arg(1 << 30)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReadFileMapped)->Arg(1 << 30)->Unit(benchmark::kMillisecond);
 BENCHMARK(DecodeAsciiLog);
 BENCHMARK(DecodeAsciiRangeLog);
 BENCHMARK(DecodeAbbrevAsciiLog);
 BENCHMARK(DecodeAbbrevAsciiRangeLog);
 BENCHMARK(DecodeBinaryLog);
 BENCHMARK(DecodeJsonLog);
+BENCHMARK(DecodeAsciiRangeLogReused);
+BENCHMARK(DecodeAbbrevAsciiRangeLogReused);
+BENCHMARK(DecodeBinaryLogReused);
+BENCHMARK(DecodeJsonLogReused);
+BENCHMARK(DecodeBinaryLogView);
+BENCHMARK(DecodeAsciiLogProjected);
+BENCHMARK(DecodeBinaryLogProjected);
+BENCHMARK(DecodeAsciiLogLazy);
+BENCHMARK(DecodeAbbrevAsciiLogLazy);
+BENCHMARK(ReadFieldsByName);
+BENCHMARK(ReadFieldsByHandle);
+BENCHMARK(DecodeAsciiRangeLogColumnar);
 BENCHMARK(DecodeAsciiHeader);
 BENCHMARK(DecodeAbbrevAsciiHeader);
 BENCHMARK(DecodeBinaryHeader);
@@ -342,7 +931,11 @@ BENCHMARK(DecompressRangeCmp);
 BENCHMARK(DecompressRangeCmp2);
 BENCHMARK(DecompressRangeCmp4);
 BENCHMARK(DecompressRangeCmp5);
+BENCHMARK(CalculateCrc32SliceBy8)->RangeMultiplier(4)->Range(28, 32 << 10);
+BENCHMARK(CalculateCrc32Folding)->RangeMultiplier(4)->Range(28, 32 << 10);
+BENCHMARK(CalculateCrc32Oem)->RangeMultiplier(4)->Range(28, 32 << 10);
 BENCHMARK(LoadJson);
+BENCHMARK(LoadBinary);
 
 int main(int argc, char** argv)
 {
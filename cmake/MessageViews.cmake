@@ -0,0 +1,46 @@
+set(NOVATEL_EDIE_MESSAGE_VIEWS_GENERATOR "${CMAKE_CURRENT_LIST_DIR}/../scripts/gen_message_views.py")
+
+# Generate a header of typed message views (see message_view.hpp) from a JSON message database
+#
+# novatel_edie_add_message_views(<target> DATABASE <json> [HEADER <path>] [NAMESPACE <namespace>] [MESSAGES <name>...])
+#
+# Creates an INTERFACE library <target> whose include directory holds the generated header. The
+# header is regenerated when the database or the generator changes. HEADER is the path of the
+# header relative to that include directory.
+function(novatel_edie_add_message_views target)
+    cmake_parse_arguments(ARG "" "DATABASE;HEADER;NAMESPACE" "MESSAGES" ${ARGN})
+    if(NOT ARG_DATABASE)
+        message(FATAL_ERROR "novatel_edie_add_message_views: DATABASE is required")
+    endif()
+    if(NOT ARG_HEADER)
+        set(ARG_HEADER "novatel_edie/decoders/oem/message_views.hpp")
+    endif()
+    if(NOT ARG_NAMESPACE)
+        set(ARG_NAMESPACE "novatel::edie::oem::views")
+    endif()
+    set(message_args)
+    if(ARG_MESSAGES)
+        set(message_args --messages ${ARG_MESSAGES})
+    endif()
+
+    find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+    set(include_dir "${CMAKE_CURRENT_BINARY_DIR}/${target}/include")
+    set(header "${include_dir}/${ARG_HEADER}")
+    get_filename_component(header_dir "${header}" DIRECTORY)
+
+    add_custom_command(
+        OUTPUT "${header}"
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${header_dir}"
+        COMMAND ${Python3_EXECUTABLE} "${NOVATEL_EDIE_MESSAGE_VIEWS_GENERATOR}" "${ARG_DATABASE}"
+                --out_file "${header}" --namespace "${ARG_NAMESPACE}" ${message_args}
+        DEPENDS "${ARG_DATABASE}" "${NOVATEL_EDIE_MESSAGE_VIEWS_GENERATOR}"
+        COMMENT "Generating ${ARG_HEADER} from ${ARG_DATABASE}"
+        VERBATIM)
+    add_custom_target(${target}_header DEPENDS "${header}")
+
+    add_library(${target} INTERFACE)
+    add_dependencies(${target} ${target}_header)
+    target_include_directories(${target} INTERFACE "$<BUILD_INTERFACE:${include_dir}>")
+    target_link_libraries(${target} INTERFACE decoders_common)
+endfunction()
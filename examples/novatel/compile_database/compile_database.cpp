@@ -0,0 +1,88 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file compile_database.cpp
+// ===============================================================================
+
+#include <chrono>
+#include <filesystem>
+
+#include <novatel_edie/common/logger.hpp>
+#include <novatel_edie/decoders/common/binary_db.hpp>
+#include <novatel_edie/decoders/common/json_db_reader.hpp>
+#include <novatel_edie/decoders/oem/common.hpp>
+
+namespace fs = std::filesystem;
+
+using namespace novatel::edie;
+
+int main(int argc, char* argv[])
+{
+    // This example uses the default logger config, but you can also pass a config file to InitLogger()
+    // Example config file: logger\example_logger_config.toml
+    LOGGER_MANAGER->InitLogger();
+    auto pclLogger = CREATE_LOGGER();
+    pclLogger->set_level(spdlog::level::debug);
+    LOGGER_MANAGER->AddConsoleLogging(pclLogger);
+
+    if (argc < 3)
+    {
+        pclLogger->error("Format: compile_database <path to Json DB> <path to binary DB>\n");
+        pclLogger->error("Example: compile_database database/database.json database/database.bin\n");
+        return 1;
+    }
+
+    const fs::path pathJsonDb = argv[1];
+    if (!fs::exists(pathJsonDb))
+    {
+        pclLogger->error("File \"{}\" does not exist", pathJsonDb.string());
+        return 1;
+    }
+    const fs::path pathBinaryDb = argv[2];
+
+    // The binary database stores the field offsets, so the alignment of the message family must be known when compiling it
+    MessageDatabase::RegisterAlignmentFunction("OEM", oem::OemAlignmentFunction);
+
+    try
+    {
+        auto tStart = std::chrono::high_resolution_clock::now();
+        const MessageDatabase::Ptr clJsonDb = LoadJsonDbFile(pathJsonDb);
+        pclLogger->info("Loaded JSON database in {}ms",
+                        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - tStart).count());
+
+        WriteBinaryDbFile(*clJsonDb, pathBinaryDb);
+
+        tStart = std::chrono::high_resolution_clock::now();
+        const MessageDatabase::Ptr clBinaryDb = LoadBinaryDbFile(pathBinaryDb);
+        pclLogger->info("Loaded binary database in {}ms",
+                        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - tStart).count());
+        pclLogger->info("Wrote {} messages and {} enums to \"{}\"", clBinaryDb->MessageDefinitions().size(), clBinaryDb->EnumDefinitions().size(),
+                        pathBinaryDb.string());
+    }
+    catch (const std::exception& e)
+    {
+        pclLogger->error("{}", e.what());
+        return 1;
+    }
+
+    return 0;
+}
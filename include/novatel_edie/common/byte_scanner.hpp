@@ -0,0 +1,113 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file byte_scanner.hpp
+// ===============================================================================
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+
+#include "novatel_edie/common/cpu_features.hpp"
+
+namespace novatel::edie {
+
+//============================================================================
+//! \class ByteScanner
+//! \brief Locates the first byte in a block that belongs to a small set of
+//! values, e.g. the sync bytes of every format a framer recognizes.
+//! Find() is dispatched once at runtime to an AVX2, SSE2 or scalar
+//! implementation depending on the host CPU.
+//============================================================================
+class ByteScanner
+{
+  public:
+    //! \brief The maximum number of distinct values a scanner can search for.
+    static constexpr size_t MAX_VALUES = 8;
+
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for the ByteScanner class.
+    //
+    //! \param[in] values_ The byte values to search for. Values beyond
+    //! MAX_VALUES are ignored.
+    //----------------------------------------------------------------------------
+    constexpr ByteScanner(std::initializer_list<unsigned char> values_)
+    {
+        for (const unsigned char ucValue : values_) { static_cast<void>(Add(ucValue)); }
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for an empty ByteScanner, which matches no byte
+    //! until values are added.
+    //----------------------------------------------------------------------------
+    constexpr ByteScanner() = default;
+
+    //----------------------------------------------------------------------------
+    //! \brief Add a value to search for.
+    //
+    //! \param[in] ucValue_ The byte value.
+    //
+    //! \return false if the scanner already holds MAX_VALUES other values, in
+    //! which case the value is not added.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] constexpr bool Add(const unsigned char ucValue_)
+    {
+        if (abMyLookup[ucValue_]) { return true; }
+        if (uiMyValueCount == MAX_VALUES) { return false; }
+        abMyLookup[ucValue_] = true;
+        aucMyValues[uiMyValueCount++] = ucValue_;
+        return true;
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Check if a byte is one of the values searched for.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] constexpr bool Contains(const unsigned char ucValue_) const noexcept { return abMyLookup[ucValue_]; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Find the first byte in the block that is one of the values.
+    //
+    //! \param[in] pucData_ The block to search.
+    //! \param[in] uiLength_ The number of bytes in pucData_.
+    //
+    //! \return The index of the first matching byte, or uiLength_ if none match.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] size_t Find(const unsigned char* pucData_, size_t uiLength_) const noexcept;
+
+    //----------------------------------------------------------------------------
+    //! \brief Find the first matching byte using a specific implementation.
+    //! Levels the host does not support fall back to the widest one it does.
+    //
+    //! \see Find(const unsigned char*, size_t)
+    //----------------------------------------------------------------------------
+    [[nodiscard]] size_t Find(const unsigned char* pucData_, size_t uiLength_, SIMD_LEVEL eLevel_) const noexcept;
+
+  private:
+    std::array<unsigned char, MAX_VALUES> aucMyValues{};
+    size_t uiMyValueCount{0};
+    std::array<bool, 256> abMyLookup{};
+};
+
+} // namespace novatel::edie
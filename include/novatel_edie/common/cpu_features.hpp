@@ -0,0 +1,85 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file cpu_features.hpp
+// ===============================================================================
+
+#pragma once
+
+// EDIE_SIMD_X86 is defined where the x86 SIMD paths are compiled. Functions using instructions
+// beyond SSE2 are marked with EDIE_TARGET_*, and are only called once the CPU is known to
+// support them. MSVC compiles any intrinsic without such a marker.
+#if defined(_M_X64) || defined(__x86_64__)
+#define EDIE_SIMD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+#define EDIE_TARGET_AVX2
+#define EDIE_TARGET_PCLMUL
+#else
+#define EDIE_TARGET_AVX2 __attribute__((target("avx2")))
+#define EDIE_TARGET_PCLMUL __attribute__((target("pclmul")))
+#endif
+#endif
+
+namespace novatel::edie {
+
+//-----------------------------------------------------------------------
+//! \enum SIMD_LEVEL
+//! \brief The widest vector instruction set a hot path may dispatch to.
+//-----------------------------------------------------------------------
+enum class SIMD_LEVEL
+{
+    SCALAR, //!< Portable C++ implementation.
+    SSE2,   //!< 128-bit x86 vectors.
+    AVX2    //!< 256-bit x86 vectors.
+};
+
+//-----------------------------------------------------------------------
+//! \brief Get the widest SIMD level supported by the host CPU and OS.
+//! The result is computed once and cached.
+//
+//! \return The supported SIMD level, SCALAR on non-x86 targets.
+//-----------------------------------------------------------------------
+[[nodiscard]] SIMD_LEVEL GetSupportedSimdLevel() noexcept;
+
+//-----------------------------------------------------------------------
+//! \brief Get the SIMD level to dispatch a request for a level to.
+//
+//! \param[in] eLevel_ The requested SIMD level.
+//
+//! \return The narrower of the requested and the supported SIMD level.
+//-----------------------------------------------------------------------
+[[nodiscard]] inline SIMD_LEVEL GetDispatchSimdLevel(const SIMD_LEVEL eLevel_) noexcept
+{
+    const SIMD_LEVEL eSupportedLevel = GetSupportedSimdLevel();
+    return eLevel_ < eSupportedLevel ? eLevel_ : eSupportedLevel;
+}
+
+//-----------------------------------------------------------------------
+//! \brief Check if the host CPU supports carry-less multiplication (PCLMULQDQ).
+//! The result is computed once and cached.
+//
+//! \return true if PCLMULQDQ is available, false otherwise or on non-x86 targets.
+//-----------------------------------------------------------------------
+[[nodiscard]] bool IsPclmulSupported() noexcept;
+
+} // namespace novatel::edie
@@ -33,6 +33,16 @@
 #include <string_view>
 #include <type_traits>
 
+// Detect whether a constexpr function is being evaluated at compile time so runtime-only
+// (intrinsic) CRC implementations can be selected without losing constexpr support.
+#if defined(__cpp_lib_is_constant_evaluated)
+#define EDIE_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define EDIE_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define EDIE_IS_CONSTANT_EVALUATED() true
+#endif
+
 namespace {
 // Build the slice-by-8 lookup tables for the given generator polynomial.
 // Rev=true expects a reflected polynomial and computes LSB-first tables.
@@ -224,6 +234,21 @@ template <typename CrcT, CrcT Poly, bool Rev> constexpr CrcT CalculateBlockCrc(s
     return uiCrc;
 }
 
+// --------------------------------------------------------------------------
+// Runtime-dispatched CRC-32 (reflected polynomial 0xEDB88320)
+// --------------------------------------------------------------------------
+//! The minimum block length for which CRC-32 folding is used. Shorter blocks use slice-by-8.
+constexpr uint32_t CRC32_FOLDING_MIN_LENGTH = 64;
+
+//! \brief Check if the host supports the carry-less multiplication CRC-32 folding path.
+[[nodiscard]] bool IsCrc32FoldingSupported() noexcept;
+
+//! \brief Calculate the reflected 0xEDB88320 CRC-32 of a block by folding 64 bytes per
+//! iteration with carry-less multiplication (PCLMULQDQ), finishing with slice-by-8.
+//! Produces the same result as CalculateBlockCrc<uint32_t, 0xEDB88320UL, true> and falls
+//! back to it when folding is unsupported or the block is shorter than CRC32_FOLDING_MIN_LENGTH.
+[[nodiscard]] uint32_t CalculateBlockCrc32Folding(const unsigned char* ucBuffer_, uint32_t uiCount_, uint32_t uiInitialCrc_ = 0) noexcept;
+
 // --------------------------------------------------------------------------
 // Backward-compatible CRC-32 API
 // --------------------------------------------------------------------------
@@ -235,6 +260,13 @@ template <uint32_t Poly = 0xEDB88320UL, bool Rev = true> constexpr void Calculat
 template <uint32_t Poly = 0xEDB88320UL, bool Rev = true>
 constexpr uint32_t CalculateBlockCrc32(const unsigned char* ucBuffer_, uint32_t uiCount_, uint32_t uiInitialCrc_ = 0)
 {
+    if constexpr (Poly == 0xEDB88320UL && Rev)
+    {
+        if (!EDIE_IS_CONSTANT_EVALUATED() && uiCount_ >= CRC32_FOLDING_MIN_LENGTH)
+        {
+            return CalculateBlockCrc32Folding(ucBuffer_, uiCount_, uiInitialCrc_);
+        }
+    }
     return CalculateBlockCrc<uint32_t, Poly, Rev>(ucBuffer_, uiCount_, uiInitialCrc_);
 }
 
@@ -0,0 +1,179 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file delimiter_index.hpp
+// ===============================================================================
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "novatel_edie/common/cpu_features.hpp"
+
+namespace novatel::edie {
+
+//============================================================================
+//! \class DelimiterIndex
+//! \brief Bitmaps of the delimiter positions in a block of delimited text,
+//! e.g. the body of an ASCII log, built in a single pass with vector compares.
+//! Token lengths are then found by scanning the bitmaps instead of the text.
+//!
+//! Three kinds of byte are indexed: the field delimiter, the end delimiter
+//! (which also matches NUL) and the double-quote. Quotes are kept in their own
+//! bitmap rather than masking out the delimiters between them, so a quoted
+//! string is measured up to its closing quote while stray quotes in unquoted
+//! fields cannot desynchronize the rest of the block.
+//!
+//! Lookups outside of the indexed block, or that run off its end without a
+//! match, fall back to strcspn() so the results always equal those of strcspn()
+//! with the same delimiters.
+//!
+//! The bitmaps are sized to the longest block indexed so far and keep their
+//! capacity, so an index reused from one message to the next only allocates
+//! when a message is longer than any before it.
+//============================================================================
+class DelimiterIndex
+{
+  public:
+    //! \brief The largest block that can be indexed.
+    static constexpr size_t MAX_LENGTH = 0x8000;
+
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for the DelimiterIndex class. The index is empty
+    //! until Build() is called.
+    //
+    //! \param[in] cFieldDelimiter_ The character that separates fields.
+    //! \param[in] cEndDelimiter_ The character that ends the delimited text.
+    //----------------------------------------------------------------------------
+    DelimiterIndex(char cFieldDelimiter_, char cEndDelimiter_) noexcept;
+
+    //----------------------------------------------------------------------------
+    //! \brief Index a block of text, replacing any previous index.
+    //
+    //! \param[in] pcData_ The text to index. It must outlive the index.
+    //! \param[in] uiLength_ The number of bytes in pcData_.
+    //
+    //! \return false if the block is longer than MAX_LENGTH or its bitmaps could
+    //! not be allocated, in which case the index is left empty and every lookup
+    //! falls back to strcspn().
+    //----------------------------------------------------------------------------
+    bool Build(const char* pcData_, size_t uiLength_) noexcept;
+
+    //----------------------------------------------------------------------------
+    //! \brief Index a block of text using a specific implementation.
+    //! Levels the host does not support fall back to the widest one it does.
+    //
+    //! \see Build(const char*, size_t)
+    //----------------------------------------------------------------------------
+    bool Build(const char* pcData_, size_t uiLength_, SIMD_LEVEL eLevel_) noexcept;
+
+    //----------------------------------------------------------------------------
+    //! \brief Empty the index, keeping the capacity of its bitmaps. Every lookup
+    //! falls back to strcspn() until the next Build().
+    //----------------------------------------------------------------------------
+    void Clear() noexcept
+    {
+        pcMyData = nullptr;
+        uiMyLength = 0;
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the length of the token starting at pcToken_, up to the next
+    //! field delimiter, end delimiter or NUL.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] size_t TokenLength(const char* pcToken_) const noexcept { return Find<true, false>(pcToken_); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the length of the quoted text starting at pcToken_, up to the
+    //! next double-quote, end delimiter or NUL.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] size_t QuotedLength(const char* pcToken_) const noexcept { return Find<false, true>(pcToken_); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the length of the text starting at pcToken_, up to the next
+    //! end delimiter or NUL, ignoring field delimiters.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] size_t RemainingLength(const char* pcToken_) const noexcept { return Find<false, false>(pcToken_); }
+
+  private:
+    struct Block
+    {
+        uint64_t ullField; // Field delimiters
+        uint64_t ullEnd;   // End delimiters and NULs
+        uint64_t ullQuote; // Double-quotes
+    };
+
+    template <bool Field, bool Quote> [[nodiscard]] size_t Find(const char* pcToken_) const noexcept;
+
+    std::array<char, 4> acMyTokenDelimiters;
+    std::array<char, 4> acMyQuotedDelimiters;
+    std::array<char, 2> acMyRemainingDelimiters;
+    const char* pcMyData{nullptr};
+    size_t uiMyLength{0};
+    std::vector<Block> vMyBlocks; // Only the blocks covering pcMyData are built
+};
+
+//----------------------------------------------------------------------------
+template <bool Field, bool Quote> size_t DelimiterIndex::Find(const char* pcToken_) const noexcept
+{
+    const char* pcDelimiters = Field ? acMyTokenDelimiters.data() : Quote ? acMyQuotedDelimiters.data() : acMyRemainingDelimiters.data();
+
+    // Wraps around for tokens before the block, so a single compare checks both ends
+    const auto uiOffset = static_cast<size_t>(reinterpret_cast<uintptr_t>(pcToken_) - reinterpret_cast<uintptr_t>(pcMyData));
+    if (uiOffset >= uiMyLength) { return strcspn(pcToken_, pcDelimiters); }
+
+    const auto Matches = [](const Block& stBlock_) {
+        uint64_t ullMatches = stBlock_.ullEnd;
+        if constexpr (Field) { ullMatches |= stBlock_.ullField; }
+        if constexpr (Quote) { ullMatches |= stBlock_.ullQuote; }
+        return ullMatches;
+    };
+
+    size_t uiBlock = uiOffset / 64;
+    uint64_t ullMatches = Matches(vMyBlocks[uiBlock]) & (~uint64_t{0} << (uiOffset % 64));
+    const size_t uiBlockCount = (uiMyLength + 63) / 64;
+    while (ullMatches == 0)
+    {
+        // No delimiter in the rest of the block, continue past its end like strcspn() would
+        if (++uiBlock == uiBlockCount) { return uiMyLength - uiOffset + strcspn(pcMyData + uiMyLength, pcDelimiters); }
+        ullMatches = Matches(vMyBlocks[uiBlock]);
+    }
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long ulBit;
+    _BitScanForward64(&ulBit, ullMatches);
+#else
+    const auto ulBit = static_cast<unsigned long>(__builtin_ctzll(ullMatches));
+#endif
+    return uiBlock * 64 + ulBit - uiOffset;
+}
+
+} // namespace novatel::edie
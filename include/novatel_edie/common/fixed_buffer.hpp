@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <numeric>
@@ -37,6 +38,47 @@
 //!< Recommended frame buffer size. Should work for most formats and message sizes. If the buffer is too small, the framer will return BUFFER_FULL.
 constexpr uint32_t RECOMMENDED_FRAME_BUFFER_SIZE = 256 * 1024; // 256Kb
 
+//-----------------------------------------------------------------------
+//! \enum FIXED_BUFFER_BACKEND
+//! \brief The memory layout backing a FixedBuffer.
+//-----------------------------------------------------------------------
+enum class FIXED_BUFFER_BACKEND
+{
+    LINEAR,  //!< A heap array of twice the capacity. Unconsumed data is occasionally shifted to the front.
+    MIRRORED //!< The same pages mapped twice back to back. Data never moves and the head simply wraps.
+};
+
+namespace novatel::edie {
+
+//-----------------------------------------------------------------------
+//! \brief Get the size that mirrored memory mappings must be a multiple of.
+//
+//! \return The allocation granularity in bytes, or 0 if mirrored memory is
+//! not supported on this platform.
+//-----------------------------------------------------------------------
+[[nodiscard]] size_t GetMirroredMemoryGranularity() noexcept;
+
+//-----------------------------------------------------------------------
+//! \brief Map uiSize_ bytes of memory twice, back to back, so that byte
+//! uiSize_ + i aliases byte i.
+//
+//! \param[in] uiSize_ The size of one mapping. Must be a non-zero multiple of
+//! GetMirroredMemoryGranularity().
+//
+//! \return The base of the 2 * uiSize_ byte region, or nullptr on failure.
+//-----------------------------------------------------------------------
+[[nodiscard]] void* AllocateMirroredMemory(size_t uiSize_) noexcept;
+
+//-----------------------------------------------------------------------
+//! \brief Release memory returned by AllocateMirroredMemory().
+//
+//! \param[in] pvMemory_ The base of the region.
+//! \param[in] uiSize_ The size that was passed to AllocateMirroredMemory().
+//-----------------------------------------------------------------------
+void FreeMirroredMemory(void* pvMemory_, size_t uiSize_) noexcept;
+
+} // namespace novatel::edie
+
 //============================================================================
 //! \class FixedBuffer
 //! \brief A minimal, fixed-size linear buffer. Data is stored contiguously
@@ -44,6 +86,18 @@ constexpr uint32_t RECOMMENDED_FRAME_BUFFER_SIZE = 256 * 1024; // 256Kb
 //! unconsumed data is shifted back to the beginning before writing. A FixedBuffer
 //! of logical capacity N uses an underlying array of size 2*N to mitigate the
 //! worst-case impact of shifting.
+//!
+//! With the MIRRORED backend the underlying array is instead a single region of
+//! N elements mapped twice in a row. Consuming data only advances the head, which
+//! wraps back into the first mapping, and any N contiguous elements starting in
+//! the first mapping are always readable through data(). Writes therefore never
+//! shift data. If the platform cannot provide mirrored memory the buffer falls
+//! back to the LINEAR backend; see backend().
+//!
+//! A buffer can also be attached to read-only memory owned by the caller, such as
+//! a memory-mapped file. While attached, the buffer is a sliding window over that
+//! memory: writing the elements that directly follow the window only extends it,
+//! and nothing is copied.
 //! \tparam T The type of elements stored in the buffer. Must be trivially copyable.
 //============================================================================
 template <typename T> class FixedBuffer
@@ -51,27 +105,59 @@ template <typename T> class FixedBuffer
     static_assert(std::is_trivially_copyable_v<T>, "FixedBuffer requires a trivially copyable type T for memcpy usage");
 
   public:
-    FixedBuffer(size_t capacity = RECOMMENDED_FRAME_BUFFER_SIZE) // Default capacity of 256KB
-        : N(capacity), buffer(std::make_unique<T[]>(2 * capacity)), head(0), sz(0)
+    //! \brief Construct a buffer.
+    //! \param[in] capacity The logical capacity in elements. The MIRRORED backend rounds
+    //! this up to a whole number of pages.
+    //! \param[in] eBackend The memory layout to use.
+    FixedBuffer(size_t capacity = RECOMMENDED_FRAME_BUFFER_SIZE, // Default capacity of 256KB
+                FIXED_BUFFER_BACKEND eBackend = FIXED_BUFFER_BACKEND::LINEAR)
+        : N(capacity), head(0), sz(0)
     {
+        if (eBackend == FIXED_BUFFER_BACKEND::MIRRORED) { AllocateMirrored(); }
+        if (!buffer) { buffer = BufferPtr(new T[2 * N](), BufferDeleter{}); }
     }
+
     //! \brief A special value indicating "not found" in search operations.
     static constexpr size_t npos = static_cast<size_t>(-1);
 
-    //! \brief Accesses the element at the specified logical index (0 = oldest). Const version.
-    [[nodiscard]] const T& operator[](size_t i) const noexcept { return buffer[head + i]; }
-
     //! \brief Accesses the element at the specified logical index (0 = oldest).
-    [[nodiscard]] T& operator[](size_t i) noexcept { return buffer[head + i]; }
+    //! Elements are read-only, since the buffer may be attached to read-only memory; use write() to add them.
+    [[nodiscard]] const T& operator[](size_t i) const noexcept { return base()[head + i]; }
+
+    //! \brief Discards all elements and attaches the buffer to external memory.
+    //! \param[in] data_ptr The first element of the external memory. It must stay valid
+    //! and unchanged until detach() is called or the buffer is destroyed.
+    void attach(const T* data_ptr) noexcept
+    {
+        external = data_ptr;
+        head = 0;
+        sz = 0;
+    }
+
+    //! \brief Discards all elements and returns to the buffer's own storage.
+    void detach() noexcept { attach(nullptr); }
+
+    //! \brief Returns true if the buffer is attached to external memory.
+    [[nodiscard]] bool attached() const noexcept { return external != nullptr; }
 
     //! \brief Removes elements from the beginning (oldest elements).
+    //! Only the head moves: the removed elements stay in place and unchanged, and
+    //! pointers previously returned by data() keep reading them, until the next
+    //! write() or attach(). Framers rely on this to hand out batches of frames.
     void erase_begin(size_t count) noexcept
     {
         count = std::min(count, sz);
         if (count == 0) { return; }
 
         sz -= count;
-        head = sz == 0 ? 0 : head + count;
+        // An attached window only ever slides forward over the external memory
+        if (sz == 0 && !attached()) { head = 0; }
+        else
+        {
+            head += count;
+            // Both mappings alias the same memory, so the head can always be kept in the first one
+            if (!attached() && buffer.get_deleter().mirroredBytes != 0 && head >= N) { head -= N; }
+        }
     }
 
     //! \brief Copies data starting from the beginning (oldest element) to a destination buffer.
@@ -82,12 +168,14 @@ template <typename T> class FixedBuffer
         if (destination == nullptr || count == 0 || sz == 0) { return; }
 
         count = std::min(count, sz);
-        std::memcpy(destination, buffer.get() + head, count * sizeof(T));
+        std::memcpy(destination, base() + head, count * sizeof(T));
     }
 
     //! \brief Writes a block of data to the end of the buffer if space is available.
     //! When the write would exceed the buffer end, unconsumed data is first
     //! shifted back to the beginning using memmove.
+    //! While attached, only the elements directly following the current contents of
+    //! the external memory can be written, which extends the window without copying.
     //! \param[in] data_ptr Pointer to the source data buffer.
     //! \param[in] count The number of *elements* (of type T) to write.
     //! \return The number of elements written, or 0 if there is not enough total space.
@@ -95,7 +183,15 @@ template <typename T> class FixedBuffer
     {
         if (data_ptr == nullptr || count > available_space() || count == 0) { return 0; }
 
+        if (attached())
+        {
+            if (data_ptr != external + head + sz) { return 0; }
+            sz += count;
+            return count;
+        }
+
         // If the write would go past the end of the buffer, compact unconsumed data to the front.
+        // A mirrored buffer keeps head < N, so this never happens for it.
         if (head + sz + count > 2 * N)
         {
             // The available_space() check above guarantees that count <= N - sz, so sz + count <= N.
@@ -129,7 +225,7 @@ template <typename T> class FixedBuffer
         if (start >= sz) { return npos; }
         count = std::min(count, sz - start);
 
-        const unsigned char* data = buffer.get() + head;
+        const unsigned char* data = base() + head;
         const unsigned char* begin = data + start;
         const unsigned char* end = begin + count;
 
@@ -173,12 +269,12 @@ template <typename T> class FixedBuffer
 
         // Note: alignment requirement of U is not guaranteed, so we cannot simply cast to U
         U result;
-        std::memcpy(&result, buffer.get() + head + logical_index, sizeof(U));
+        std::memcpy(&result, base() + head + logical_index, sizeof(U));
         return result;
     }
 
     //! \brief Returns a pointer to the beginning of the valid data in the buffer.
-    [[nodiscard]] const T* data() const noexcept { return buffer.get() + head; }
+    [[nodiscard]] const T* data() const noexcept { return base() + head; }
     //! \brief Returns the number of elements currently in the buffer.
     [[nodiscard]] constexpr size_t size() const noexcept { return sz; }
     //! \brief Returns the maximum number of elements the buffer can hold.
@@ -189,10 +285,46 @@ template <typename T> class FixedBuffer
     [[nodiscard]] constexpr bool empty() const noexcept { return sz == 0; }
     //! \brief Returns true if the buffer is full.
     [[nodiscard]] constexpr bool full() const noexcept { return sz == N; }
+    //! \brief Returns the memory layout actually in use.
+    [[nodiscard]] FIXED_BUFFER_BACKEND backend() const noexcept
+    {
+        return buffer.get_deleter().mirroredBytes != 0 ? FIXED_BUFFER_BACKEND::MIRRORED : FIXED_BUFFER_BACKEND::LINEAR;
+    }
 
   private:
+    //! \brief Releases either a heap array or a mirrored mapping of mirroredBytes bytes.
+    struct BufferDeleter
+    {
+        size_t mirroredBytes{0};
+
+        void operator()(T* ptr) const noexcept
+        {
+            if (mirroredBytes != 0) { novatel::edie::FreeMirroredMemory(ptr, mirroredBytes); }
+            else { delete[] ptr; }
+        }
+    };
+    using BufferPtr = std::unique_ptr<T[], BufferDeleter>;
+
+    //! \brief The memory that head indexes into.
+    [[nodiscard]] const T* base() const noexcept { return external != nullptr ? external : buffer.get(); }
+
+    //! \brief Try to back the buffer with mirrored memory, rounding N up to whole pages.
+    void AllocateMirrored() noexcept
+    {
+        const size_t granularity = novatel::edie::GetMirroredMemoryGranularity();
+        if (granularity == 0 || granularity % sizeof(T) != 0 || N == 0) { return; }
+
+        const size_t bytes = (N * sizeof(T) + granularity - 1) / granularity * granularity;
+        if (void* memory = novatel::edie::AllocateMirroredMemory(bytes))
+        {
+            N = bytes / sizeof(T);
+            buffer = BufferPtr(static_cast<T*>(memory), BufferDeleter{bytes});
+        }
+    }
+
     size_t N;
-    std::unique_ptr<T[]> buffer;
+    BufferPtr buffer;
+    const T* external = nullptr;
     size_t head = 0;
     size_t sz = 0;
 };
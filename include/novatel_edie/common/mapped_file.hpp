@@ -0,0 +1,95 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file mapped_file.hpp
+// ===============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace novatel::edie {
+
+//============================================================================
+//! \class MappedFile
+//! \brief A read-only memory mapping of a whole file.
+//!
+//! The mapping is advised for sequential access so that the kernel reads ahead
+//! aggressively and drops pages behind the reader. Memory mapping is only
+//! supported on POSIX platforms; elsewhere Open() always fails.
+//============================================================================
+class MappedFile
+{
+  public:
+    MappedFile() = default;
+
+    //----------------------------------------------------------------------------
+    //! \brief Map a file. Check IsOpen() for the result.
+    //
+    //! \param[in] clPath_ The path of the file to map.
+    //----------------------------------------------------------------------------
+    explicit MappedFile(const std::filesystem::path& clPath_) { static_cast<void>(Open(clPath_)); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() { Close(); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Map a file, unmapping any file mapped previously.
+    //
+    //! \param[in] clPath_ The path of the file to map.
+    //
+    //! \return true if the file was mapped. Empty files and platforms without
+    //! memory mapping support cannot be mapped.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool Open(const std::filesystem::path& clPath_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Unmap the file. Pointers returned by Data() become invalid.
+    //----------------------------------------------------------------------------
+    void Close() noexcept;
+
+    //----------------------------------------------------------------------------
+    //! \return true if a file is mapped.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool IsOpen() const noexcept { return pucMyData != nullptr; }
+
+    //----------------------------------------------------------------------------
+    //! \return The first byte of the mapped file, or nullptr if none is mapped.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const unsigned char* Data() const noexcept { return pucMyData; }
+
+    //----------------------------------------------------------------------------
+    //! \return The size of the mapped file in bytes.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] uint64_t Size() const noexcept { return ullMySize; }
+
+  private:
+    const unsigned char* pucMyData{nullptr};
+    uint64_t ullMySize{0};
+};
+
+} // namespace novatel::edie
@@ -0,0 +1,128 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file binary_db.hpp
+// ===============================================================================
+
+#ifndef BINARY_DB_HPP
+#define BINARY_DB_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <sstream>
+#include <vector>
+
+#include "novatel_edie/decoders/common/message_database.hpp"
+
+namespace novatel::edie {
+
+//============================================================================
+//! \class BinaryDbFailure
+//! \brief Exception to be thrown when a binary database cannot be written or
+//! read.
+//============================================================================
+class BinaryDbFailure : public std::exception
+{
+  private:
+    std::string whatString;
+
+  public:
+    BinaryDbFailure(const char* func_, const char* file_, const int32_t line_, const std::filesystem::path& source_, const char* failure_)
+    {
+        std::ostringstream oss;
+        oss << "In file \"" << file_ << "\" : " << func_ << "() (Line " << line_ << ")\n\t\"" << source_.generic_string() << ": " << failure_
+            << ".\"";
+        whatString = oss.str();
+    }
+
+    [[nodiscard]] const char* what() const noexcept override { return whatString.c_str(); }
+};
+
+//----------------------------------------------------------------------------
+//! \brief Compile a message database into a binary image.
+//
+//! The image is a flat table of fixed-size enum, message and field records
+//! that refer to each other and to a shared string table by offset, so it can
+//! be memory-mapped anywhere. The cached members of the field definitions,
+//! such as the offsets, the alignment and the parsed conversion strings, are
+//! stored as well, so loading the image does not parse any text. Images use
+//! the byte order of the machine that wrote them.
+//
+//! \param[in] clMessageDb_ The message database to compile.
+//
+//! \return The binary image. Compiling a database loaded from an image
+//! reproduces that image byte for byte.
+//----------------------------------------------------------------------------
+std::vector<unsigned char> SerializeBinaryDb(const MessageDatabase& clMessageDb_);
+
+//----------------------------------------------------------------------------
+//! \brief Compile a message database into a binary database file.
+//
+//! \param[in] clMessageDb_ The message database to compile.
+//! \param[in] filePath_ The path of the file to write.
+//----------------------------------------------------------------------------
+void WriteBinaryDbFile(const MessageDatabase& clMessageDb_, const std::filesystem::path& filePath_);
+
+//----------------------------------------------------------------------------
+//! \brief Check whether a buffer starts like a binary database image.
+//
+//! \param[in] pucData_ The start of the buffer.
+//! \param[in] ullSize_ The size of the buffer in bytes.
+//----------------------------------------------------------------------------
+[[nodiscard]] bool IsBinaryDb(const unsigned char* pucData_, uint64_t ullSize_);
+
+//----------------------------------------------------------------------------
+//! \brief Load a database from a binary image in memory.
+//
+//! The image is validated and may be released once this function returns.
+//
+//! \param[in] pucData_ The start of the image. No alignment is required.
+//! \param[in] ullSize_ The size of the image in bytes.
+//
+//! \return A shared pointer to the loaded MessageDatabase.
+//----------------------------------------------------------------------------
+MessageDatabase::Ptr ParseBinaryDb(const unsigned char* pucData_, uint64_t ullSize_);
+
+//----------------------------------------------------------------------------
+//! \brief Load a database from a binary database file.
+//
+//! The file is memory-mapped where supported and read into memory otherwise.
+//
+//! \param[in] filePath_ The path of the binary database file.
+//
+//! \return A shared pointer to the loaded MessageDatabase.
+//----------------------------------------------------------------------------
+MessageDatabase::Ptr LoadBinaryDbFile(const std::filesystem::path& filePath_);
+
+//----------------------------------------------------------------------------
+//! \brief Load a database from a binary or a JSON database file, depending on
+//! the contents of the file.
+//
+//! \param[in] filePath_ The path of the database file.
+//
+//! \return A shared pointer to the loaded MessageDatabase.
+//----------------------------------------------------------------------------
+MessageDatabase::Ptr LoadDbFile(const std::filesystem::path& filePath_);
+
+} // namespace novatel::edie
+
+#endif
@@ -0,0 +1,113 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file decode_plan.hpp
+// ===============================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <simdjson.h>
+
+#include "novatel_edie/decoders/common/message_database.hpp"
+
+namespace novatel::edie {
+
+class CompositeField;
+
+//! Converts the ASCII token of a field, or of one element of an array field, into a CompositeField.
+using AsciiFieldConverter = void (*)(CompositeField&, const BaseField&, const char**, size_t, size_t, bool, MessageDatabase&);
+//! Converts the JSON value of a field, or of one element of an array field, into a CompositeField.
+using JsonFieldConverter = void (*)(CompositeField&, const BaseField&, simdjson::dom::element, size_t, bool, MessageDatabase&);
+
+//-----------------------------------------------------------------------
+//! \struct DecodeOp
+//! \brief A single step of a DecodePlan.
+//!
+//! An op decodes one field. The field definition is pre-resolved to its
+//! concrete type so that decoding does not need RTTI.
+//-----------------------------------------------------------------------
+struct DecodeOp
+{
+    const BaseField* field{nullptr};
+    const EnumField* enumField{nullptr};             // set for ENUM fields
+    const ArrayField* arrayField{nullptr};           // set for array, string and field array fields
+    const FieldArrayField* fieldArrayField{nullptr}; // set for FIELD_ARRAY fields
+    std::shared_ptr<const DecodePlan> subPlan;       // set for FIELD_ARRAY fields; the plan of one element
+    FIELD_TYPE type{FIELD_TYPE::UNKNOWN};
+    uint16_t typeLength{0};                      // length in bytes of one element in a binary message
+    uint32_t arrayLength{0};                     // number of elements of a fixed length array, maximum number of elements otherwise
+    uint32_t copyBytes{0};                       // bytes copied to the fixed fields by a binary decode, 0 if the field is not a plain copy
+    uint32_t runBytes{0};                        // bytes of the run of contiguous plain copies starting at this op
+    uint32_t runOps{0};                          // number of ops in that run
+    AsciiFieldConverter asciiConverter{nullptr}; // set when a decoder binds the plan, nullptr if there is none
+    JsonFieldConverter jsonConverter{nullptr};   // set when a decoder binds the plan, nullptr if there is none
+    bool zConversion{false};                     // conversion string is %Z
+    bool pConversion{false};                     // conversion string is %P
+    bool flatArray{false};                       // FIELD_ARRAY whose elements have no variable fields
+    bool skip{false};                            // field is left out of a projection of the plan, see ProjectDecodePlan
+};
+
+//-----------------------------------------------------------------------
+//! \struct DecodePlan
+//! \brief The fields of a FieldInfo compiled into a flat list of ops.
+//!
+//! Plain copies into the fixed fields are grouped into runs. When a binary
+//! message is not aligned, a run can be decoded with a single copy. A plan
+//! shares the plans of its FIELD_ARRAY elements, so it stays valid when the
+//! caches of their FieldInfos are invalidated. A compiled plan has no
+//! converters; a decoder binds a copy of it to its own converters.
+//-----------------------------------------------------------------------
+struct DecodePlan
+{
+    std::vector<DecodeOp> ops;
+
+    using ConstPtr = std::shared_ptr<const DecodePlan>;
+};
+
+//----------------------------------------------------------------------------
+//! \brief Compile the fields of a FieldInfo into a decode plan.
+//
+//! \param[in] fieldInfo_ The FieldInfo to compile.
+//! \return The decode plan.
+//----------------------------------------------------------------------------
+DecodePlan::ConstPtr CompileDecodePlan(const FieldInfo& fieldInfo_);
+
+//----------------------------------------------------------------------------
+//! \brief Project a decode plan onto some of its fields.
+//
+//! The ops of the fields that are not named are marked to be skipped. Fields
+//! that give the length of an array by arrayLengthRef are always kept, as are
+//! FIELD_ARRAYs whose records do, since they cannot be skipped unread.
+//
+//! \param[in] stPlan_ The plan of all fields of a message.
+//! \param[in] vFieldNames_ The names of the top-level fields to decode.
+//! \return The projected plan.
+//----------------------------------------------------------------------------
+DecodePlan::ConstPtr ProjectDecodePlan(const DecodePlan& stPlan_, const std::vector<std::string>& vFieldNames_);
+
+} // namespace novatel::edie
@@ -382,13 +382,15 @@ template <typename Derived> class EncoderBase
                             maxBytes = fieldArrayFieldDef->fieldSize;
                             count = fieldVector.size();
                         }
-                        else if constexpr (std::is_same_v<ValueType, std::string> || is_specialization_of_v<ValueType, std::vector>)
+                        else if constexpr (std::is_same_v<ValueType, std::string> || is_specialization_of_v<ValueType, std::vector> ||
+                                           is_specialization_of_v<ValueType, TypedBuffer>)
                         {
                             maxBytes = arrayFieldDef->arrayLength * fieldDef->dataType.length;
                             count = fieldVector.size();
                         }
 
-                        if constexpr (is_specialization_of_v<ValueType, std::vector> || std::is_same_v<ValueType, FlatFieldArray>)
+                        if constexpr (is_specialization_of_v<ValueType, std::vector> || is_specialization_of_v<ValueType, TypedBuffer> ||
+                                      std::is_same_v<ValueType, FlatFieldArray>)
                         {
                             // Write array length
                             if (arrayFieldDef->arrayLengthRef.empty())
@@ -824,8 +826,7 @@ template <typename Derived> class EncoderBase
             }
             case FIELD_TYPE::RESPONSE_STR: [[fallthrough]];
             case FIELD_TYPE::STRING: {
-                const auto value = clCompField_.GetVarFields()[fieldDefRef.index];
-                const auto& str = std::get<std::string>(value);
+                const auto& str = std::get<std::string>(clCompField_.GetVarFields()[fieldDefRef.index]);
                 if (!CopyAllToBuffer(ppcOutBuf_, uiBytesLeft_, '"', std::string_view(fieldDefRef.name), R"(": ")", str, "\",")) { return false; }
                 break;
             }
@@ -27,10 +27,11 @@
 #pragma once
 
 #include <filesystem>
-#include <iosfwd>
+#include <fstream>
 #include <memory>
 
 #include "novatel_edie/common/logger.hpp"
+#include "novatel_edie/common/mapped_file.hpp"
 #include "novatel_edie/decoders/common/common.hpp"
 #include "novatel_edie/decoders/common/message_database.hpp"
 #include "novatel_edie/decoders/common/message_decoder.hpp"
@@ -51,9 +52,29 @@ template <typename ParserT, typename FilterT, typename MetaDataT, typename Inter
     std::shared_ptr<spdlog::logger> pclMyLogger;
     ParserT clMyParser;
     std::shared_ptr<std::istream> pclMyInputStream{nullptr};
+    std::unique_ptr<MappedFile> pclMyMappedFile{nullptr};
+    uint64_t ullMyMappedOffset{0};
+
+    //! \brief Detach the parser from the mapped file, if any, before unmapping it.
+    void CloseMappedFile()
+    {
+        if (pclMyMappedFile == nullptr) { return; }
+        clMyParser.DetachInput();
+        pclMyMappedFile = nullptr;
+        ullMyMappedOffset = 0;
+    }
 
     [[nodiscard]] bool ReadStream()
     {
+        if (pclMyMappedFile != nullptr)
+        {
+            // The parser is attached to the mapping, so writing the next mapped bytes only extends its window
+            const auto uiBytes = static_cast<size_t>(std::min<uint64_t>(clMyParser.GetAvailableSpace(), pclMyMappedFile->Size() - ullMyMappedOffset));
+            const size_t uiBytesWritten = uiBytes > 0 ? clMyParser.Write(pclMyMappedFile->Data() + ullMyMappedOffset, uiBytes) : 0;
+            ullMyMappedOffset += uiBytesWritten;
+            return uiBytesWritten > 0;
+        }
+
         std::array<char, MAX_ASCII_MESSAGE_LENGTH> cData{};
         pclMyInputStream->read(cData.data(), std::min(cData.size(), clMyParser.GetAvailableSpace()));
         size_t ullBytesRead = pclMyInputStream->gcount();
@@ -239,11 +260,47 @@ template <typename ParserT, typename FilterT, typename MetaDataT, typename Inter
     [[nodiscard]] bool SetStream(std::shared_ptr<std::istream> pclInputStream_)
     {
         if (pclInputStream_ == nullptr || pclInputStream_->eof()) { return false; }
+        CloseMappedFile();
         pclMyInputStream = pclInputStream_;
         Reset();
         return true;
     }
 
+    //----------------------------------------------------------------------------
+    //! \brief Set the file for the FileParserBase to read.
+    //
+    //! \details Where supported, the file is memory-mapped and framed in place,
+    //! so no bytes are copied before decoding. Otherwise, or if the file cannot
+    //! be mapped, it is read through an input stream as with SetStream(). Use
+    //! SetStream() for pipes and sockets.
+    //
+    //! \param[in] clFilePath_ The path of the file to read.
+    //
+    //! \return A boolean describing if the operation was successful.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool SetFile(const std::filesystem::path& clFilePath_)
+    {
+        auto pclMappedFile = std::make_unique<MappedFile>();
+        if (!pclMappedFile->Open(clFilePath_))
+        {
+            auto pclInputStream = std::make_shared<std::ifstream>(clFilePath_, std::ios::binary);
+            return pclInputStream->is_open() && SetStream(std::move(pclInputStream));
+        }
+
+        CloseMappedFile();
+        pclMyInputStream = nullptr;
+        pclMyMappedFile = std::move(pclMappedFile);
+        Reset();
+        return true;
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Check if the file being read is memory-mapped.
+    //
+    //! \return true if the input was set with SetFile() and the file was mapped.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool IsFileMapped() const { return pclMyMappedFile != nullptr; }
+
     //----------------------------------------------------------------------------
     //! \brief Read a log from the FileParser.
     //
@@ -309,6 +366,11 @@ template <typename ParserT, typename FilterT, typename MetaDataT, typename Inter
             pclMyInputStream->clear();
             pclMyInputStream->seekg(0, std::ios::beg);
         }
+        if (pclMyMappedFile != nullptr)
+        {
+            clMyParser.AttachInput(pclMyMappedFile->Data());
+            ullMyMappedOffset = 0;
+        }
         return true;
     }
 
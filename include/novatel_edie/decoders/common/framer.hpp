@@ -32,6 +32,32 @@
 
 namespace novatel::edie {
 
+//============================================================================
+//! \struct FrameView
+//! \brief A non-owning view of a frame inside a framer's internal buffer.
+//============================================================================
+struct FrameView
+{
+    const unsigned char* pucData{nullptr};
+    uint32_t uiLength{0U};
+
+    [[nodiscard]] const unsigned char* data() const { return pucData; }
+    [[nodiscard]] uint32_t size() const { return uiLength; }
+    [[nodiscard]] bool empty() const { return uiLength == 0; }
+};
+
+//============================================================================
+//! \struct FrameDescriptor
+//! \brief The location and result of one frame found by a batch GetFrames() call.
+//============================================================================
+struct FrameDescriptor
+{
+    uint32_t uiOffset{0U};                         //!< Offset of the first byte from the start of the batch.
+    uint32_t uiLength{0U};                         //!< Length of the frame in bytes.
+    HEADER_FORMAT eFormat{HEADER_FORMAT::UNKNOWN}; //!< Format of the frame.
+    STATUS eStatus{STATUS::UNKNOWN};               //!< SUCCESS for a frame, UNKNOWN for bytes that belong to no frame.
+};
+
 //============================================================================
 //! \class FramerBase
 //! \brief Base class for all framers. Contains necessary buffers and member
@@ -75,6 +101,7 @@ class FramerBase
     uint32_t uiMyByteCount{0U};
     uint32_t uiMyExpectedPayloadLength{0U};
     uint32_t uiMyExpectedMessageLength{0U};
+    uint32_t uiMyFrameViewLength{0U};
 
     bool bMyReportUnknownBytes{true};
     bool bMyPayloadOnly{false};
@@ -170,19 +197,81 @@ class FramerBase
         if (bMyReportUnknownBytes && pucBuffer_ != nullptr) { pclMyBuffer->copy_out(pucBuffer_, count_); }
 
         pclMyBuffer->erase_begin(count_);
+        uiMyFrameViewLength = 0;
+        InitAttributes();
+        ResetState();
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get a frame from the internal circular buffer without copying it.
+    //
+    //! \param [out] stFrameView_ A view of the frame or unknown bytes at the front
+    //! of the internal buffer. The view stays valid until the next call to Write,
+    //! GetFrame, GetFrameView, Consume or Flush.
+    //! \param [out] stMetaData_ A MetaDataBase to contain some information
+    //! about the message frame.
+    //! \param [in] uiMaxFrameLength_ The largest frame the view may span.
+    //
+    //! \return The same error codes as GetFrame(). The view is only populated for
+    //! SUCCESS and UNKNOWN, and the bytes it spans remain in the internal buffer
+    //! until Consume() is called. Calling GetFrameView() again without consuming
+    //! returns the same frame. Payload-only mode does not apply to views.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS GetFrameView(FrameView& stFrameView_, MetaDataBase& stMetaData_, uint32_t uiMaxFrameLength_ = MESSAGE_SIZE_MAX);
+
+    //----------------------------------------------------------------------------
+    //! \brief Discard the bytes spanned by the last view returned from GetFrameView().
+    //----------------------------------------------------------------------------
+    void Consume()
+    {
+        if (uiMyFrameViewLength == 0) { return; }
+
+        pclMyBuffer->erase_begin(uiMyFrameViewLength);
+        uiMyFrameViewLength = 0;
         InitAttributes();
         ResetState();
     }
 
+    //----------------------------------------------------------------------------
+    //! \brief Frame as much of the internal buffer as possible in one call.
+    //
+    //! \param [out] pstFrames_ An array to receive one descriptor per frame or run
+    //! of unknown bytes, in stream order.
+    //! \param [in] uiMaxFrames_ The number of elements in pstFrames_.
+    //! \param [out] pucFrameData_ The start of the batch. Each descriptor spans
+    //! pucFrameData_ + uiOffset.
+    //! \param [out] stMetaData_ A MetaDataBase holding the metadata of the last
+    //! descriptor.
+    //! \param [in] uiMaxFrameLength_ The largest frame a descriptor may span.
+    //
+    //! \return The number of descriptors filled in. The bytes they span are removed
+    //! from the internal buffer. Framing stops early at the first frame that is
+    //! incomplete or longer than uiMaxFrameLength_, which GetFrame() will report.
+    //! Payload-only mode does not apply to batches.
+    //
+    //! \note Removing bytes from the internal buffer leaves them in place (see
+    //! UCharFixedBuffer::erase_begin()), so the batch stays valid across further
+    //! calls to GetFrames, GetFrame, GetFrameView, Consume and Flush. It is
+    //! invalidated by the next call to Write, Attach or Detach, and by any other
+    //! write to the internal buffer. A batch framed from attached memory stays
+    //! valid as long as that memory does.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] size_t GetFrames(FrameDescriptor* pstFrames_, size_t uiMaxFrames_, const unsigned char*& pucFrameData_,
+                                   MetaDataBase& stMetaData_, uint32_t uiMaxFrameLength_ = MESSAGE_SIZE_MAX);
+
     uint32_t GetMyByteCount() { return uiMyByteCount; };
 
     //----------------------------------------------------------------------------
     //! \brief A constructor for the FramerBase class.
     //
     //! \param[in] strLoggerName_ String to name the internal logger.
+    //! \param[in] bufferSize_ Capacity of the internal fixed buffer.
+    //! \param[in] eBufferBackend_ Memory layout of the internal fixed buffer.
     //----------------------------------------------------------------------------
-    FramerBase(const std::string& strLoggerName_, const size_t bufferSize_ = RECOMMENDED_FRAME_BUFFER_SIZE)
-        : pclMyLogger(GetBaseLoggerManager()->RegisterLogger(strLoggerName_)), pclMyBuffer(std::make_shared<UCharFixedBuffer>(bufferSize_))
+    FramerBase(const std::string& strLoggerName_, const size_t bufferSize_ = RECOMMENDED_FRAME_BUFFER_SIZE,
+               const FIXED_BUFFER_BACKEND eBufferBackend_ = FIXED_BUFFER_BACKEND::LINEAR)
+        : pclMyLogger(GetBaseLoggerManager()->RegisterLogger(strLoggerName_)),
+          pclMyBuffer(std::make_shared<UCharFixedBuffer>(bufferSize_, eBufferBackend_))
     {
         pclMyLogger->debug("FramerBase initialized");
     }
@@ -255,6 +344,31 @@ class FramerBase
     //----------------------------------------------------------------------------
     [[nodiscard]] size_t Write(const unsigned char* pucDataBuffer_, size_t uiDataBytes_) { return pclMyBuffer->write(pucDataBuffer_, uiDataBytes_); }
 
+    //----------------------------------------------------------------------------
+    //! \brief Frame bytes in place from memory owned by the caller, such as a
+    //! memory-mapped file, instead of copying them into the internal buffer.
+    //
+    //! \details Any buffered bytes are discarded. Afterwards, Write() only accepts
+    //! the bytes that directly follow those already written, starting at
+    //! pucData_, and adds them to the buffer without copying.
+    //
+    //! \param[in] pucData_ The first byte of the memory. It must stay valid and
+    //! unchanged until Detach() is called.
+    //----------------------------------------------------------------------------
+    void Attach(const unsigned char* pucData_)
+    {
+        pclMyBuffer->attach(pucData_);
+        uiMyFrameViewLength = 0;
+        InitAttributes();
+        ResetState();
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Discard any buffered bytes and return to copying written bytes into
+    //! the internal buffer.
+    //----------------------------------------------------------------------------
+    void Detach() { Attach(nullptr); }
+
     //----------------------------------------------------------------------------
     //! \brief Flush bytes from the internal circular buffer.
     //
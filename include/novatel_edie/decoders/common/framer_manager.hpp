@@ -28,13 +28,16 @@
 #define FRAMER_MANAGER_HPP
 
 #include <algorithm>
+#include <array>
 #include <deque>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "novatel_edie/common/byte_scanner.hpp"
 #include "novatel_edie/common/crc.hpp"
 #include "novatel_edie/common/fixed_buffer.hpp"
 #include "novatel_edie/common/logger.hpp"
@@ -49,6 +52,11 @@ struct FramerEntry
     uint32_t framerId;
     std::unique_ptr<FramerBase> framerInstance;
     std::unique_ptr<MetaDataBase> metadataInstance;
+    uint64_t dispatchBit{0}; //!< The bit representing this framer in the FramerManager's dispatch table.
+    //! The number of buffered bytes the framer had scanned when it last reported an incomplete frame, or zero if it
+    //! has no frame in progress. Until more bytes are written the framer would only repeat itself, so it is not polled.
+    size_t uiScanCursor{0};
+    uint32_t uiScanFrameBufferSize{0}; //!< The frame buffer size the framer reported its incomplete frame against.
 
     FramerEntry(std::string framerName_, uint32_t framerId_, std::unique_ptr<FramerBase> framerInstance_,
                 std::unique_ptr<MetaDataBase> metadataInstance_)
@@ -57,6 +65,14 @@ struct FramerEntry
     }
 };
 
+//! \brief The factories and sync signature a framer type was registered with.
+struct FramerRegistration
+{
+    std::function<std::unique_ptr<FramerBase>(std::shared_ptr<UCharFixedBuffer>)> framerFactory;
+    std::function<std::unique_ptr<MetaDataBase>()> metadataConstructor;
+    std::vector<unsigned char> syncBytes; //!< Bytes a frame may start with. Empty if a frame may start with any byte.
+};
+
 //================================================================================
 //! \class FramerManager
 //! \brief Provides an interface to operate multiple framers on the same data buffer.
@@ -74,10 +90,13 @@ class FramerManager
     //!
     //! \param[in] selectedFramers A list of framer names to initialize. Each name
     //! must match a framer that has been registered via RegisterFramer().
+    //! \param[in] eBufferBackend_ Memory layout of the fixed buffer shared by
+    //! all framers.
     //!
     //! \sa RegisterFramer()
     //----------------------------------------------------------------------------
-    explicit FramerManager(const std::vector<std::string>& selectedFramers = {});
+    explicit FramerManager(const std::vector<std::string>& selectedFramers = {},
+                           FIXED_BUFFER_BACKEND eBufferBackend_ = FIXED_BUFFER_BACKEND::LINEAR);
 
     //----------------------------------------------------------------------------
     //! \brief Add a framer type to the internal registry.
@@ -86,10 +105,13 @@ class FramerManager
     //! \param[in] framerFactory_ A factory function that creates instances of the framer type.
     //! \param[in] metadataConstructor_ A factory function that creates instances of the
     //! metadata for the specified framer type.
+    //! \param[in] syncBytes_ The bytes a frame of this type may start with. The
+    //! framer is only consulted when the buffered data starts with one of them.
+    //! Leave empty to consult the framer regardless of the first byte.
     //----------------------------------------------------------------------------
     static void RegisterFramer(const std::string& framerName_,
                                std::function<std::unique_ptr<FramerBase>(std::shared_ptr<UCharFixedBuffer>)> framerFactory_,
-                               std::function<std::unique_ptr<MetaDataBase>()> metadataConstructor_);
+                               std::function<std::unique_ptr<MetaDataBase>()> metadataConstructor_, std::vector<unsigned char> syncBytes_ = {});
 
     //----------------------------------------------------------------------------
     //! \brief Get the MetaData for a specific framer.
@@ -103,7 +125,7 @@ class FramerManager
     //----------------------------------------------------------------------------
     //! \brief Reset the state of all framers in the framer registry.
     //----------------------------------------------------------------------------
-    void ResetAllFramerStates() const;
+    void ResetAllFramerStates();
 
     //----------------------------------------------------------------------------
     //! \brief Configure the framer manager to return unknown bytes in the provided
@@ -113,6 +135,21 @@ class FramerManager
     //----------------------------------------------------------------------------
     void SetReportUnknownBytes(const bool bReportUnknownBytes_) { bMyReportUnknownBytes = bReportUnknownBytes_; }
 
+    //----------------------------------------------------------------------------
+    //! \brief Configure the framer manager to skip straight to the next frame when
+    //! the buffered data does not start with one.
+    //
+    //! \details By default, unknown data is returned in chunks that end wherever
+    //! any framer finds a candidate sync byte. When skipping ahead, the framers
+    //! resynchronize across every candidate that turns out not to start a frame,
+    //! and the whole run of unknown bytes is returned as a single UNKNOWN chunk of
+    //! at most the provided frame buffer size. An UNKNOWN view or batch entry is
+    //! removed from the internal buffer as soon as it is returned.
+    //
+    //! \param[in] bSkipAheadResync_ Set to true to skip ahead.
+    //----------------------------------------------------------------------------
+    void SetSkipAheadResync(const bool bSkipAheadResync_) { bMySkipAheadResync = bSkipAheadResync_; }
+
     //----------------------------------------------------------------------------
     //! \brief Get the internal fixed buffer.
     //
@@ -212,17 +249,62 @@ class FramerManager
     //----------------------------------------------------------------------------
     [[nodiscard]] STATUS GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, MetaDataBase*& stMetaData_);
 
+    //----------------------------------------------------------------------------
+    //! \brief Attempt to discover a frame in the internal circular buffer without
+    //! copying it out.
+    //
+    //! \param[out] stFrameView_ A view of the frame or unknown bytes at the front of
+    //! the internal buffer. The view stays valid until the next call to Write,
+    //! GetFrame, GetFrameView, Consume or Flush.
+    //! \param[out] stMetaData_ The metadata of the framer that found the frame.
+    //! \param[in] uiMaxFrameLength_ The largest frame the view may span.
+    //
+    //! \return The status of the frame discovery. The view is only populated for
+    //! SUCCESS and UNKNOWN, and its bytes remain buffered until Consume() is called.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS GetFrameView(FrameView& stFrameView_, MetaDataBase*& stMetaData_, uint32_t uiMaxFrameLength_ = MESSAGE_SIZE_MAX);
+
+    //----------------------------------------------------------------------------
+    //! \brief Discard the bytes spanned by the last view returned from GetFrameView().
+    //----------------------------------------------------------------------------
+    void Consume();
+
+    //----------------------------------------------------------------------------
+    //! \brief Frame as much of the internal buffer as possible in one call.
+    //
+    //! \param[out] pstFrames_ An array to receive one descriptor per frame or run
+    //! of unknown bytes, in stream order.
+    //! \param[in] uiMaxFrames_ The number of elements in pstFrames_.
+    //! \param[out] pucFrameData_ The start of the batch. Each descriptor spans
+    //! pucFrameData_ + uiOffset.
+    //! \param[in] uiMaxFrameLength_ The largest frame a descriptor may span.
+    //
+    //! \return The number of descriptors filled in. The bytes they span are removed
+    //! from the internal buffer. Framing stops early at the first frame that is
+    //! incomplete or longer than uiMaxFrameLength_, which GetFrame() will report.
+    //
+    //! \note Removing bytes from the internal buffer leaves them in place (see
+    //! UCharFixedBuffer::erase_begin()), so the batch stays valid across further
+    //! calls to GetFrames, GetFrame, GetFrameView, Consume, Flush and ResetAllFramerStates.
+    //! It is invalidated by the next call to Write, by any write to the buffer
+    //! returned from GetFixedBuffer(), and by destroying the FramerManager.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] size_t GetFrames(FrameDescriptor* pstFrames_, size_t uiMaxFrames_, const unsigned char*& pucFrameData_,
+                                   uint32_t uiMaxFrameLength_ = MESSAGE_SIZE_MAX);
+
     //----------------------------------------------------------------------------
     //! \brief Get the registered framer factories.
     //
-    //! \return A map from framer names to their associated factory functions.
+    //! \return A map from framer IDs to their associated factory functions and sync signatures.
     //----------------------------------------------------------------------------
-    static auto GetFramerFactories()
-        -> std::unordered_map<std::uint32_t, std::pair<std::function<std::unique_ptr<FramerBase>(std::shared_ptr<UCharFixedBuffer>)>,
-                                                       std::function<std::unique_ptr<MetaDataBase>()>>>&;
+    static std::unordered_map<std::uint32_t, FramerRegistration>& GetFramerFactories();
+
+    //! The maximum number of framers a FramerManager can operate, limited by the width of its dispatch table entries.
+    static constexpr size_t MAX_FRAMERS = 64;
 
   protected:
     bool bMyReportUnknownBytes{true};
+    bool bMySkipAheadResync{false};
 
   private:
     //! NOTE: disable copies and moves.
@@ -232,11 +314,47 @@ class FramerManager
     FramerManager& operator=(const FramerManager&&) = delete;
 
     MetaDataBase stMyMetaData;
+    uint32_t uiMyFrameViewLength{0U};
 
     std::shared_ptr<spdlog::logger> pclMyLogger;
     std::shared_ptr<UCharFixedBuffer> pclMyFixedBuffer;
 
-    void HandleUnknownBytes(unsigned char* pucBuffer_, size_t uiUnknownBytes_) const;
+    //! For every possible first byte, the mask of framers whose frames may start with it.
+    std::array<uint64_t, 256> aullMyDispatchTable{};
+    //! The bytes any framer's frames may start with, or std::nullopt if they are too many to scan for.
+    std::optional<ByteScanner> clMySyncScanner{std::in_place};
+    //! The mask of framers consulted since their states were last reset.
+    uint64_t ullMyConsultedFramers{0U};
+
+    void HandleUnknownBytes(unsigned char* pucBuffer_, size_t uiUnknownBytes_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Remove the run of unknown bytes at the front of the internal buffer.
+    //
+    //! \param[in] uiMaxLength_ The most bytes to remove.
+    //! \param[in,out] stMetaData_ The UNKNOWN metadata from FindFrame(), replaced
+    //! with metadata spanning every removed byte. The removed bytes stay readable
+    //! behind the previous start of the buffer until the next Write.
+    //! \param[out] pucUnknownBytes_ If not null, receives a copy of the removed
+    //! bytes, copied before they are removed. It must hold uiMaxLength_ bytes.
+    //----------------------------------------------------------------------------
+    void SkipUnknownBytes(uint32_t uiMaxLength_, MetaDataBase*& stMetaData_, unsigned char* pucUnknownBytes_ = nullptr);
+
+    //----------------------------------------------------------------------------
+    //! \brief Reset the state and scan cursors of the framers consulted since the
+    //! last reset. The other framers have not looked at the buffered data, so their
+    //! state is clean.
+    //----------------------------------------------------------------------------
+    void ResetConsultedFramerStates();
+
+    //----------------------------------------------------------------------------
+    //! \brief Poll the registered framers for the frame at the front of the internal
+    //! buffer without removing any bytes. Only framers whose sync signature matches
+    //! the first byte are consulted, unless none of them recognizes a frame. A framer
+    //! that reported an incomplete frame is not consulted again until more bytes
+    //! have been written.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS FindFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, MetaDataBase*& stMetaData_);
 
     std::vector<FramerEntry> framerRegistry;
 };
@@ -33,8 +33,10 @@
 
 using namespace novatel::edie;
 
-// Macro to register a framer with the FramerManager's factory
-#define REGISTER_FRAMER(FramerName, FramerClass, MetaDataClass)                                                                                      \
+// Macro to register a framer with the FramerManager's factory. The optional trailing arguments are the bytes a frame
+// may start with, which the FramerManager uses to decide which framers to consult. Without them the framer is always
+// consulted.
+#define REGISTER_FRAMER(FramerName, FramerClass, MetaDataClass, ...)                                                                                 \
     namespace {                                                                                                                                      \
     struct FramerName##_Registrar                                                                                                                    \
     {                                                                                                                                                \
@@ -48,7 +50,8 @@ using namespace novatel::edie;
             [](std::shared_ptr<novatel::edie::UCharFixedBuffer> buffer) -> std::unique_ptr<novatel::edie::FramerBase> {                              \
                 return std::make_unique<FramerClass>(buffer);                                                                                        \
             },                                                                                                                                       \
-            []() -> std::unique_ptr<novatel::edie::MetaDataBase> { return std::make_unique<MetaDataClass>(); });                                     \
+            []() -> std::unique_ptr<novatel::edie::MetaDataBase> { return std::make_unique<MetaDataClass>(); },                                      \
+            std::vector<unsigned char>{__VA_ARGS__});                                                                                                \
     }                                                                                                                                                \
     }
 
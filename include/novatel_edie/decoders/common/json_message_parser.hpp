@@ -0,0 +1,86 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file json_message_parser.hpp
+// ===============================================================================
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include <simdjson.h>
+
+namespace novatel::edie {
+
+//============================================================================
+//! \class JsonMessageParser
+//! \brief A reusable parser for JSON messages.
+//!
+//! The parser keeps its input and document buffers between messages, so that
+//! parsing only allocates when a message is larger than any before it. A header
+//! decoder can share a parsed document with the message decoder that decodes
+//! the same frame next, so that each JSON message is only parsed once.
+//!
+//! A document stays valid until the next call to Parse(). The parser is not
+//! thread-safe.
+//============================================================================
+class JsonMessageParser
+{
+  public:
+    using Ptr = std::shared_ptr<JsonMessageParser>;
+
+    //----------------------------------------------------------------------------
+    //! \brief Parse a JSON message.
+    //
+    //! \param[in] svMessage_ The JSON message.
+    //! \param[out] clRoot_ The root element of the parsed document.
+    //! \param[in] bShare_ Keep the document for a single TakeShared() call on
+    //! the same message.
+    //
+    //! \return The simdjson error code of the parse.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] simdjson::error_code Parse(std::string_view svMessage_, simdjson::dom::element& clRoot_, bool bShare_ = false);
+
+    //----------------------------------------------------------------------------
+    //! \brief Take the document shared by the last Parse() call.
+    //
+    //! \param[in] svMessage_ The JSON message. It must span the same memory that
+    //! was passed to Parse().
+    //! \param[out] clRoot_ The root element of the shared document.
+    //
+    //! \return true if a document of svMessage_ was shared. It cannot be taken
+    //! again.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool TakeShared(std::string_view svMessage_, simdjson::dom::element& clRoot_);
+
+  private:
+    simdjson::dom::parser clMyParser;
+    std::vector<char> vMyPaddedInput;
+    simdjson::dom::element clMyRoot;
+    const char* pcMySharedMessage{nullptr};
+    size_t uiMySharedLength{0};
+};
+
+} // namespace novatel::edie
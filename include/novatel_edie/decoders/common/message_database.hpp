@@ -479,25 +479,115 @@ struct ArrayField : BaseField
     }
 };
 
+//-----------------------------------------------------------------------
+//! \struct FieldHandle
+//! \brief A field definition resolved once into what a typed load needs.
+//!
+//! Passing a handle to GetFieldValue<T>() loads a fixed field straight from
+//! its offset, with no name lookup and no dispatch on the field definition.
+//! Other fields are read through the definition. A handle refers to the
+//! definition it was made from, so it is only valid while the FieldInfo that
+//! owns the definition is alive.
+//-----------------------------------------------------------------------
+struct FieldHandle
+{
+    const BaseField* field{nullptr};      // nullptr if the field was not found
+    size_t index{0};                      // byte offset in the fixed fields, or index in the variable fields
+    FIELD_TYPE type{FIELD_TYPE::UNKNOWN}; // type of the field
+    uint16_t width{0};                    // length in bytes of the field, or of one element of an array
+    uint32_t arrayLength{0};              // number of elements of a FIXED_LENGTH_ARRAY, 0 otherwise
+
+    FieldHandle() = default;
+
+    explicit FieldHandle(const BaseField& field_) : field(&field_), index(field_.index), type(field_.type), width(field_.dataType.length)
+    {
+        if (type == FIELD_TYPE::FIXED_LENGTH_ARRAY)
+        {
+            const auto* arrayField = dynamic_cast<const ArrayField*>(&field_);
+            if (arrayField == nullptr) { throw std::runtime_error("FieldHandle(): missing fixed array metadata"); }
+            arrayLength = arrayField->arrayLength;
+        }
+    }
+
+    [[nodiscard]] explicit operator bool() const { return field != nullptr; }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Check if the field is stored in the fixed fields and can be
+    //!     loaded from its offset.
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] bool IsFixed() const
+    {
+        switch (type)
+        {
+        case FIELD_TYPE::SIMPLE: [[fallthrough]];
+        case FIELD_TYPE::ENUM: [[fallthrough]];
+        case FIELD_TYPE::BITFIELD: [[fallthrough]];
+        case FIELD_TYPE::RESPONSE_ID: [[fallthrough]];
+        case FIELD_TYPE::FIXED_LENGTH_ARRAY: return true;
+        default: return false;
+        }
+    }
+};
+
+struct DecodePlan;
+struct FieldNameIndex;
+
 struct FieldInfo
 {
     size_t fixedFieldBytes{0};
     size_t varFieldCount{0};
-    std::vector<BaseField::ConstPtr> messageOrderedFields; // vector of field definitions in the order they are encoded in the message
+    std::vector<BaseField::ConstPtr> messageOrderedFields;   // vector of field definitions in the order they are encoded in the message
+    mutable std::shared_ptr<const DecodePlan> decodePlan;    // cached; compiled from messageOrderedFields on first use, see InvalidateCaches()
+    mutable std::shared_ptr<const FieldNameIndex> nameIndex; // cached; built by BuildFieldInfo() or on first lookup, see InvalidateCaches()
 
     // ---------------------------------------------------------------------------
     //! \brief Get a field definition by name.
     //!
+    //! The definition is looked up in a hashed index of the field names, which
+    //! is built on first use and cached until InvalidateCaches() is called.
+    //! A name the index misses or maps to a different field is searched for in
+    //! messageOrderedFields, and the index is rebuilt if it is found there.
+    //!
     //! \param[in] fieldName_ The name of the field definition to retrieve.
     //! \return A constant pointer to the field definition if found, nullptr otherwise.
     // ---------------------------------------------------------------------------
-    BaseField::ConstPtr GetFieldDefByName(const std::string& fieldName_) const
-    {
-        const auto it = std::find_if(messageOrderedFields.begin(), messageOrderedFields.end(),
-                                     [&fieldName_](const BaseField::ConstPtr& fieldDef) { return fieldDef->name == fieldName_; });
-        if (it == messageOrderedFields.end()) { return nullptr; }
-        return *it;
-    }
+    [[nodiscard]] BaseField::ConstPtr GetFieldDefByName(const std::string& fieldName_) const;
+
+    // ---------------------------------------------------------------------------
+    //! \brief Get a handle to a field, to be fetched once and reused for every
+    //!     access to the field.
+    //!
+    //! \param[in] fieldName_ The name of the field.
+    //! \return The handle of the field, which is false if no field has that name.
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] FieldHandle GetFieldHandle(const std::string& fieldName_) const;
+
+    // ---------------------------------------------------------------------------
+    //! \brief Get the decode plan of these fields.
+    //!
+    //! The plan is compiled on first use and cached until InvalidateCaches()
+    //! is called.
+    //!
+    //! \return The decode plan.
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] const DecodePlan& GetDecodePlan() const;
+
+    // ---------------------------------------------------------------------------
+    //! \brief Get the decode plan of these fields, sharing its ownership.
+    //!
+    //! \return The decode plan, which stays valid after InvalidateCaches().
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] std::shared_ptr<const DecodePlan> GetDecodePlanPtr() const;
+
+    // ---------------------------------------------------------------------------
+    //! \brief Drop what is cached from messageOrderedFields.
+    //!
+    //! Must be called after messageOrderedFields or its field definitions are
+    //! changed, and not while the FieldInfo is used by a decoder. Both the
+    //! decode plan and the field name index are rebuilt on their next use, and
+    //! references returned by GetDecodePlan() are invalidated.
+    // ---------------------------------------------------------------------------
+    void InvalidateCaches();
 
     [[nodiscard]] std::shared_ptr<FieldInfo> clone() const
     {
@@ -838,7 +928,7 @@ class MessageDatabase
     //
     //! \param[in] sMsgName_ The message name string
     //----------------------------------------------------------------------------
-    [[nodiscard]] uint32_t MsgNameToMsgId(std::string sMsgName_) const;
+    [[nodiscard]] uint32_t MsgNameToMsgId(std::string_view sMsgName_) const;
 
     //----------------------------------------------------------------------------
     //! \brief Convert a message ID number to a message name string.
@@ -27,23 +27,32 @@
 #ifndef MESSAGE_DECODER_HPP
 #define MESSAGE_DECODER_HPP
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <charconv>
 #include <cstring>
 #include <functional>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
 
 #include <simdjson.h>
 
+#include "novatel_edie/common/delimiter_index.hpp"
 #include "novatel_edie/common/logger.hpp"
 #include "novatel_edie/decoders/common/common.hpp"
+#include "novatel_edie/decoders/common/decode_plan.hpp"
+#include "novatel_edie/decoders/common/json_message_parser.hpp"
 #include "novatel_edie/decoders/common/message_database.hpp"
 #include "novatel_edie/decoders/common/message_decoder.hpp"
 
@@ -60,30 +69,36 @@ template <template <typename...> class Template, typename... Args> struct is_spe
 template <typename T, template <typename...> class Template> inline constexpr bool is_specialization_of_v = is_specialization_of<T, Template>::value;
 
 class CompositeField;
+class CompositeFieldArena;
 class FieldArray;
 class FieldArrayRecordView;
+class MessageDecoderBase;
 using CompositeFieldArray = std::vector<CompositeField>;
 
 // ---------------------------------------------------------------------------
 //! \class TypedBuffer
 //! \brief A lightweight wrapper around a byte buffer that allows for typed
-//!     access to its elements. Used for fields of type FIXED_LENGTH_ARRAY.
+//!     access to its elements. Used for fields of type FIXED_LENGTH_ARRAY, and
+//!     for VARIABLE_LENGTH_ARRAY fields borrowed from the message by a view
+//!     decode.
 // ---------------------------------------------------------------------------
 template <typename T> class TypedBuffer
 {
   private:
-    const std::byte* data;
+    const std::byte* buffer;
     size_t sz;
 
   public:
-    TypedBuffer(const std::byte* data_, size_t sz_) : data(data_), sz(sz_) {}
+    TypedBuffer(const std::byte* data_, size_t sz_) : buffer(data_), sz(sz_) {}
 
     T operator[](size_t index) const
     {
         if (index >= sz) { throw std::runtime_error("TypedBuffer<T>::operator[](): index out of bounds"); }
-        return LoadValueFromBuffer<T>(data + (index * sizeof(T)));
+        return LoadValueFromBuffer<T>(buffer + (index * sizeof(T)));
     }
 
+    const std::byte* data() const { return buffer; }
+
     constexpr size_t size() const { return sz; }
 
     constexpr bool empty() const { return sz == 0; }
@@ -122,10 +137,24 @@ template <typename T> class TypedBuffer
         bool operator!=(const const_iterator& other) const { return !(*this == other); }
     };
 
-    const_iterator begin() const { return const_iterator(data, 0); }
-    const_iterator end() const { return const_iterator(data, sz); }
+    const_iterator begin() const { return const_iterator(buffer, 0); }
+    const_iterator end() const { return const_iterator(buffer, sz); }
 };
 
+// ---------------------------------------------------------------------------
+//! \brief A non-owning view of a field value, for traversing messages
+//!     without copying them.
+//!
+//! \details Scalars are held by value. Strings are viewed as std::string_view,
+//!     fixed and variable-length arrays as a TypedBuffer over their elements
+//!     and field arrays as a FieldArray. A view refers to the message it was
+//!     taken from, so it is only valid while the message is alive and unchanged.
+// ---------------------------------------------------------------------------
+using FieldValueView =
+    std::variant<bool, int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double, TypedBuffer<bool>,
+                 TypedBuffer<int8_t>, TypedBuffer<uint8_t>, TypedBuffer<int16_t>, TypedBuffer<uint16_t>, TypedBuffer<int32_t>, TypedBuffer<uint32_t>,
+                 TypedBuffer<int64_t>, TypedBuffer<uint64_t>, TypedBuffer<float>, TypedBuffer<double>, std::string_view, FieldArray>;
+
 // ---------------------------------------------------------------------------
 //! \brief A visitor that calls the given function with a type tag corresponding
 //!     to the data type of the given BaseField.
@@ -228,11 +257,39 @@ class FixedFieldRegion
     [[nodiscard]] static FixedFieldRegion View(const std::byte* data_, size_t size_)
     {
         FixedFieldRegion region;
-        region.viewData = data_;
-        region.viewSize = size_;
+        region.SetView(data_, size_);
         return region;
     }
 
+    // ---------------------------------------------------------------------------
+    //! \brief Make this region borrow external bytes instead of its own.
+    //!
+    //! The owned bytes are dropped, but their capacity is kept for the next time
+    //! the region owns its data.
+    //!
+    //! \param[in] data_ Pointer to the first byte of the borrowed region.
+    //! \param[in] size_ Number of bytes in the borrowed region.
+    // ---------------------------------------------------------------------------
+    void SetView(const std::byte* data_, size_t size_)
+    {
+        byteRegion.clear();
+        viewData = data_;
+        viewSize = size_;
+    }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Copy the borrowed bytes of a view into the region, so that it no
+    //!     longer depends on the memory it was viewing. Does nothing if the
+    //!     region already owns its data.
+    // ---------------------------------------------------------------------------
+    void TakeOwnership()
+    {
+        if (viewData == nullptr) { return; }
+        byteRegion.assign(viewData, viewData + viewSize);
+        viewData = nullptr;
+        viewSize = 0;
+    }
+
     //! \brief Whether this region borrows external memory (read-only view).
     [[nodiscard]] bool IsView() const { return viewData != nullptr; }
 
@@ -251,6 +308,30 @@ class FixedFieldRegion
         byteRegion.resize(sz_);
     }
 
+    // ---------------------------------------------------------------------------
+    //! \brief Remove all bytes from the FixedFieldRegion, keeping its capacity.
+    //!
+    //! A view is turned back into an empty owning region.
+    // ---------------------------------------------------------------------------
+    void clear()
+    {
+        byteRegion.clear();
+        viewData = nullptr;
+        viewSize = 0;
+    }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Replace the contents of the FixedFieldRegion, reusing its capacity.
+    //!
+    //! \param[in] data_ Pointer to the bytes to copy.
+    //! \param[in] size_ Number of bytes to copy.
+    // ---------------------------------------------------------------------------
+    void assign(const std::byte* data_, size_t size_)
+    {
+        assert(!IsView() && "assign() is not permitted on a non-owning FixedFieldRegion view");
+        byteRegion.assign(data_, data_ + size_);
+    }
+
     // ---------------------------------------------------------------------------
     //! \brief Load a trivially-copyable value of type T from a raw byte offset.
     //!
@@ -438,6 +519,37 @@ template <typename T>
     throw std::runtime_error("GetFieldValue<T>(): field must be an array type or element index must be zero");
 }
 
+// ---------------------------------------------------------------------------
+//! \brief Load a fixed field value, or an element of a fixed-length array
+//!     field, from raw storage through a resolved handle.
+//!
+//! \tparam T The value type (trivially copyable).
+//! \param[in] region_ The byte storage to read from.
+//! \param[in] elemIndex_ The array element index, 0 for a scalar field.
+//! \param[in] handle_ The handle of a fixed field, see FieldHandle::IsFixed().
+//! \param[in] baseIndex_ Optional base byte offset (e.g. flat-array row start).
+// ---------------------------------------------------------------------------
+template <typename T>
+[[nodiscard]] inline T LoadFixedFieldElement(const FixedFieldRegion& region_, size_t elemIndex_, const FieldHandle& handle_, size_t baseIndex_ = 0)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "LoadFixedFieldElement only supports trivially copyable types");
+    if (handle_.type != FIELD_TYPE::FIXED_LENGTH_ARRAY)
+    {
+        if (elemIndex_ != 0) { throw std::runtime_error("GetFieldValue<T>(): field must be an array type or element index must be zero"); }
+#ifndef NDEBUG
+        AssertFixedFieldType<T>(*handle_.field);
+#endif
+        return region_.Load<T>(baseIndex_ + handle_.index);
+    }
+
+    if (elemIndex_ >= handle_.arrayLength) { throw std::runtime_error("GetFieldValue<T>(): index out of bounds for fixed-length array field"); }
+#ifndef NDEBUG
+    AssertFixedFieldType<std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>>(*handle_.field);
+#endif
+    if constexpr (std::is_same_v<T, bool>) { return static_cast<bool>(region_.Load<uint8_t>(baseIndex_ + handle_.index + elemIndex_)); }
+    else { return region_.Load<T>(baseIndex_ + handle_.index + (elemIndex_ * sizeof(T))); }
+}
+
 // ---------------------------------------------------------------------------
 //! \class FieldArrayRecordView
 //! \brief A lightweight, non-owning view over a single FIELD_ARRAY element.
@@ -467,6 +579,12 @@ class FieldArrayRecordView
     // ---------------------------------------------------------------------------
     template <typename T> [[nodiscard]] T GetFieldValue(const BaseField& field_, size_t elementIndex_ = 0) const;
 
+    // ---------------------------------------------------------------------------
+    //! \brief Get a field value through a handle resolved from the field info.
+    //! \see FieldArrayRecordView::GetFieldValue
+    // ---------------------------------------------------------------------------
+    template <typename T> [[nodiscard]] T GetFieldValue(const FieldHandle& handle_, size_t elementIndex_ = 0) const;
+
     // ---------------------------------------------------------------------------
     //! \brief Get a field value by its name.
     //! \see FieldArrayRecordView::GetFieldValue
@@ -479,6 +597,48 @@ class FieldArrayRecordView
         return GetFieldValue<T>(*field, elementIndex_);
     }
 
+    // ---------------------------------------------------------------------------
+    //! \brief Get a non-owning view of a field value.
+    //! \see CompositeField::GetFieldValueView
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] FieldValueView GetFieldValueView(const BaseField& field_) const;
+
+    struct const_iterator
+    {
+        using value_type = std::pair<BaseField::ConstPtr, FieldValueView>;
+        using reference = value_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        const FieldArrayRecordView* record;
+        size_t index;
+
+        const_iterator(const FieldArrayRecordView* record_, size_t index_ = 0) : record(record_), index(index_) {}
+
+        reference operator*() const;
+
+        const_iterator& operator++()
+        {
+            index++;
+            return *this;
+        }
+
+        bool operator==(const const_iterator& other) const { return record == other.record && index == other.index; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+    };
+
+    const_iterator begin() const
+    {
+        if (fieldInfo == nullptr) { throw std::runtime_error("begin(): field definitions not set"); }
+        return const_iterator(this);
+    }
+
+    const_iterator end() const
+    {
+        if (fieldInfo == nullptr) { throw std::runtime_error("end(): field definitions not set"); }
+        return const_iterator(this, fieldInfo->messageOrderedFields.size());
+    }
+
   private:
     const FieldInfo* fieldInfo = nullptr;
 
@@ -502,7 +662,7 @@ class FlatFieldArray
 {
   private:
     FixedFieldRegion fields;
-    const FieldInfo* fieldInfo;
+    const FieldInfo* fieldInfo{nullptr};
 
     static void CheckFieldInfo(const FieldInfo* fieldInfo_)
     {
@@ -511,6 +671,8 @@ class FlatFieldArray
     }
 
   public:
+    FlatFieldArray() = default;
+
     FlatFieldArray(std::vector<std::byte>&& data_, const FieldInfo* fieldInfo_) : fields(std::move(data_)), fieldInfo(fieldInfo_)
     {
         CheckFieldInfo(fieldInfo_);
@@ -554,6 +716,56 @@ class FlatFieldArray
     // ---------------------------------------------------------------------------
     void resize(size_t sz_) { fields.resize(sz_); }
 
+    // ---------------------------------------------------------------------------
+    //! \brief Remove all elements from the FlatFieldArray, keeping its capacity.
+    // ---------------------------------------------------------------------------
+    void clear() { fields.clear(); }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Replace the elements of the FlatFieldArray, reusing its capacity.
+    //!
+    //! \param[in] data_ Pointer to the encoded elements.
+    //! \param[in] size_ The size of the elements in bytes.
+    //! \param[in] fieldInfo_ The field info of one element.
+    // ---------------------------------------------------------------------------
+    void Assign(const std::byte* data_, size_t size_, const FieldInfo* fieldInfo_)
+    {
+        CheckFieldInfo(fieldInfo_);
+        if (size_ % fieldInfo_->fixedFieldBytes != 0)
+        {
+            throw std::runtime_error("FlatFieldArray::Assign(): data size must be a multiple of fixed field bytes");
+        }
+        fieldInfo = fieldInfo_;
+        fields.assign(data_, size_);
+    }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Make the FlatFieldArray borrow encoded elements without copying them.
+    //!
+    //! The caller must ensure the referenced memory outlives the array, or call
+    //! TakeOwnership() before it goes away.
+    //!
+    //! \param[in] data_ Pointer to the encoded elements.
+    //! \param[in] size_ The size of the elements in bytes.
+    //! \param[in] fieldInfo_ The field info of one element.
+    // ---------------------------------------------------------------------------
+    void AssignView(const std::byte* data_, size_t size_, const FieldInfo* fieldInfo_)
+    {
+        CheckFieldInfo(fieldInfo_);
+        if (size_ % fieldInfo_->fixedFieldBytes != 0)
+        {
+            throw std::runtime_error("FlatFieldArray::AssignView(): data size must be a multiple of fixed field bytes");
+        }
+        fieldInfo = fieldInfo_;
+        fields.SetView(data_, size_);
+    }
+
+    //! \brief Whether the elements are borrowed from external memory.
+    [[nodiscard]] bool IsView() const { return fields.IsView(); }
+
+    //! \brief Copy borrowed elements into the array's own storage.
+    void TakeOwnership() { fields.TakeOwnership(); }
+
     // ---------------------------------------------------------------------------
     //! \brief Get a field value at the given index as a specified type.
     //!
@@ -567,6 +779,17 @@ class FlatFieldArray
         return LoadFixedField<T>(fields, field_, index_ * fieldInfo->fixedFieldBytes);
     }
 
+    // ---------------------------------------------------------------------------
+    //! \brief Get a field value at the given index through a handle resolved
+    //!     from the field info.
+    //! \see FlatFieldArray::GetFieldValue
+    // ---------------------------------------------------------------------------
+    template <typename T> T GetFieldValue(const FieldHandle& handle_, size_t index_, size_t elementIndex_ = 0) const
+    {
+        if constexpr (is_specialization_of_v<T, TypedBuffer>) { return GetFieldValue<T>(*handle_.field, index_); }
+        else { return LoadFixedFieldElement<T>(fields, elementIndex_, handle_, index_ * fieldInfo->fixedFieldBytes); }
+    }
+
     // ---------------------------------------------------------------------------
     //! \brief Get a field value at the given index by its name.
     //! \see FlatFieldArray::GetFieldValue
@@ -706,11 +929,11 @@ using FieldValueVariant =
                  std::vector<int32_t>, std::vector<int64_t>, std::vector<uint8_t>, std::vector<uint16_t>, std::vector<uint32_t>,
                  std::vector<uint64_t>, std::vector<float>, std::vector<double>, std::string, FlatFieldArray, CompositeFieldArray>;
 
-//! Shared implementation for the LoadVariant overloads: select the concrete element type from the
-//! schema via SimpleTypeVisitor and let the caller-supplied loader build the variant payload.
-template <typename Field, typename Loader> inline FieldValueVariant LoadVariantImpl(const Field& fd_, Loader&& loader_)
+//! Shared implementation for the LoadVariant and LoadFieldView overloads: select the concrete element type from
+//! the schema via SimpleTypeVisitor and let the caller-supplied loader build the variant payload.
+template <typename Result = FieldValueVariant, typename Field, typename Loader> inline Result LoadVariantImpl(const Field& fd_, Loader&& loader_)
 {
-    FieldValueVariant result;
+    Result result;
     SimpleTypeVisitor(fd_, [&](auto&& arg) { result = loader_(std::decay_t<decltype(arg)>{}); });
     return result;
 }
@@ -735,9 +958,23 @@ inline FieldValueVariant LoadVariant(const ArrayField& fd_, const std::byte* fie
 class CompositeField
 {
   private:
+    friend class CompositeFieldArena;
+
     FixedFieldRegion fixedFields;
     std::vector<FieldValueVariant> varFields;
     FieldInfo::ConstPtr fieldInfo;
+    std::shared_ptr<CompositeFieldArena> arena; //!< Recycled payload storage, created by Reset() and shared with field array records.
+    DecodePlan::ConstPtr projection;            //!< Projected plan the message was decoded with, nullptr if it was decoded in full.
+
+    //! Load an element of a variable-length array, whether it is owned or borrowed by a view decode.
+    template <typename T> [[nodiscard]] T GetVarArrayElement(size_t index_, size_t elementIndex_) const
+    {
+        const auto& value = varFields[index_];
+        const auto* view = std::get_if<TypedBuffer<T>>(&value);
+        const size_t size = view != nullptr ? view->size() : std::get<std::vector<T>>(value).size();
+        if (elementIndex_ >= size) { throw std::runtime_error("GetFieldValue<T>(): index out of bounds for variable-length array field"); }
+        return view != nullptr ? (*view)[elementIndex_] : std::get<std::vector<T>>(value)[elementIndex_];
+    }
 
   public:
     // ---------------------------------------------------------------------------
@@ -842,10 +1079,101 @@ class CompositeField
     }
 
     // ---------------------------------------------------------------------------
-    //! Copy constructor and assignment operator
+    //! Copy constructor and assignment operator. A copy never shares the arena of
+    //! its source, so it can be used independently of the decoding thread.
+    // ---------------------------------------------------------------------------
+    CompositeField(const CompositeField& other)
+        : fixedFields(other.fixedFields), varFields(other.varFields), fieldInfo(other.fieldInfo), projection(other.projection)
+    {
+    }
+    CompositeField& operator=(const CompositeField& other)
+    {
+        if (this != &other)
+        {
+            fixedFields = other.fixedFields;
+            varFields = other.varFields;
+            fieldInfo = other.fieldInfo;
+            projection = other.projection;
+        }
+        return *this;
+    }
+
+    CompositeField(CompositeField&&) noexcept = default;
+    CompositeField& operator=(CompositeField&&) noexcept = default;
+
+    // ---------------------------------------------------------------------------
+    //! \brief Clear the CompositeField so it can be reused for the next message.
+    //!
+    //! The payloads of all variable fields (strings, vectors and field array
+    //! records) are handed back to the CompositeField's arena with their capacity
+    //! intact, and are taken out again by EmplaceVarField() and EmplaceRecord().
+    //! Once a stream has been decoded for a while, decoding into a reused
+    //! CompositeField performs no heap allocations.
+    //!
+    //! \note The arena is not thread-safe. Field array records share the arena of
+    //!     the CompositeField that owns them.
+    // ---------------------------------------------------------------------------
+    void Reset();
+
+    // ---------------------------------------------------------------------------
+    //! \brief Replace a variable field with an empty payload of type T.
+    //!
+    //! The payload is taken from the arena when one is available, so its
+    //! capacity is reused from a previous message.
+    //!
+    //! \tparam T The payload type; one of the container alternatives of FieldValueVariant.
+    //! \param[in] index_ The variable field index.
+    //! \return A reference to the empty payload.
+    //! \throws std::runtime_error on invalid index.
+    // ---------------------------------------------------------------------------
+    template <typename T> T& EmplaceVarField(size_t index_);
+
+    // ---------------------------------------------------------------------------
+    //! \brief Append a record to a field array owned by this CompositeField.
+    //!
+    //! \param[in] records_ The field array to append to.
+    //! \param[in] fieldInfo_ The field info of the record.
+    //! \return A reference to the new record, sized for fieldInfo_.
+    // ---------------------------------------------------------------------------
+    CompositeField& EmplaceRecord(CompositeFieldArray& records_, const FieldInfo::ConstPtr& fieldInfo_);
+
+    // ---------------------------------------------------------------------------
+    //! \brief Make the fixed fields borrow an encoded fixed-field block in place.
+    //!
+    //! The caller must ensure the referenced memory outlives the CompositeField,
+    //! or call TakeOwnership() before it goes away.
+    //!
+    //! \param[in] data_ Pointer to the first byte of the fixed fields.
+    //! \param[in] size_ Number of bytes of fixed fields.
+    // ---------------------------------------------------------------------------
+    void BorrowFixedFields(const std::byte* data_, size_t size_) { fixedFields.SetView(data_, size_); }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Make a variable-length array field borrow its encoded elements in
+    //!     place, as a TypedBuffer<T>.
+    //!
+    //! \tparam T The element type as stored (uint8_t for BOOL arrays).
+    //! \param[in] index_ The variable field index.
+    //! \param[in] data_ Pointer to the first element.
+    //! \param[in] n_ Number of elements.
+    //! \throws std::runtime_error on invalid index.
+    // ---------------------------------------------------------------------------
+    template <typename T> void BorrowVarField(size_t index_, const std::byte* data_, size_t n_);
+
+    // ---------------------------------------------------------------------------
+    //! \brief Whether any field is borrowed from the decoded message rather than
+    //!     owned by the CompositeField.
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] bool IsView() const;
+
+    // ---------------------------------------------------------------------------
+    //! \brief Copy every borrowed field into storage owned by the CompositeField,
+    //!     so that it no longer depends on the buffer it was decoded from.
+    //!
+    //! Borrowed variable-length arrays become std::vector<T>. This is the only
+    //! point at which a view decode copies the message.
     // ---------------------------------------------------------------------------
-    CompositeField(const CompositeField& other) : fixedFields(other.fixedFields), varFields(other.varFields), fieldInfo(other.fieldInfo) {}
-    CompositeField& operator=(const CompositeField& other) = default;
+    void TakeOwnership();
 
     // ---------------------------------------------------------------------------
     //! \brief Resize the memory regions of the CompositeField.
@@ -866,6 +1194,34 @@ class CompositeField
     const std::vector<FieldValueVariant>& GetVarFields() const { return varFields; }
     const FieldInfo::ConstPtr& GetFieldInfo() const { return fieldInfo; }
 
+    // ---------------------------------------------------------------------------
+    //! \brief Set the projected plan the message was decoded with.
+    //!
+    //! \param[in] projection_ The projected plan, nullptr if the message was
+    //!     decoded in full.
+    // ---------------------------------------------------------------------------
+    void SetProjection(DecodePlan::ConstPtr projection_) { projection = std::move(projection_); }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Check if a top-level field was decoded or left out by a projection.
+    //!
+    //! Fields that are absent hold default values, or unspecified values for the
+    //! fixed fields of a binary message without variable-length fields. Fields
+    //! of field array records are always present.
+    //!
+    //! \param[in] field_ The field definition.
+    //! \return false if a projection left the field out of the message.
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] bool IsFieldPresent(const BaseField& field_) const
+    {
+        if (projection == nullptr) { return true; }
+        for (const DecodeOp& stOp : projection->ops)
+        {
+            if (stOp.field == &field_) { return !stOp.skip; }
+        }
+        return true;
+    }
+
     // ---------------------------------------------------------------------------
     //! \brief Get a field value as a specific type.
     //!
@@ -891,24 +1247,31 @@ class CompositeField
             }
             else { throw std::runtime_error("GetFieldValue<T>(): incorrect type given for FIXED_LENGTH_ARRAY"); }
         case FIELD_TYPE::VARIABLE_LENGTH_ARRAY:
-            if constexpr (is_specialization_of_v<T, std::vector>) { return std::get<T>(varFields[field_.index]); }
-            else if constexpr (std::is_same_v<T, bool>)
+            if constexpr (is_specialization_of_v<T, std::vector>)
             {
-                const auto& vec = std::get<std::vector<uint8_t>>(varFields[field_.index]);
-                if (elementIndex_ >= vec.size())
+                // A view decode borrows the array; hand back an owned copy either way
+                using ElementType = typename T::value_type;
+                if (const auto* view = std::get_if<TypedBuffer<ElementType>>(&varFields[field_.index]))
                 {
-                    throw std::runtime_error("GetFieldValue<T>(): index out of bounds for variable-length array field");
+                    T values(view->size());
+                    if (!values.empty()) { std::memcpy(values.data(), view->data(), values.size() * sizeof(ElementType)); }
+                    return values;
                 }
-                return static_cast<bool>(vec[elementIndex_]);
+                return std::get<T>(varFields[field_.index]);
             }
-            else if constexpr (std::is_trivially_copyable_v<T> && !std::is_same_v<T, FieldArray> && !is_specialization_of_v<T, TypedBuffer>)
+            else if constexpr (is_specialization_of_v<T, TypedBuffer>)
             {
-                const auto& vec = std::get<std::vector<T>>(varFields[field_.index]);
-                if (elementIndex_ >= vec.size())
-                {
-                    throw std::runtime_error("GetFieldValue<T>(): index out of bounds for variable-length array field");
-                }
-                return vec[elementIndex_];
+                // A view over the array, whether it is borrowed from the message or owned
+                const auto& value = varFields[field_.index];
+                if (const auto* view = std::get_if<T>(&value)) { return *view; }
+                using ElementType = std::decay_t<decltype(std::declval<T>()[0])>;
+                const auto& vec = std::get<std::vector<ElementType>>(value);
+                return T(reinterpret_cast<const std::byte*>(vec.data()), vec.size());
+            }
+            else if constexpr (std::is_same_v<T, bool>) { return static_cast<bool>(GetVarArrayElement<uint8_t>(field_.index, elementIndex_)); }
+            else if constexpr (std::is_trivially_copyable_v<T> && !std::is_same_v<T, FieldArray>)
+            {
+                return GetVarArrayElement<T>(field_.index, elementIndex_);
             }
             else { throw std::runtime_error("GetFieldValue<T>(): incorrect type given for VARIABLE_LENGTH_ARRAY"); }
         case FIELD_TYPE::RESPONSE_STR: [[fallthrough]];
@@ -936,6 +1299,24 @@ class CompositeField
         }
     }
 
+    // ---------------------------------------------------------------------------
+    //! \brief Get a field value through a handle resolved from the field info.
+    //!
+    //! Fixed fields are loaded straight from the offset of the handle. Other
+    //! fields are read as by GetFieldValue(const BaseField&, size_t).
+    //!
+    //! \see CompositeField::GetFieldValue
+    // ---------------------------------------------------------------------------
+    template <typename T> [[nodiscard]] T GetFieldValue(const FieldHandle& handle_, size_t elementIndex_ = 0) const
+    {
+        if (!handle_) { throw std::runtime_error("CompositeField::GetFieldValue(): invalid field handle"); }
+        if constexpr (std::is_trivially_copyable_v<T> && !std::is_same_v<T, FieldArray> && !is_specialization_of_v<T, TypedBuffer>)
+        {
+            if (handle_.IsFixed()) { return LoadFixedFieldElement<T>(fixedFields, elementIndex_, handle_); }
+        }
+        return GetFieldValue<T>(*handle_.field, elementIndex_);
+    }
+
     // ---------------------------------------------------------------------------
     //! \brief Get a field value by its name.
     //! \see CompositeField::GetFieldValue
@@ -985,6 +1366,18 @@ class CompositeField
         return GetFieldValueVariant(static_cast<const BaseField&>(field_));
     }
 
+    // ---------------------------------------------------------------------------
+    //! \brief Get a non-owning view of a field value.
+    //!
+    //! Unlike GetFieldValueVariant(), strings, arrays and field arrays are not
+    //! copied, so traversing a message never allocates.
+    //!
+    //! \param[in] field_ The field definition.
+    //! \return A FieldValueView of the field value, valid while the message is
+    //!     alive and unchanged.
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] FieldValueView GetFieldValueView(const BaseField& field_) const;
+
     // ---------------------------------------------------------------------------
     //! \brief Get the byte size of a field.
     //!
@@ -1012,6 +1405,7 @@ class CompositeField
                     using T = std::decay_t<decltype(value)>;
                     if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::vector<std::byte>>) { return value.size(); }
                     else if constexpr (std::is_same_v<T, FlatFieldArray>) { return value.ByteSize(); }
+                    else if constexpr (is_specialization_of_v<T, TypedBuffer>) { return sizeof(decltype(value[0])) * value.size(); }
                     else if constexpr (std::is_same_v<T, std::vector<CompositeField>>)
                     {
                         const auto* fieldArrayField = dynamic_cast<const FieldArrayField*>(&field_);
@@ -1064,7 +1458,8 @@ class CompositeField
             return std::visit(
                 [](const auto& value) -> size_t {
                     using T = std::decay_t<decltype(value)>;
-                    if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, FlatFieldArray> || is_specialization_of_v<T, std::vector>)
+                    if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, FlatFieldArray> || is_specialization_of_v<T, std::vector> ||
+                                  is_specialization_of_v<T, TypedBuffer>)
                     {
                         return value.size();
                     }
@@ -1142,9 +1537,9 @@ class CompositeField
             if (startIndex_ >= varFields.size()) { throw std::runtime_error("SetFieldValue(): varFields index is out of range"); }
 
             using BufferElementType = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
-            std::vector<BufferElementType> values(n);
-            std::memcpy(values.data(), values_, n * sizeof(BufferElementType));
-            varFields[startIndex_] = std::move(values);
+            auto& values = EmplaceVarField<std::vector<BufferElementType>>(startIndex_);
+            values.resize(n);
+            if (n > 0) { std::memcpy(values.data(), values_, n * sizeof(BufferElementType)); }
         }
     }
 
@@ -1328,6 +1723,10 @@ class CompositeField
                         return copyBytes(reinterpret_cast<const std::byte*>(value.data()), value.size());
                     }
                     else if constexpr (std::is_same_v<T, FlatFieldArray>) { return copyBytes(value.data(), value.ByteSize()); }
+                    else if constexpr (is_specialization_of_v<T, TypedBuffer>)
+                    {
+                        return copyBytes(value.data(), sizeof(decltype(value[0])) * value.size());
+                    }
                     else if constexpr (std::is_arithmetic_v<T>)
                     {
                         throw std::runtime_error("WriteFieldToBuffer(): scalar values are not valid var field payloads");
@@ -1373,9 +1772,10 @@ class CompositeField
         return written;
     }
 
+    //! Iterates over the fields in message order, as pairs of a definition and a FieldValueView.
     struct const_iterator
     {
-        using value_type = std::pair<BaseField::ConstPtr, FieldValueVariant>;
+        using value_type = std::pair<BaseField::ConstPtr, FieldValueView>;
         using reference = value_type;
         using difference_type = std::ptrdiff_t;
         using iterator_category = std::forward_iterator_tag;
@@ -1385,11 +1785,7 @@ class CompositeField
 
         const_iterator(const CompositeField* compField_, size_t index_ = 0) : compField(compField_), index(index_) {}
 
-        reference operator*() const
-        {
-            const auto& fieldDef = compField->fieldInfo->messageOrderedFields[index];
-            return {fieldDef, compField->GetFieldValueVariant(*fieldDef)};
-        }
+        reference operator*() const;
 
         const_iterator& operator++()
         {
@@ -1414,6 +1810,194 @@ class CompositeField
     }
 };
 
+//! Index of type T among the alternatives of a std::variant.
+template <typename T, typename Variant> struct VariantIndex;
+
+template <typename T, typename... Ts> struct VariantIndex<T, std::variant<Ts...>>
+{
+    static constexpr size_t value = [] {
+        constexpr std::array<bool, sizeof...(Ts)> matches{std::is_same_v<T, Ts>...};
+        for (size_t i = 0; i < matches.size(); ++i)
+        {
+            if (matches[i]) { return i; }
+        }
+        return matches.size();
+    }();
+    static_assert(value < sizeof...(Ts), "VariantIndex: type is not an alternative of the variant");
+};
+
+// ---------------------------------------------------------------------------
+//! \class CompositeFieldArena
+//! \brief Free lists of variable field payloads and field array records
+//!     released by CompositeField::Reset().
+//!
+//! Payloads are cleared, but keep their capacity, so taking one back out for
+//! the next message of the same shape does not allocate. They are released in
+//! reverse field order, so that a message of the same shape takes each payload
+//! back into the field it came from.
+// ---------------------------------------------------------------------------
+class CompositeFieldArena
+{
+  private:
+    std::array<std::vector<FieldValueVariant>, std::variant_size_v<FieldValueVariant>> vMyFreeValues;
+    std::vector<CompositeField> vMyFreeRecords;
+
+  public:
+    // ---------------------------------------------------------------------------
+    //! \brief Take an empty payload of type T, recycled if one is available.
+    // ---------------------------------------------------------------------------
+    template <typename T> T TakeValue()
+    {
+        auto& freeList = vMyFreeValues[VariantIndex<T, FieldValueVariant>::value];
+        if (freeList.empty()) { return T{}; }
+        T value = std::move(std::get<T>(freeList.back()));
+        freeList.pop_back();
+        return value;
+    }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Take an empty field array record, recycled if one is available.
+    // ---------------------------------------------------------------------------
+    CompositeField TakeRecord()
+    {
+        if (vMyFreeRecords.empty()) { return CompositeField(); }
+        CompositeField record = std::move(vMyFreeRecords.back());
+        vMyFreeRecords.pop_back();
+        return record;
+    }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Clear a variable field payload and keep it for reuse.
+    //!
+    //! Scalars and TypedBuffer views own no memory and are left untouched.
+    //!
+    //! \param[in,out] value_ The payload to release. It is left moved-from.
+    // ---------------------------------------------------------------------------
+    void ReleaseValue(FieldValueVariant& value_)
+    {
+        const bool bRecyclable = std::visit(
+            [this](auto& payload) {
+                using T = std::decay_t<decltype(payload)>;
+                if constexpr (std::is_same_v<T, CompositeFieldArray>)
+                {
+                    for (auto it = payload.rbegin(); it != payload.rend(); ++it) { ReleaseRecord(*it); }
+                    payload.clear();
+                    return true;
+                }
+                else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, FlatFieldArray> || is_specialization_of_v<T, std::vector>)
+                {
+                    payload.clear();
+                    return true;
+                }
+                else { return false; }
+            },
+            value_);
+
+        if (bRecyclable) { vMyFreeValues[value_.index()].emplace_back(std::move(value_)); }
+    }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Clear a field array record and keep it, and its payloads, for reuse.
+    //!
+    //! \param[in,out] record_ The record to release. It is left moved-from.
+    // ---------------------------------------------------------------------------
+    void ReleaseRecord(CompositeField& record_)
+    {
+        for (auto it = record_.varFields.rbegin(); it != record_.varFields.rend(); ++it) { ReleaseValue(*it); }
+        record_.varFields.clear();
+        record_.fixedFields.clear();
+        record_.fieldInfo.reset();
+        record_.arena.reset();
+        vMyFreeRecords.emplace_back(std::move(record_));
+    }
+};
+
+inline void CompositeField::Reset()
+{
+    if (arena == nullptr) { arena = std::make_shared<CompositeFieldArena>(); }
+    for (auto it = varFields.rbegin(); it != varFields.rend(); ++it) { arena->ReleaseValue(*it); }
+    varFields.clear();
+    fixedFields.clear();
+    if (projection != nullptr) { projection.reset(); }
+}
+
+template <typename T> inline T& CompositeField::EmplaceVarField(size_t index_)
+{
+    if (index_ >= varFields.size()) { throw std::runtime_error("EmplaceVarField(): varFields index is out of range"); }
+
+    auto& slot = varFields[index_];
+    if (arena == nullptr) { return slot.emplace<T>(); }
+
+    arena->ReleaseValue(slot);
+    return slot.emplace<T>(arena->TakeValue<T>());
+}
+
+template <typename T> inline void CompositeField::BorrowVarField(size_t index_, const std::byte* data_, size_t n_)
+{
+    if (index_ >= varFields.size()) { throw std::runtime_error("BorrowVarField(): varFields index is out of range"); }
+
+    auto& slot = varFields[index_];
+    if (arena != nullptr) { arena->ReleaseValue(slot); }
+    slot.emplace<TypedBuffer<T>>(data_, n_);
+}
+
+inline bool CompositeField::IsView() const
+{
+    if (fixedFields.IsView()) { return true; }
+
+    return std::any_of(varFields.begin(), varFields.end(), [](const FieldValueVariant& value_) {
+        return std::visit(
+            [](const auto& payload) {
+                using T = std::decay_t<decltype(payload)>;
+                if constexpr (is_specialization_of_v<T, TypedBuffer>) { return true; }
+                else if constexpr (std::is_same_v<T, FlatFieldArray>) { return payload.IsView(); }
+                else if constexpr (std::is_same_v<T, CompositeFieldArray>)
+                {
+                    return std::any_of(payload.begin(), payload.end(), [](const CompositeField& record_) { return record_.IsView(); });
+                }
+                else { return false; }
+            },
+            value_);
+    });
+}
+
+inline void CompositeField::TakeOwnership()
+{
+    fixedFields.TakeOwnership();
+
+    for (size_t i = 0; i < varFields.size(); ++i)
+    {
+        std::visit(
+            [&](auto& payload) {
+                using T = std::decay_t<decltype(payload)>;
+                if constexpr (is_specialization_of_v<T, TypedBuffer>)
+                {
+                    // BOOL arrays are owned as std::vector<uint8_t>
+                    using ViewType = std::decay_t<decltype(payload[0])>;
+                    using ElementType = std::conditional_t<std::is_same_v<ViewType, bool>, uint8_t, ViewType>;
+                    const T view = payload;
+                    auto& values = EmplaceVarField<std::vector<ElementType>>(i);
+                    values.resize(view.size());
+                    if (!values.empty()) { std::memcpy(values.data(), view.data(), values.size() * sizeof(ElementType)); }
+                }
+                else if constexpr (std::is_same_v<T, FlatFieldArray>) { payload.TakeOwnership(); }
+                else if constexpr (std::is_same_v<T, CompositeFieldArray>)
+                {
+                    for (auto& record : payload) { record.TakeOwnership(); }
+                }
+            },
+            varFields[i]);
+    }
+}
+
+inline CompositeField& CompositeField::EmplaceRecord(CompositeFieldArray& records_, const FieldInfo::ConstPtr& fieldInfo_)
+{
+    auto& record = records_.emplace_back(arena ? arena->TakeRecord() : CompositeField());
+    record.arena = arena;
+    record.SetFieldInfo(fieldInfo_);
+    return record;
+}
+
 template <typename T> inline T FieldArrayRecordView::GetFieldValue(const BaseField& field_, size_t elementIndex_) const
 {
     if (cfRecord != nullptr) { return cfRecord->GetFieldValue<T>(field_, elementIndex_); }
@@ -1435,6 +2019,23 @@ template <typename T> inline T FieldArrayRecordView::GetFieldValue(const BaseFie
     throw std::runtime_error("FieldArrayRecordView::GetFieldValue<T>(): record storage is not initialized");
 }
 
+template <typename T> inline T FieldArrayRecordView::GetFieldValue(const FieldHandle& handle_, size_t elementIndex_) const
+{
+    if (!handle_) { throw std::runtime_error("FieldArrayRecordView::GetFieldValue<T>(): invalid field handle"); }
+    if (cfRecord != nullptr) { return cfRecord->GetFieldValue<T>(handle_, elementIndex_); }
+
+    if (ffRegion != nullptr)
+    {
+        if constexpr (std::is_trivially_copyable_v<T> && !is_specialization_of_v<T, TypedBuffer>)
+        {
+            return LoadFixedFieldElement<T>(*ffRegion, elementIndex_, handle_, rowOffset);
+        }
+        else { return GetFieldValue<T>(*handle_.field, elementIndex_); }
+    }
+
+    throw std::runtime_error("FieldArrayRecordView::GetFieldValue<T>(): record storage is not initialized");
+}
+
 // ---------------------------------------------------------------------------
 //! \class FieldArray
 //! \brief A lightweight, non-owning wrapper over either FIELD_ARRAY storage
@@ -1478,6 +2079,15 @@ class FieldArray
         return (*this)[index_].GetFieldValue<T>(field_, elementIndex_);
     }
 
+    // ---------------------------------------------------------------------------
+    //! \brief Get a field value through a handle resolved from the field info.
+    //! \see FieldArray::GetFieldValue
+    // ---------------------------------------------------------------------------
+    template <typename T> [[nodiscard]] T GetFieldValue(const FieldHandle& handle_, size_t index_, size_t elementIndex_ = 0) const
+    {
+        return (*this)[index_].GetFieldValue<T>(handle_, elementIndex_);
+    }
+
     // ---------------------------------------------------------------------------
     //! \brief Get a field value by its name.
     //! \see FieldArray::GetFieldValue
@@ -1532,6 +2142,146 @@ class FieldArray
     const FieldInfo* fieldInfo;
 };
 
+//! Load a fixed field's bytes into a FieldValueView, viewing a fixed-length array in place.
+inline FieldValueView LoadFieldView(const BaseField& fd_, const std::byte* fieldPtr_)
+{
+    if (fd_.type == FIELD_TYPE::FIXED_LENGTH_ARRAY)
+    {
+        const auto* arrayField = dynamic_cast<const ArrayField*>(&fd_);
+        if (arrayField == nullptr) { throw std::runtime_error("LoadFieldView(): missing fixed array metadata"); }
+        return LoadVariantImpl<FieldValueView>(fd_, [&](auto tag) { return TypedBuffer<decltype(tag)>{fieldPtr_, arrayField->arrayLength}; });
+    }
+    return LoadVariantImpl<FieldValueView>(fd_, [&](auto tag) { return LoadValueFromBuffer<decltype(tag)>(fieldPtr_); });
+}
+
+inline FieldValueView CompositeField::GetFieldValueView(const BaseField& field_) const
+{
+    switch (field_.type)
+    {
+    case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: [[fallthrough]];
+    case FIELD_TYPE::STRING: [[fallthrough]];
+    case FIELD_TYPE::FIELD_ARRAY: [[fallthrough]];
+    case FIELD_TYPE::RESPONSE_STR: {
+        if (field_.index >= varFields.size()) { throw std::runtime_error("GetFieldValueView(): var field index out of range"); }
+        const FieldValueVariant& value = varFields[field_.index];
+        return std::visit(
+            [&](const auto& value_) -> FieldValueView {
+                using ValueT = std::decay_t<decltype(value_)>;
+                if constexpr (std::is_same_v<ValueT, std::string>) { return std::string_view(value_); }
+                else if constexpr (std::is_same_v<ValueT, FlatFieldArray> || std::is_same_v<ValueT, CompositeFieldArray>)
+                {
+                    const auto* fieldArrayField = dynamic_cast<const FieldArrayField*>(&field_);
+                    return FieldArray(value, fieldArrayField != nullptr ? fieldArrayField->fieldInfo.get() : nullptr);
+                }
+                else if constexpr (is_specialization_of_v<ValueT, std::vector>)
+                {
+                    return TypedBuffer<typename ValueT::value_type>(reinterpret_cast<const std::byte*>(value_.data()), value_.size());
+                }
+                else { return value_; } // Scalars, and arrays borrowed by a view decode
+            },
+            value);
+    }
+    default: return LoadFieldView(field_, fixedFields.data() + field_.index);
+    }
+}
+
+inline CompositeField::const_iterator::reference CompositeField::const_iterator::operator*() const
+{
+    const auto& fieldDef = compField->fieldInfo->messageOrderedFields[index];
+    return {fieldDef, compField->GetFieldValueView(*fieldDef)};
+}
+
+inline FieldValueView FieldArrayRecordView::GetFieldValueView(const BaseField& field_) const
+{
+    if (cfRecord != nullptr) { return cfRecord->GetFieldValueView(field_); }
+    // Records of a FlatFieldArray only have fixed fields
+    if (ffRegion != nullptr) { return LoadFieldView(field_, ffRegion->data() + rowOffset + field_.index); }
+    throw std::runtime_error("FieldArrayRecordView::GetFieldValueView(): record storage is not initialized");
+}
+
+inline FieldArrayRecordView::const_iterator::reference FieldArrayRecordView::const_iterator::operator*() const
+{
+    const auto& fieldDef = record->fieldInfo->messageOrderedFields[index];
+    return {fieldDef, record->GetFieldValueView(*fieldDef)};
+}
+
+//============================================================================
+//! \class LazyCompositeField
+//! \brief A message body whose ASCII and JSON fields are decoded on first
+//! access.
+//
+//! MessageDecoderBase::DecodeLazy() only walks the tokens of an ASCII body to
+//! record where each top-level field starts. A field is converted the first
+//! time its value is requested and kept for later accesses. JSON bodies look
+//! up and convert a field on first access in the same way. Binary bodies are
+//! decoded in full, since their fields need no conversion.
+//
+//! A LazyCompositeField refers to the message buffer it was decoded from, so it
+//! must not be accessed after the buffer is released. A JSON body is parsed
+//! into a document of its own, unless the decoder has a JSON parser set (see
+//! MessageDecoderBase::SetJsonParser()). It then refers to the document of that
+//! parser and must not be accessed after the parser parses another message.
+//============================================================================
+class LazyCompositeField
+{
+  public:
+    //----------------------------------------------------------------------------
+    //! \brief Get the field info of the decoded message.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const FieldInfo::ConstPtr& GetFieldInfo() const { return clMyFields.GetFieldInfo(); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the value of a top-level field, decoding it if needed.
+    //
+    //! \param[in] field_ The field definition, from the field info of the message.
+    //! \param[in] elementIndex_ The element of an array field.
+    //! \return The value of the field.
+    //! \throw std::runtime_error if the field is not part of the message or its
+    //! token is malformed.
+    //----------------------------------------------------------------------------
+    template <typename T> [[nodiscard]] T GetFieldValue(const BaseField& field_, size_t elementIndex_ = 0) const
+    {
+        return DecodeField(field_).GetFieldValue<T>(field_, elementIndex_);
+    }
+
+    template <typename T> [[nodiscard]] T GetFieldValueByName(const std::string& name_, size_t elementIndex_ = 0) const
+    {
+        const FieldInfo::ConstPtr& fieldInfo = clMyFields.GetFieldInfo();
+        if (fieldInfo == nullptr) { throw std::runtime_error("LazyCompositeField::GetFieldValueByName(): field info is not set"); }
+        const auto field = fieldInfo->GetFieldDefByName(name_);
+        if (field == nullptr) { throw std::runtime_error("LazyCompositeField::GetFieldValueByName(): field not found: " + name_); }
+        return GetFieldValue<T>(*field, elementIndex_);
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Check if a top-level field has been decoded.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool IsFieldDecoded(const BaseField& field_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode the remaining fields.
+    //
+    //! \return The fully decoded message body, e.g. to be encoded.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const CompositeField& GetCompositeField() const;
+
+  private:
+    friend class MessageDecoderBase;
+
+    [[nodiscard]] size_t FindOp(const BaseField& field_) const;
+    const CompositeField& DecodeField(const BaseField& field_) const;
+
+    const MessageDecoderBase* pclMyDecoder{nullptr};
+    DecodePlan::ConstPtr pclMyPlan;
+    HEADER_FORMAT eMyFormat{HEADER_FORMAT::UNKNOWN};
+    const char* pcMyBufEnd{nullptr};
+    std::vector<const char*> vMyFieldStarts; // Start of the ASCII token of each op, nullptr after an early end of message
+    JsonMessageParser::Ptr pclMyJsonParser; // Owner of the document of clMyJsonBody
+    simdjson::dom::element clMyJsonBody;
+    mutable std::vector<uint8_t> vMyDecoded; // Whether each op has been decoded into clMyFields
+    mutable CompositeField clMyFields;
+};
+
 //============================================================================
 //! \class MessageDecoderBase
 //! \brief Class to decode messages.
@@ -1550,26 +2300,184 @@ class MessageDecoderBase
 
     std::string sMyExpectedMessageFamily;
 
+    JsonMessageParser::Ptr pclMyJsonParser{nullptr};
+
     std::function<size_t(const size_t, const uintptr_t, const uintptr_t)> fMyAlignmentFunc = MessageDatabase::NoAlign;
+    size_t (*pfMyAlignmentFunc)(size_t, uintptr_t, uintptr_t){nullptr}; // fMyAlignmentFunc if it is a plain function
+    bool bMyAligned{false};                                             // fMyAlignmentFunc is not MessageDatabase::NoAlign
+    bool bMyViewDecoding{false};                                        // Binary payloads are borrowed from the message
+
+    // Fields to decode by message name
+    std::unordered_map<std::string, std::vector<std::string>> mMyProjections;
 
+    // Plans of the messages of the database bound to the converters, and their projections, by field info.
+    // They are only written by BindFieldConverters() and the projection setters, so decoding never modifies them.
+    struct BoundPlan
+    {
+        FieldInfo::ConstPtr fieldInfo;
+        DecodePlan::ConstPtr basePlan; // Plan of fieldInfo that was bound, to detect that its caches were invalidated
+        DecodePlan::ConstPtr plan;
+        DecodePlan::ConstPtr projectedPlan; // nullptr if the message is not projected
+    };
+    std::unordered_map<const FieldInfo*, BoundPlan> mMyBoundPlans;
+
+    // Plans of the field infos that BindFieldConverters() did not bind, e.g. of messages added to the database since
+    // or whose caches were invalidated, bound on first use. They are written while decoding, so under the mutex.
+    struct LateBoundPlans
+    {
+        std::mutex mutex;
+        std::unordered_map<const FieldInfo*, BoundPlan> plans;
+
+        LateBoundPlans() = default;
+        LateBoundPlans(const LateBoundPlans&) {} // A copied decoder binds its own plans
+        LateBoundPlans& operator=(const LateBoundPlans&)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            plans.clear();
+            return *this;
+        }
+    };
+    mutable LateBoundPlans stMyLateBoundPlans;
+
+    friend class LazyCompositeField;
+
+  protected:
+    using AsciiFieldConverter = novatel::edie::AsciiFieldConverter;
+    using JsonFieldConverter = novatel::edie::JsonFieldConverter;
+
+  private:
     // Enum util functions
     void InitEnumDefinitions();
     void InitFieldMaps();
 
+    //----------------------------------------------------------------------------
+    //! \brief Copy a plan, and the plans of its FIELD_ARRAY elements, with the
+    //! converters of asciiFieldMap and jsonFieldMap set in their ops.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] DecodePlan::ConstPtr BindDecodePlan(const DecodePlan& stPlan_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the bound plans of a field info of the database.
+    //
+    //! \return The bound plans, nullptr if the field info is not in the
+    //! database or its caches were invalidated since it was bound.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const BoundPlan* FindBoundPlan(const FieldInfo& fieldInfo_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the bound plans of a field info that has none in the
+    //! database, binding them if they are not bound yet or are out of date.
+    //
+    //! \return A copy of the bound plans, which stays valid if they are rebound.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] BoundPlan GetLateBoundPlan(const FieldInfo& fieldInfo_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Project the bound plan of a field info that has none in the
+    //! database if its message is projected.
+    //
+    //! \return The projected plan, nullptr if the message is not projected.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] DecodePlan::ConstPtr ProjectLateBoundPlan(const FieldInfo& fieldInfo_, const DecodePlan& stPlan_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Drop the late bound plans, so they are bound again on next use.
+    //----------------------------------------------------------------------------
+    void ClearLateBoundPlans();
+
+    //----------------------------------------------------------------------------
+    //! \brief Find the definition of the message body described by the metadata.
+    //
+    //! \return SUCCESS, or the error code Decode() returns when there is none.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS FindMessageDefinition(const unsigned char* pucMessage_, MetaDataBase& stMetaData_,
+                                               MessageDefinition::ConstPtr& pclMsgDef_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode one op of a message decoded by DecodeLazy().
+    //----------------------------------------------------------------------------
+    void DecodeLazyField(const LazyCompositeField& stMessage_, size_t uiOp_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Project the bound plans of the projected messages of the
+    //! database.
+    //----------------------------------------------------------------------------
+    void CompileProjectedPlans();
+
   protected:
     MessageDatabase::Ptr pclMyMsgDb{nullptr};
 
-    std::unordered_map<uint32_t, std::function<void(CompositeField&, const BaseField&, const char**, size_t, size_t, bool, MessageDatabase&)>>
-        asciiFieldMap;
-    std::unordered_map<uint32_t, std::function<void(CompositeField&, const BaseField&, simdjson::dom::element, size_t, bool, MessageDatabase&)>>
-        jsonFieldMap;
+    // Converters by conversion hash. Derived decoders may extend these in their constructor, see DeferBinding.
+    std::unordered_map<uint32_t, AsciiFieldConverter> asciiFieldMap;
+    std::unordered_map<uint32_t, JsonFieldConverter> jsonFieldMap;
 
-    [[nodiscard]] STATUS DecodeBinary(const FieldInfo& vMsgDefFields_, const unsigned char** ppucLogBuf_, CompositeField& clCompField_,
+    //----------------------------------------------------------------------------
+    //! \brief Bind the plans of the messages of the database, and their
+    //! projections, to the converters of asciiFieldMap and jsonFieldMap.
+    //
+    //! Called by the constructor and LoadJsonDb(). Derived decoders that change
+    //! the maps after construction must call it again afterwards.
+    //----------------------------------------------------------------------------
+    void BindFieldConverters();
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the plan of a field info bound to the converters.
+    //
+    //! \details A field info without a bound plan, e.g. one built outside the
+    //! database, is bound on first use.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] DecodePlan::ConstPtr GetBoundPlan(const FieldInfo& fieldInfo_) const;
+
+    [[nodiscard]] STATUS DecodeBinary(const DecodePlan& stPlan_, const unsigned char** ppucLogBuf_, CompositeField& clCompField_,
                                       uint32_t uiMessageLength_) const;
     template <bool Abbreviated>
-    [[nodiscard]] STATUS DecodeAscii(const FieldInfo& vMsgDefFields_, const char** ppcLogBuf_, CompositeField& clCompField_,
+    [[nodiscard]] STATUS DecodeAscii(const DecodePlan& stPlan_, const char** ppcLogBuf_, CompositeField& clCompField_,
                                      const char* pcBufEnd = nullptr) const;
-    [[nodiscard]] STATUS DecodeJson(const FieldInfo& vMsgDefFields_, simdjson::dom::element jsonData, CompositeField& clCompField_) const;
+    [[nodiscard]] STATUS DecodeJson(const DecodePlan& stPlan_, simdjson::dom::element jsonData, CompositeField& clCompField_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode the ops of a plan from an ASCII body.
+    //
+    //! \details With Skip, the tokens are walked without being converted and
+    //! pclCompField_ may be null. If pvFieldStarts_ is provided, the start of
+    //! the token of each op is appended to it. Token lengths are looked up in
+    //! clIndex_, which should cover the body up to pcBufEnd_.
+    //----------------------------------------------------------------------------
+    template <bool Abbreviated, bool Skip>
+    [[nodiscard]] STATUS DecodeAsciiOps(const DecodePlan& stPlan_, const char** ppcLogBuf_, CompositeField* pclCompField_, const char* pcBufEnd_,
+                                        const DelimiterIndex& clIndex_, std::vector<const char*>* pvFieldStarts_ = nullptr) const;
+    template <bool Abbreviated, bool Skip>
+    [[nodiscard]] STATUS DecodeAsciiOp(const DecodeOp& stOp_, const char** ppcLogBuf_, CompositeField* pclCompField_, const char* pcBufEnd_,
+                                       const DelimiterIndex& clIndex_, bool& bEarlyEndOfMessage_) const;
+    [[nodiscard]] STATUS DecodeJsonOp(const DecodeOp& stOp_, simdjson::dom::element jsonData, CompositeField& clCompField_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Advance over a field of a binary body without decoding it.
+    //
+    //! \details clCompField_ is only read for the length of an array given by
+    //! arrayLengthRef, so records must be skipped with SkipBinary() only if
+    //! they have no such arrays.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS SkipBinaryOp(const DecodeOp& stOp_, const unsigned char* pucTempStart_, const unsigned char** ppucLogBuf_,
+                                      const CompositeField& clCompField_, uint32_t uiMessageLength_) const;
+    [[nodiscard]] STATUS SkipBinary(const DecodePlan& stPlan_, const unsigned char** ppucLogBuf_, const CompositeField& clCompField_,
+                                    uint32_t uiMessageLength_) const;
+
+    [[nodiscard]] STATUS DecodeBinary(const FieldInfo& vMsgDefFields_, const unsigned char** ppucLogBuf_, CompositeField& clCompField_,
+                                      uint32_t uiMessageLength_) const
+    {
+        return DecodeBinary(*GetBoundPlan(vMsgDefFields_), ppucLogBuf_, clCompField_, uiMessageLength_);
+    }
+    template <bool Abbreviated>
+    [[nodiscard]] STATUS DecodeAscii(const FieldInfo& vMsgDefFields_, const char** ppcLogBuf_, CompositeField& clCompField_,
+                                     const char* pcBufEnd = nullptr) const
+    {
+        return DecodeAscii<Abbreviated>(*GetBoundPlan(vMsgDefFields_), ppcLogBuf_, clCompField_, pcBufEnd);
+    }
+    [[nodiscard]] STATUS DecodeJson(const FieldInfo& vMsgDefFields_, simdjson::dom::element jsonData, CompositeField& clCompField_) const
+    {
+        return DecodeJson(*GetBoundPlan(vMsgDefFields_), jsonData, clCompField_);
+    }
 
     template <bool Fixed = true>
     static void DecodeBinaryField(const BaseField& pstMessageDataType_, const unsigned char** ppucLogBuf_, CompositeField& clCompField_,
@@ -1579,6 +2487,30 @@ class MessageDecoderBase
     void DecodeJsonField(const BaseField& field_, simdjson::dom::element clJsonField_, CompositeField& clCompField_, size_t elementIndex_ = 0,
                          bool fixed_ = true) const;
 
+    //----------------------------------------------------------------------------
+    //! \brief Decode a field of a bound plan with the converter of its op.
+    //
+    //! \throw std::runtime_error if there is no converter for its conversion string.
+    //----------------------------------------------------------------------------
+    void DecodeAsciiField(const DecodeOp& stOp_, const char** ppcToken_, const size_t tokenLength_, CompositeField& clCompField_,
+                          const size_t elementIndex_ = 0, const bool fixed_ = true) const
+    {
+        if (stOp_.asciiConverter == nullptr) { throw std::runtime_error("DecodeAsciiField(): Unknown field type\n"); }
+        stOp_.asciiConverter(clCompField_, *stOp_.field, ppcToken_, tokenLength_, elementIndex_, fixed_, *pclMyMsgDb);
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode a field of a bound plan with the converter of its op.
+    //
+    //! \throw std::runtime_error if there is no converter for its conversion string.
+    //----------------------------------------------------------------------------
+    void DecodeJsonField(const DecodeOp& stOp_, simdjson::dom::element clJsonField_, CompositeField& clCompField_, const size_t elementIndex_ = 0,
+                         const bool fixed_ = true) const
+    {
+        if (stOp_.jsonConverter == nullptr) { throw std::runtime_error("DecodeJsonField(): Unknown field type\n"); }
+        stOp_.jsonConverter(clCompField_, *stOp_.field, clJsonField_, elementIndex_, fixed_, *pclMyMsgDb);
+    }
+
     //----------------------------------------------------------------------------
     //! \brief Add padding after string fields if necessary to maintain alignment.
     //
@@ -1591,6 +2523,24 @@ class MessageDecoderBase
     //----------------------------------------------------------------------------
     virtual void AddStringFieldPadding([[maybe_unused]] const unsigned char* start, [[maybe_unused]] const unsigned char** ptr) const { return; }
 
+    //----------------------------------------------------------------------------
+    //! \brief Get the padding before a field of the given type length.
+    //
+    //! \param[in] typeLength_ The length of the field type.
+    //! \param[in] start_ The starting pointer of the binary buffer.
+    //! \param[in] ptr_ The current buffer pointer.
+    //
+    //! \return The number of padding bytes.
+    //----------------------------------------------------------------------------
+    size_t Align(const size_t typeLength_, const unsigned char* start_, const unsigned char* ptr_) const
+    {
+        if (!bMyAligned) { return 0; }
+
+        const auto uiStart = reinterpret_cast<uintptr_t>(start_);
+        const auto uiPtr = reinterpret_cast<uintptr_t>(ptr_);
+        return pfMyAlignmentFunc != nullptr ? pfMyAlignmentFunc(typeLength_, uiStart, uiPtr) : fMyAlignmentFunc(typeLength_, uiStart, uiPtr);
+    }
+
     // -------------------------------------------------------------------------------------------------------
     template <bool Fixed = true, typename T = int32_t, int R = 10>
     static void ParseAndEmplace(CompositeField& clCompField_, const BaseField& field_, const char* token, size_t tokenLength,
@@ -1613,8 +2563,7 @@ class MessageDecoderBase
     }
 
     // -------------------------------------------------------------------------------------------------------
-    template <typename T, int R = 10>
-    static std::function<void(CompositeField&, const BaseField&, const char**, size_t, size_t, bool, MessageDatabase&)> SimpleAsciiMapEntry()
+    template <typename T, int R = 10> static AsciiFieldConverter SimpleAsciiMapEntry()
     {
         static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>, "Template argument must be integral or float");
 
@@ -1651,8 +2600,7 @@ class MessageDecoderBase
     }
 
     // -------------------------------------------------------------------------------------------------------
-    template <typename T>
-    static std::function<void(CompositeField&, const BaseField&, simdjson::dom::element, size_t, bool, MessageDatabase&)> SimpleJsonMapEntry()
+    template <typename T> static JsonFieldConverter SimpleJsonMapEntry()
     {
         return [](CompositeField& vIntermediate_, const BaseField& pstMessageDataType_, simdjson::dom::element clJsonField_,
                   const size_t elementIndex_, const bool fixed_, [[maybe_unused]] MessageDatabase& pclMsgDb_) {
@@ -1670,7 +2618,7 @@ class MessageDecoderBase
             if (!(lenBytes == 1 || lenBytes == 2 || lenBytes == 4))
                 throw std::runtime_error("GetArrayLength: Unsupported length size; must be 1,2 or 4");
 
-            *ppucLogBuf_ += fMyAlignmentFunc(lenBytes, reinterpret_cast<uintptr_t>(pucTempStart), reinterpret_cast<uintptr_t>(*ppucLogBuf_));
+            *ppucLogBuf_ += Align(lenBytes, pucTempStart, *ppucLogBuf_);
 
             uint32_t uiArrayLength = 0;
             for (std::size_t i = 0; i < lenBytes; ++i) { uiArrayLength |= static_cast<uint32_t>((*ppucLogBuf_)[i]) << (8 * i); }
@@ -1721,6 +2669,28 @@ class MessageDecoderBase
         return msgDef;
     }
 
+    //! Selects the constructor that does not bind the converters.
+    struct DeferBinding
+    {
+    };
+
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for derived decoders that extend the converter maps.
+    //
+    //! \details The plans are left unbound, so the derived constructor must call
+    //! BindFieldConverters() once it has filled in asciiFieldMap and jsonFieldMap.
+    //----------------------------------------------------------------------------
+    MessageDecoderBase(DeferBinding, std::string expectedMessageFamily_, MessageDatabase::Ptr pclMessageDb_,
+                       std::function<size_t(const size_t, const uintptr_t, const uintptr_t)> fAlignmentFunc_)
+        : sMyExpectedMessageFamily(std::move(expectedMessageFamily_)), fMyAlignmentFunc(std::move(fAlignmentFunc_)),
+          pclMyMsgDb(std::move(pclMessageDb_))
+    {
+        const auto* pfNoAlign = fMyAlignmentFunc.target<decltype(&MessageDatabase::NoAlign)>();
+        bMyAligned = pfNoAlign == nullptr || *pfNoAlign != &MessageDatabase::NoAlign;
+        if (const auto* pfAlignmentFunc = fMyAlignmentFunc.target<decltype(pfMyAlignmentFunc)>()) { pfMyAlignmentFunc = *pfAlignmentFunc; }
+        InitFieldMaps();
+    }
+
   public:
     //----------------------------------------------------------------------------
     //! \brief A constructor for the MessageDecoderBase class.
@@ -1730,11 +2700,9 @@ class MessageDecoderBase
     //----------------------------------------------------------------------------
     MessageDecoderBase(std::string expectedMessageFamily_, MessageDatabase::Ptr pclMessageDb_ = nullptr,
                        std::function<size_t(const size_t, const uintptr_t, const uintptr_t)> fAlignmentFunc_ = MessageDatabase::NoAlign)
-        : sMyExpectedMessageFamily(std::move(expectedMessageFamily_)), fMyAlignmentFunc(std::move(fAlignmentFunc_)),
-          pclMyMsgDb(std::move(pclMessageDb_))
+        : MessageDecoderBase(DeferBinding{}, std::move(expectedMessageFamily_), std::move(pclMessageDb_), std::move(fAlignmentFunc_))
     {
-        InitFieldMaps();
-        if (pclMessageDb_ != nullptr) { LoadJsonDb(std::move(pclMessageDb_)); }
+        BindFieldConverters();
     }
 
     virtual ~MessageDecoderBase() = default;
@@ -1767,6 +2735,70 @@ class MessageDecoderBase
     // ---------------------------------------------------------------------------
     MessageDatabase::ConstPtr MessageDb() const { return std::const_pointer_cast<const MessageDatabase>(pclMyMsgDb); }
 
+    //----------------------------------------------------------------------------
+    //! \brief Set the parser used to decode JSON messages.
+    //
+    //! \details By default each JSON message is parsed with a parser of its own.
+    //! Setting a parser reuses its buffers between messages, and sharing it with
+    //! a header decoder lets a JSON message be parsed once for both its header
+    //! and its body. A decoder with a parser set is not reentrant: Decode() and
+    //! DecodeLazy() must not be called concurrently, even though they are const.
+    //
+    //! \param[in] pclJsonParser_ The JSON message parser, or nullptr to parse
+    //! each message with a parser of its own.
+    //----------------------------------------------------------------------------
+    void SetJsonParser(JsonMessageParser::Ptr pclJsonParser_) { pclMyJsonParser = std::move(pclJsonParser_); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the parser used to decode JSON messages.
+    //
+    //! \return A shared pointer to the JSON message parser, or nullptr if none
+    //! is set.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const JsonMessageParser::Ptr& GetJsonParser() const { return pclMyJsonParser; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Enable or disable view decoding of binary messages.
+    //
+    //! \details In view decoding, the decoded CompositeField borrows from the
+    //! message buffer instead of copying it. The fixed fields of a message
+    //! without variable-length fields, flat FIELD_ARRAYs and variable-length
+    //! arrays of primitives (as TypedBuffer<T>) all point into the buffer, so
+    //! decoding costs O(fields) rather than O(bytes). The buffer must outlive
+    //! the CompositeField, or CompositeField::TakeOwnership() must be called
+    //! first. ASCII and JSON messages are always decoded into owned storage.
+    //
+    //! \param[in] bViewDecoding_ true to borrow binary payloads from the message.
+    //----------------------------------------------------------------------------
+    void SetViewDecoding(bool bViewDecoding_) { bMyViewDecoding = bViewDecoding_; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get whether binary messages are decoded as views of the message.
+    //
+    //! \return true if view decoding is enabled.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] bool GetViewDecoding() const { return bMyViewDecoding; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode only some of the fields of a message.
+    //
+    //! \details The other top-level fields of the message are skipped without
+    //! being converted or copied, and are marked absent in the decoded
+    //! CompositeField (see CompositeField::IsFieldPresent()). Absent strings,
+    //! arrays and field arrays are empty, so the message can still be encoded.
+    //! Fields that give the length of an array are always decoded. A message
+    //! added to the database later is projected as well.
+    //
+    //! \param[in] messageName_ The name of the message, e.g. "BESTPOS".
+    //! \param[in] fieldNames_ The names of the top-level fields to decode.
+    //----------------------------------------------------------------------------
+    void SetProjection(const std::string& messageName_, std::vector<std::string> fieldNames_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode all fields of every message again.
+    //----------------------------------------------------------------------------
+    void ClearProjections();
+
     //----------------------------------------------------------------------------
     //! \brief Decode a message payload from the provided frame.
     //
@@ -1778,6 +2810,8 @@ class MessageDecoderBase
     //! \remark Note, that pucMessage_ must not point to the message header,
     //! rather the message payload. This can be done by advancing the pointer
     //! of a message frame by stMetaData.uiHeaderLength.
+    //! \remark Decode() is reentrant unless a JSON parser has been set with
+    //! SetJsonParser().
     //! \return An error code describing the result of decoding.
     //!   SUCCESS: The operation was successful.
     //!   NULL_PROVIDED: pucMessage_ is a null pointer.
@@ -1789,6 +2823,24 @@ class MessageDecoderBase
     //!   UNKNOWN: The header format provided is not known.
     //----------------------------------------------------------------------------
     [[nodiscard]] STATUS Decode(const unsigned char* pucMessage_, CompositeField& stInterMessage_, MetaDataBase& stMetaData_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode a message payload, deferring the conversion of its fields
+    //! until they are accessed.
+    //
+    //! \param[in] pucMessage_ A pointer to a message payload, which must
+    //! outlive stMessage_.
+    //! \param[out] stMessage_ The LazyCompositeField to be populated.
+    //! \param[in, out] stMetaData_ MetaDataStruct to provide information about
+    //! the frame and be fully populated to help describe the decoded log.
+    //
+    //! \return An error code describing the result of decoding, as Decode().
+    //! A malformed ASCII token is only detected here if it breaks the
+    //! tokenization, otherwise accessing its field throws.
+    //! \remark DecodeLazy() is reentrant unless a JSON parser has been set with
+    //! SetJsonParser().
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS DecodeLazy(const unsigned char* pucMessage_, LazyCompositeField& stMessage_, MetaDataBase& stMetaData_) const;
 };
 
 } // namespace novatel::edie
@@ -0,0 +1,296 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file message_view.hpp
+// ===============================================================================
+
+#ifndef MESSAGE_VIEW_HPP
+#define MESSAGE_VIEW_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "novatel_edie/decoders/common/common.hpp"
+#include "novatel_edie/decoders/common/message_database.hpp"
+#include "novatel_edie/decoders/common/message_decoder.hpp"
+
+namespace novatel::edie {
+
+//-----------------------------------------------------------------------
+//! \struct FixedFieldSpec
+//! \brief Where a generated layout expects one of its fixed fields to be.
+//-----------------------------------------------------------------------
+struct FixedFieldSpec
+{
+    size_t position;    //!< Position of the field in FieldInfo::messageOrderedFields.
+    size_t offset;      //!< Byte offset of the field in the fixed fields.
+    size_t elementSize; //!< Length of the data type of the field.
+    size_t count;       //!< Array length of a fixed-length array, 1 otherwise.
+};
+
+// ---------------------------------------------------------------------------
+//! \brief Check that the offsets of a generated layout follow from the sizes
+//!     of its fixed fields, laid out as by BuildFieldInfo().
+//!
+//! \param[in] fields_ The fixed fields of the layout, in message order.
+//! \param[in] maxAlignment_ The largest alignment of a fixed field in the
+//!     message family, 1 if fields are packed.
+//! \param[in] fixedFieldBytes_ The size of the fixed fields of the layout.
+//! \return true if every offset and the total size match.
+// ---------------------------------------------------------------------------
+template <size_t N> constexpr bool IsFixedFieldLayout(const std::array<FixedFieldSpec, N>& fields_, size_t maxAlignment_, size_t fixedFieldBytes_)
+{
+    size_t offset = 0;
+    for (const FixedFieldSpec& field : fields_)
+    {
+        const size_t alignment = field.elementSize < maxAlignment_ ? field.elementSize : maxAlignment_;
+        if (alignment > 1 && offset % alignment != 0) { offset += alignment - (offset % alignment); }
+        if (field.offset != offset) { return false; }
+        offset += field.elementSize * field.count;
+    }
+    return offset == fixedFieldBytes_;
+}
+
+// ---------------------------------------------------------------------------
+//! \brief Check that field definitions are the ones a layout was generated
+//!     from: same number of fields, same fixed field offsets and size.
+//!
+//! \tparam Layout The generated layout.
+//! \param[in] fieldInfo_ The field definitions of a decoded message or record.
+//! \return true if the layout can read fields described by fieldInfo_.
+// ---------------------------------------------------------------------------
+template <typename Layout> [[nodiscard]] bool MatchesLayout(const FieldInfo* fieldInfo_)
+{
+    if (fieldInfo_ == nullptr || fieldInfo_->fixedFieldBytes != Layout::fixedFieldBytes ||
+        fieldInfo_->messageOrderedFields.size() != Layout::fieldCount)
+    {
+        return false;
+    }
+
+    for (const FixedFieldSpec& stField : Layout::fixedFields)
+    {
+        const BaseField::ConstPtr& pclField = fieldInfo_->messageOrderedFields[stField.position];
+        if (pclField == nullptr || pclField->index != stField.offset || pclField->dataType.length != stField.elementSize) { return false; }
+    }
+    return true;
+}
+
+template <typename Layout> class MessageView;
+template <typename Layout> class FieldArrayView;
+
+//============================================================================
+//! \class FieldView
+//! \brief Base of the layouts generated by scripts/gen_message_views.py.
+//!
+//! A layout is a struct deriving from FieldView<Layout> with one accessor per
+//! field. Fixed fields are read with a copy from an offset known at compile
+//! time. Strings, variable-length arrays and field arrays are read from the
+//! record by their position. A layout is bound to a message by MessageView and
+//! to a field array record by FieldArrayView.
+//============================================================================
+template <typename Layout> class FieldView
+{
+  public:
+    //----------------------------------------------------------------------------
+    //! \brief Get the fixed fields the layout reads from.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const std::byte* data() const { return pcData; }
+
+  protected:
+    template <typename T, size_t Offset> [[nodiscard]] T Load() const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "FieldView::Load() only supports trivially copyable types");
+        static_assert(Offset + sizeof(T) <= Layout::fixedFieldBytes, "FieldView::Load(): field lies outside the fixed fields of the layout");
+        T value;
+        std::memcpy(&value, pcData + Offset, sizeof(T));
+        return value;
+    }
+
+    template <typename T, size_t Offset, size_t Length> [[nodiscard]] TypedBuffer<T> LoadArray() const
+    {
+        static_assert(Offset + (Length * sizeof(T)) <= Layout::fixedFieldBytes,
+                      "FieldView::LoadArray(): field lies outside the fixed fields of the layout");
+        return TypedBuffer<T>(pcData + Offset, Length);
+    }
+
+    template <typename T, size_t Position> [[nodiscard]] T Get() const
+    {
+        static_assert(Position < Layout::fieldCount, "FieldView::Get(): field position outside the layout");
+        return pclRecord->template GetFieldValue<T>(*pclFieldInfo->messageOrderedFields[Position]);
+    }
+
+    template <typename Row, size_t Position> [[nodiscard]] FieldArrayView<Row> GetFieldArray() const
+    {
+        static_assert(Position < Layout::fieldCount, "FieldView::GetFieldArray(): field position outside the layout");
+        const auto& clField = static_cast<const FieldArrayField&>(*pclFieldInfo->messageOrderedFields[Position]);
+        return FieldArrayView<Row>(pclRecord->GetVarFields()[clField.index], clField.fieldInfo.get());
+    }
+
+  private:
+    template <typename> friend class MessageView;
+    template <typename> friend class FieldArrayView;
+
+    void Bind(const std::byte* pcData_, const CompositeField* pclRecord_, const FieldInfo* pclFieldInfo_)
+    {
+        pcData = pcData_;
+        pclRecord = pclRecord_;
+        pclFieldInfo = pclFieldInfo_;
+    }
+
+    const std::byte* pcData{nullptr};
+    const CompositeField* pclRecord{nullptr}; // nullptr for the records of a FlatFieldArray
+    const FieldInfo* pclFieldInfo{nullptr};
+};
+
+//============================================================================
+//! \class MessageView
+//! \brief A generated layout bound to a decoded message, e.g.
+//!     MessageView<BESTPOS>.
+//!
+//! Binding checks the message ID and message definition CRC of the message
+//! against the layout, and that its field definitions match the layout. The
+//! view borrows the message, which must outlive it.
+//============================================================================
+template <typename Layout> class MessageView : public Layout
+{
+  public:
+    // ---------------------------------------------------------------------------
+    //! \brief Bind the layout to a decoded message.
+    //!
+    //! \param[in] message_ The decoded message body.
+    //! \param[in] stMetaData_ The metadata of the message.
+    //! \throws std::runtime_error if the message was not decoded with the
+    //!     message definition the layout was generated from.
+    // ---------------------------------------------------------------------------
+    MessageView(const CompositeField& message_, const MetaDataBase& stMetaData_)
+    {
+        if (!CanBind(message_, stMetaData_))
+        {
+            throw std::runtime_error("MessageView<" + std::string(Layout::messageName) + ">(): message does not match the generated layout");
+        }
+        static_cast<FieldView<Layout>&>(*this).Bind(message_.GetFixedFields().data(), &message_, message_.GetFieldInfo().get());
+    }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Check if a decoded message can be bound to the layout.
+    //!
+    //! \param[in] message_ The decoded message body.
+    //! \param[in] stMetaData_ The metadata of the message.
+    //! \return true if the message ID, the message definition CRC and the field
+    //!     definitions of the message match the layout.
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] static bool CanBind(const CompositeField& message_, const MetaDataBase& stMetaData_)
+    {
+        if (stMetaData_.bResponse || stMetaData_.usMessageId != Layout::messageId || stMetaData_.uiMessageCrc != Layout::messageCrc)
+        {
+            return false;
+        }
+        return MatchesLayout<Layout>(message_.GetFieldInfo().get()) && message_.GetFixedFields().size() >= Layout::fixedFieldBytes;
+    }
+};
+
+//============================================================================
+//! \class FieldArrayView
+//! \brief The records of a field array, read through a generated layout.
+//!
+//! Works over either FIELD_ARRAY storage representation. The view borrows the
+//! field array, which must outlive it.
+//============================================================================
+template <typename Row> class FieldArrayView
+{
+  public:
+    // ---------------------------------------------------------------------------
+    //! \param[in] fieldArray_ The FlatFieldArray or CompositeFieldArray value.
+    //! \param[in] fieldInfo_ The field definitions of the records.
+    //! \throws std::runtime_error if the records do not match the layout.
+    // ---------------------------------------------------------------------------
+    FieldArrayView(const FieldValueVariant& fieldArray_, const FieldInfo* fieldInfo_)
+        : pclFlat(std::get_if<FlatFieldArray>(&fieldArray_)), pclComposite(std::get_if<CompositeFieldArray>(&fieldArray_)), pclFieldInfo(fieldInfo_)
+    {
+        if (pclFlat == nullptr && pclComposite == nullptr)
+        {
+            throw std::runtime_error("FieldArrayView(): underlying storage is not a FlatFieldArray or CompositeFieldArray");
+        }
+        if (!MatchesLayout<Row>(fieldInfo_)) { throw std::runtime_error("FieldArrayView(): records do not match the generated layout"); }
+    }
+
+    [[nodiscard]] size_t size() const { return pclFlat != nullptr ? pclFlat->size() : pclComposite->size(); }
+
+    [[nodiscard]] bool empty() const { return size() == 0; }
+
+    [[nodiscard]] Row operator[](size_t index_) const
+    {
+        if (index_ >= size()) { throw std::runtime_error("FieldArrayView::operator[](): index out of bounds"); }
+
+        Row clRow;
+        auto& clView = static_cast<FieldView<Row>&>(clRow);
+        if (pclFlat != nullptr) { clView.Bind(pclFlat->data() + (index_ * Row::fixedFieldBytes), nullptr, pclFieldInfo); }
+        else
+        {
+            const CompositeField& clRecord = (*pclComposite)[index_];
+            clView.Bind(clRecord.GetFixedFields().data(), &clRecord, pclFieldInfo);
+        }
+        return clRow;
+    }
+
+    struct const_iterator
+    {
+        using value_type = Row;
+        using reference = value_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        const FieldArrayView* fieldArray;
+        size_t index;
+
+        const_iterator(const FieldArrayView* fieldArray_, size_t index_ = 0) : fieldArray(fieldArray_), index(index_) {}
+
+        reference operator*() const { return (*fieldArray)[index]; }
+
+        const_iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        bool operator==(const const_iterator& other) const { return fieldArray == other.fieldArray && index == other.index; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+    };
+
+    [[nodiscard]] const_iterator begin() const { return const_iterator(this); }
+    [[nodiscard]] const_iterator end() const { return const_iterator(this, size()); }
+
+  private:
+    const FlatFieldArray* pclFlat;
+    const CompositeFieldArray* pclComposite;
+    const FieldInfo* pclFieldInfo;
+};
+
+} // namespace novatel::edie
+
+#endif // MESSAGE_VIEW_HPP
@@ -0,0 +1,358 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file columnar_batch_decoder.hpp
+// ===============================================================================
+
+#ifndef NOVATEL_COLUMNAR_BATCH_DECODER_HPP
+#define NOVATEL_COLUMNAR_BATCH_DECODER_HPP
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "novatel_edie/common/logger.hpp"
+#include "novatel_edie/decoders/common/common.hpp"
+#include "novatel_edie/decoders/common/message_database.hpp"
+#include "novatel_edie/decoders/common/message_decoder.hpp"
+#include "novatel_edie/decoders/oem/common.hpp"
+#include "novatel_edie/decoders/oem/header_decoder.hpp"
+#include "novatel_edie/decoders/oem/message_decoder.hpp"
+
+namespace novatel::edie::oem {
+
+//============================================================================
+//! \class Column
+//! \brief The values of one field for every row of a ColumnarTable, stored
+//! contiguously as the C++ type of the field.
+//!
+//! BOOL fields are stored as uint8_t and enums as the signed integer of their
+//! width. A fixed-length array stores GetWidth() values per row. A
+//! variable-length array stores the values of every row back to back, and
+//! the values of row r are [GetOffsets()[r], GetOffsets()[r + 1]).
+//============================================================================
+class Column
+{
+  public:
+    using Values = std::variant<std::vector<int8_t>, std::vector<uint8_t>, std::vector<int16_t>, std::vector<uint16_t>, std::vector<int32_t>,
+                                std::vector<uint32_t>, std::vector<int64_t>, std::vector<uint64_t>, std::vector<float>, std::vector<double>,
+                                std::vector<std::string>>;
+
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for the Column class.
+    //
+    //! \param[in] strName_ The name of the field.
+    //! \param[in] pclField_ The definition of the field. Field arrays are not
+    //! columns, their fields are.
+    //----------------------------------------------------------------------------
+    Column(std::string strName_, BaseField::ConstPtr pclField_);
+
+    //! \brief Get the name of the field.
+    [[nodiscard]] const std::string& GetName() const { return strMyName; }
+
+    //! \brief Get the definition of the field, from the latest message definition.
+    [[nodiscard]] const BaseField& GetFieldDef() const { return *pclMyField; }
+
+    //! \brief Get the number of values per row, 1 for a scalar and 0 for a variable-length array.
+    [[nodiscard]] size_t GetWidth() const { return uiMyWidth; }
+
+    //! \brief Get the offsets of the rows of a variable-length array, empty for other fields.
+    [[nodiscard]] const std::vector<size_t>& GetOffsets() const { return vMyOffsets; }
+
+    //! \brief Get the number of values in the column.
+    [[nodiscard]] size_t size() const
+    {
+        return std::visit([](const auto& vValues_) { return vValues_.size(); }, vMyValues);
+    }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Get the values of the column.
+    //!
+    //! \tparam T The type of the values: the C++ type of the field, uint8_t for
+    //!     a BOOL or std::string for a STRING.
+    //! \return The values, in row order.
+    // ---------------------------------------------------------------------------
+    template <typename T> [[nodiscard]] const std::vector<T>& GetValues() const
+    {
+        const auto* pvValues = std::get_if<std::vector<T>>(&vMyValues);
+        if (pvValues == nullptr) { throw std::runtime_error("Column::GetValues(): wrong value type for column " + strMyName); }
+        return *pvValues;
+    }
+
+  private:
+    friend class ColumnarBatchDecoder;
+    friend class ColumnarTable;
+
+    using AppendFn = void (*)(Values&, const std::byte*, size_t, size_t, size_t);
+
+    std::string strMyName;
+    BaseField::ConstPtr pclMyField;
+    size_t uiMyWidth{1};
+    size_t uiMyElementSize{0};
+    Values vMyValues;
+    std::vector<size_t> vMyOffsets;
+    AppendFn pfMyAppend{nullptr};
+
+    //! Remove every value, keeping the capacity of the column.
+    void clear();
+
+    //! Reserve room for the values of a number of rows.
+    void reserve(size_t uiRows_);
+
+    //! Remove the values of every row after the first uiRows_, including those of a partly appended row.
+    void truncate(size_t uiRows_);
+
+    //! Append uiRows_ rows of uiWidth_ values each, the rows being uiStride_ bytes apart in pucData_.
+    template <typename T> static void AppendRows(Values& vValues_, const std::byte* pucData_, size_t uiRows_, size_t uiWidth_, size_t uiStride_)
+    {
+        auto& vTypedValues = std::get<std::vector<T>>(vValues_);
+        const size_t uiStart = vTypedValues.size();
+        const size_t uiRowBytes = uiWidth_ * sizeof(T);
+        vTypedValues.resize(uiStart + uiRows_ * uiWidth_);
+        auto* pucDest = reinterpret_cast<std::byte*>(vTypedValues.data() + uiStart);
+        if (uiStride_ == uiRowBytes) { std::memcpy(pucDest, pucData_, uiRows_ * uiRowBytes); }
+        else
+        {
+            for (size_t i = 0; i < uiRows_; ++i) { std::memcpy(pucDest + i * uiRowBytes, pucData_ + i * uiStride_, uiRowBytes); }
+        }
+    }
+
+    //! Append the fixed values of uiRows_ rows, the rows being uiStride_ bytes apart in pucData_.
+    void AppendFixed(const std::byte* pucData_, size_t uiRows_, size_t uiStride_)
+    {
+        pfMyAppend(vMyValues, pucData_, uiRows_, uiMyWidth, uiStride_);
+    }
+
+    //! Append one row of a variable-length array holding uiCount_ values.
+    void AppendArray(const std::byte* pucData_, size_t uiCount_)
+    {
+        if (uiCount_ > 0) { pfMyAppend(vMyValues, pucData_, 1, uiCount_, uiCount_ * uiMyElementSize); }
+        vMyOffsets.push_back(size());
+    }
+
+    //! Append one row of a STRING.
+    void AppendString(std::string strValue_) { std::get<std::vector<std::string>>(vMyValues).push_back(std::move(strValue_)); }
+};
+
+//============================================================================
+//! \class ColumnarTable
+//! \brief Rows of decoded messages, or of the records of a field array,
+//! stored as one Column per field.
+//============================================================================
+class ColumnarTable
+{
+  public:
+    //! \brief Get the name of the table: the message name, or the name of the field array.
+    [[nodiscard]] const std::string& GetName() const { return strMyName; }
+
+    //! \brief Get the number of rows.
+    [[nodiscard]] size_t size() const { return uiMyRows; }
+
+    //! \brief Check if the table has no rows.
+    [[nodiscard]] bool empty() const { return uiMyRows == 0; }
+
+    //! \brief Get the columns, in the order the fields were requested.
+    [[nodiscard]] const std::vector<Column>& GetColumns() const { return vMyColumns; }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Get a column by the name of its field.
+    //!
+    //! \param[in] strName_ The name of the field.
+    //! \return The column. Throws std::runtime_error if the table has no such column.
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] const Column& GetColumn(std::string_view strName_) const;
+
+    //! \brief Get the values of a column by the name of its field.
+    //! \see Column::GetValues
+    template <typename T> [[nodiscard]] const std::vector<T>& GetValues(std::string_view strName_) const
+    {
+        return GetColumn(strName_).GetValues<T>();
+    }
+
+    //! \brief Get the GPS week of the header of each row of a message table.
+    [[nodiscard]] const std::vector<uint16_t>& GetWeeks() const { return vMyWeeks; }
+
+    //! \brief Get the GPS milliseconds of the header of each row of a message table.
+    [[nodiscard]] const std::vector<double>& GetMilliseconds() const { return vMyMilliseconds; }
+
+    //! \brief Get the row of the message table that each row of a field array table belongs to.
+    [[nodiscard]] const std::vector<size_t>& GetParentIndex() const { return vMyParentIndex; }
+
+  private:
+    friend class ColumnarBatchDecoder;
+
+    std::string strMyName;
+    size_t uiMyRows{0};
+    std::vector<Column> vMyColumns;
+    std::vector<uint16_t> vMyWeeks;
+    std::vector<double> vMyMilliseconds;
+    std::vector<size_t> vMyParentIndex;
+
+    //! Remove every row, keeping the capacity of the columns.
+    void clear();
+
+    //! Reserve room for a number of rows in every column.
+    void reserve(size_t uiRows_);
+
+    //! Remove every row after the first uiRows_.
+    void truncate(size_t uiRows_);
+
+    //! Get the index of the column of a field, adding the column if there is none.
+    size_t AddColumn(const std::string& strName_, const BaseField::ConstPtr& pclField_);
+};
+
+//============================================================================
+//! \class ColumnarBatchDecoder
+//! \brief Decode many messages of one type into a ColumnarTable.
+//!
+//! Each decoded message appends a row to the message table, the values of the
+//! requested fields being copied from the decoded message straight into the
+//! typed columns. The records of a requested field array are exploded into a
+//! table of their own, in which each record is a row that refers to the row
+//! of its message, e.g. the observations of RANGE logs.
+//!
+//! Columns are typed from the latest definition of the message. Messages
+//! decoded from another definition are accepted as long as the requested
+//! fields have the same types in it.
+//============================================================================
+class ColumnarBatchDecoder
+{
+  public:
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for the ColumnarBatchDecoder class.
+    //
+    //! \param[in] pclMessageDb_ A pointer to a MessageDatabase object.
+    //! \param[in] strMessageName_ The name of the message to decode, e.g. "RANGE".
+    //! \param[in] vFieldNames_ The names of the fields to decode: top-level
+    //! fields, field arrays, whose every field is decoded, or fields of a field
+    //! array as "array.field", e.g. "obs.psr". Every top-level field is decoded
+    //! if empty.
+    //
+    //! \remark Throws std::runtime_error if the message or one of the fields
+    //! does not exist, or if a field array has nested field arrays.
+    //----------------------------------------------------------------------------
+    ColumnarBatchDecoder(const MessageDatabase::Ptr& pclMessageDb_, const std::string& strMessageName_,
+                         const std::vector<std::string>& vFieldNames_ = {});
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode a framed message and append it to the tables.
+    //
+    //! \details Only the requested fields of the message are decoded, and
+    //! binary messages are decoded as views of the frame (see
+    //! MessageDecoderBase::SetViewDecoding()), so their fixed fields are
+    //! copied once, from the frame into the columns.
+    //
+    //! \param[in] pucFrame_ A pointer to a message frame, as returned by a
+    //! Framer. JSON frames must be null-terminated.
+    //! \param[out] stMetaData_ The metadata of the message.
+    //
+    //! \return An error code describing the result of decoding.
+    //!   SUCCESS: The message was appended.
+    //!   UNSUPPORTED: The frame holds another message, or a response.
+    //!   Otherwise the status of decoding the header or the body.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS Append(const unsigned char* pucFrame_, MetaDataStruct& stMetaData_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Append a decoded message to the tables, e.g. one returned by
+    //! Parser::ReadIntermediate().
+    //
+    //! \param[in] stMessage_ The decoded message.
+    //! \param[in] stMetaData_ The metadata of the message.
+    //
+    //! \return An error code describing the result of appending.
+    //!   SUCCESS: The message was appended.
+    //!   UNSUPPORTED: The message is another message, or a response.
+    //!   FAILURE: A requested field has another type in the definition of the
+    //! message, or was left out by a projection. Nothing was appended.
+    //
+    //! If a value of the message cannot be appended, the rows appended so far
+    //! are removed again before the exception is passed on.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] STATUS Append(const CompositeField& stMessage_, const MetaDataStruct& stMetaData_);
+
+    //! \brief Get the table of the messages, with one row per message.
+    [[nodiscard]] const ColumnarTable& GetTable() const { return clMyTable; }
+
+    //! \brief Get the tables of the requested field arrays.
+    [[nodiscard]] const std::vector<ColumnarTable>& GetChildTables() const { return vMyChildTables; }
+
+    // ---------------------------------------------------------------------------
+    //! \brief Get the table of the records of a field array.
+    //!
+    //! \param[in] strFieldArrayName_ The name of the field array.
+    //! \return The table. Throws std::runtime_error if the field array was not requested.
+    // ---------------------------------------------------------------------------
+    [[nodiscard]] const ColumnarTable& GetChildTable(std::string_view strFieldArrayName_) const;
+
+    //! \brief Remove every row from the tables, keeping the capacity of the columns.
+    void Clear();
+
+    //! \brief Reserve room for a number of messages, and of field array records per message.
+    void Reserve(size_t uiMessages_, size_t uiRecordsPerMessage_ = 0);
+
+  private:
+    //! A requested field, resolved in the definition of the message being appended.
+    struct FieldSource
+    {
+        size_t column;
+        const BaseField* field;
+    };
+
+    //! A requested field array, resolved in the definition of the message being appended.
+    struct FieldArraySource
+    {
+        size_t table;
+        const FieldArrayField* field;
+        std::vector<FieldSource> fields;
+    };
+
+    std::shared_ptr<spdlog::logger> pclMyLogger{GetBaseLoggerManager()->RegisterLogger("columnar_batch_decoder")};
+
+    MessageDefinition::ConstPtr pclMyMessageDef;
+    HeaderDecoder clMyHeaderDecoder;
+    MessageDecoder clMyMessageDecoder;
+    IntermediateHeader stMyHeader;
+    CompositeField stMyMessage;
+
+    ColumnarTable clMyTable;
+    std::vector<ColumnarTable> vMyChildTables;
+    std::vector<size_t> vMyChildRows; // rows of each child table before the message being appended
+
+    FieldInfo::ConstPtr pclMyBoundFieldInfo;
+    std::vector<FieldSource> vMyFieldSources;
+    std::vector<FieldArraySource> vMyFieldArraySources;
+
+    //! Resolve the requested fields in the definition the message being appended was decoded from.
+    [[nodiscard]] STATUS Bind(const FieldInfo::ConstPtr& pclFieldInfo_);
+
+    //! Append the values of the requested fields of a message or a record.
+    static void AppendFields(ColumnarTable& clTable_, const std::vector<FieldSource>& vSources_, const CompositeField& stMessage_);
+};
+
+} // namespace novatel::edie::oem
+
+#endif // NOVATEL_COLUMNAR_BATCH_DECODER_HPP
@@ -27,6 +27,9 @@
 #ifndef NOVATEL_ENCODER_HPP
 #define NOVATEL_ENCODER_HPP
 
+#include <array>
+#include <string_view>
+
 #include "novatel_edie/common/logger.hpp"
 #include "novatel_edie/decoders/common/common.hpp"
 #include "novatel_edie/decoders/common/encoder.hpp"
@@ -46,7 +49,10 @@ class Encoder : public EncoderBase<Encoder>
     // Enum util functions
     void InitEnumDefinitions();
     void InitFieldMaps();
-    [[nodiscard]] std::string JsonHeaderToMsgName(const IntermediateHeader& stInterHeader_) const;
+    [[nodiscard]] std::string_view GetMsgName(const IntermediateHeader& stInterHeader_) const;
+
+    //! Stack storage for a message name with its format and sibling ID suffixes.
+    using MsgNameBuffer = std::array<char, 64>;
 
     //----------------------------------------------------------------------------
     //! \brief Add padding after binary string fields to maintain alignment. OEM
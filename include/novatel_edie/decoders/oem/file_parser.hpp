@@ -50,7 +50,7 @@ class FileParser : public FileParserBase<oem::Parser, oem::Filter, oem::MetaData
     //----------------------------------------------------------------------------
     //! \brief A constructor for the FileParser class.
     //
-    //! \param[in] sDbPath_ Filepath to a JSON message DB.
+    //! \param[in] sDbPath_ Filepath to a JSON or binary message DB, see LoadDbFile().
     //----------------------------------------------------------------------------
     FileParser(const std::filesystem::path& sDbPath_) : Base("novatel_file_parser", sDbPath_) { pclMyLogger->debug("FileParser initialized"); }
 
@@ -95,6 +95,22 @@ class FileParser : public FileParserBase<oem::Parser, oem::Filter, oem::MetaData
     //! \return The current option for decompressing RANGECMP messages.
     //----------------------------------------------------------------------------
     [[nodiscard]] bool GetDecompressRangeCmp() const { return clMyParser.GetDecompressRangeCmp(); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode only some of the fields of a message.
+    //
+    //! \param[in] messageName_ The name of the message, e.g. "BESTPOS".
+    //! \param[in] fieldNames_ The names of the top-level fields to decode.
+    //----------------------------------------------------------------------------
+    void SetProjection(const std::string& messageName_, std::vector<std::string> fieldNames_)
+    {
+        clMyParser.SetProjection(messageName_, std::move(fieldNames_));
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode all fields of every message again.
+    //----------------------------------------------------------------------------
+    void ClearProjections() { clMyParser.ClearProjections(); }
 };
 
 } // namespace novatel::edie::oem
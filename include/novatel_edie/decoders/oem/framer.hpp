@@ -138,6 +138,12 @@ class Framer : public FramerBase
     //----------------------------------------------------------------------------
     Framer();
 
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for the Framer class.
+    //! \param [in] eBufferBackend_ Memory layout of the internal fixed buffer.
+    //----------------------------------------------------------------------------
+    explicit Framer(FIXED_BUFFER_BACKEND eBufferBackend_);
+
     //----------------------------------------------------------------------------
     //! \brief Public interface to frame an OEM message - enforces metadata type.
     //
@@ -82,10 +82,13 @@ template <HEADER_FORMAT HeaderFormat, unsigned char SyncByte, size_t MaxMessageL
         const auto& clFrameBuffer = *pclMyBuffer;
         const auto uiBufferSize = clFrameBuffer.size();
         constexpr size_t uiCrcTrailerLength = OEM4_ASCII_CRC_LENGTH + 3; // Delimiter + CRC + CRLF
-        auto uiCrcDelimIndex = clFrameBuffer.search_char(OEM4_ASCII_CRC_DELIMITER, start, MaxMessageLength);
+        // Only search within the longest possible frame so that junk without a valid CRC is rejected in bounded time
+        constexpr size_t uiMaxDelimIndex = MaxMessageLength - uiCrcTrailerLength;
+        auto searchCount = [](size_t uiIndex_) { return uiIndex_ <= uiMaxDelimIndex ? uiMaxDelimIndex + 1 - uiIndex_ : 0; };
+        auto uiCrcDelimIndex = clFrameBuffer.search_char(OEM4_ASCII_CRC_DELIMITER, start, searchCount(start));
         while (uiCrcDelimIndex != UCharFixedBuffer::npos && uiBufferSize - uiCrcDelimIndex >= uiCrcTrailerLength && !IsAsciiCrc(uiCrcDelimIndex + 1))
         {
-            uiCrcDelimIndex = clFrameBuffer.search_char(OEM4_ASCII_CRC_DELIMITER, uiCrcDelimIndex + 1, MaxMessageLength);
+            uiCrcDelimIndex = clFrameBuffer.search_char(OEM4_ASCII_CRC_DELIMITER, uiCrcDelimIndex + 1, searchCount(uiCrcDelimIndex + 1));
         }
 
         if (uiCrcDelimIndex == UCharFixedBuffer::npos)
@@ -32,6 +32,7 @@
 
 #include "novatel_edie/common/logger.hpp"
 #include "novatel_edie/decoders/common/common.hpp"
+#include "novatel_edie/decoders/common/json_message_parser.hpp"
 #include "novatel_edie/decoders/common/message_counts_tracker.hpp"
 #include "novatel_edie/decoders/common/message_database.hpp"
 #include "novatel_edie/decoders/oem/common.hpp"
@@ -81,6 +82,7 @@ class HeaderDecoder
     EnumDefinition::ConstPtr vMyGpsTimeStatusDefinitions{nullptr};
     MessageDefinition stMyResponseDefinition;
     mutable MessageCountsTrackerT clMyMessageCounts{};
+    JsonMessageParser::Ptr pclMyJsonParser{nullptr};
 
     // Decode novatel headers
     template <const char pcDelimiter[], ASCII_HEADER eField>
@@ -118,6 +120,29 @@ class HeaderDecoder
     //----------------------------------------------------------------------------
     void SetLoggerLevel(spdlog::level::level_enum eLevel_) const { pclMyLogger->set_level(eLevel_); }
 
+    //----------------------------------------------------------------------------
+    //! \brief Set the parser used to decode JSON headers.
+    //
+    //! \details A JSON header is decoded from a parse of the whole message. By
+    //! default each message is parsed with a parser of its own. When a parser is
+    //! set and shared with a MessageDecoder, the MessageDecoder reuses that parse
+    //! to decode the body of the same frame. A decoder with a parser set is not
+    //! reentrant: Decode() must not be called concurrently, even though it is
+    //! const.
+    //
+    //! \param[in] pclJsonParser_ The JSON message parser, or nullptr to parse
+    //! each message with a parser of its own.
+    //----------------------------------------------------------------------------
+    void SetJsonParser(JsonMessageParser::Ptr pclJsonParser_) { pclMyJsonParser = std::move(pclJsonParser_); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the parser used to decode JSON headers.
+    //
+    //! \return A shared pointer to the JSON message parser, or nullptr if none
+    //! is set.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] const JsonMessageParser::Ptr& GetJsonParser() const { return pclMyJsonParser; }
+
     //----------------------------------------------------------------------------
     //! \brief Decode an OEM message header from the provided frame.
     //
@@ -126,6 +151,8 @@ class HeaderDecoder
     //! \param[in, out] stMetaData_ MetaDataStruct to provide information about
     //! the frame and be fully populated to help describe the decoded log.
     //
+    //! \remark Decoding a JSON header is reentrant unless a JSON parser has been
+    //! set with SetJsonParser().
     //! \return An error code describing the result of decoding.
     //!   SUCCESS: The operation was successful.
     //!   NULL_PROVIDED: pucHeader_ is a null pointer.
@@ -0,0 +1,165 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file parallel_framer.hpp
+// ===============================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "novatel_edie/common/logger.hpp"
+#include "novatel_edie/decoders/common/common.hpp"
+
+namespace novatel::edie::oem {
+
+class Framer;
+
+//============================================================================
+//! \struct FrameLocation
+//! \brief The location of one frame found by the ParallelFramer.
+//============================================================================
+struct FrameLocation
+{
+    uint64_t ullOffset{0U};                        //!< Offset of the first byte from the start of the data.
+    uint32_t uiLength{0U};                         //!< Length of the frame in bytes.
+    HEADER_FORMAT eFormat{HEADER_FORMAT::UNKNOWN}; //!< Format of the frame.
+
+    //! \brief Get the offset following the last byte of the frame.
+    [[nodiscard]] uint64_t End() const { return ullOffset + uiLength; }
+
+    bool operator==(const FrameLocation& other_) const
+    {
+        return ullOffset == other_.ullOffset && uiLength == other_.uiLength && eFormat == other_.eFormat;
+    }
+};
+
+//============================================================================
+//! \class ParallelFramer
+//! \brief Frame a complete capture held in memory on several threads.
+//!
+//! The data is split into one chunk per thread. Each thread frames its chunk
+//! with its own Framer, resynchronizing at the first frame that passes its CRC
+//! check. The per-chunk results are then stitched together: the frames of a
+//! chunk are adopted from the first point at which a sequential Framer would be
+//! in the same state as the chunk's Framer, which is the chunk start or the end
+//! of a frame found by both. Frames straddling a chunk boundary are framed again
+//! sequentially until that happens, so the result is exactly the sequence of
+//! frames a single Framer would return for the same data. The bytes between
+//! consecutive frames are those a Framer would report as unknown.
+//============================================================================
+class ParallelFramer
+{
+  public:
+    //----------------------------------------------------------------------------
+    //! \brief A constructor for the ParallelFramer class.
+    //
+    //! \param[in] uiThreadCount_ The number of threads to frame with. Zero uses
+    //! one thread per hardware thread.
+    //----------------------------------------------------------------------------
+    explicit ParallelFramer(size_t uiThreadCount_ = 0);
+
+    //----------------------------------------------------------------------------
+    //! \brief Set the number of threads to frame with.
+    //
+    //! \param[in] uiThreadCount_ The number of threads. Zero uses one thread per
+    //! hardware thread.
+    //----------------------------------------------------------------------------
+    void SetThreadCount(size_t uiThreadCount_);
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the number of threads to frame with.
+    //
+    //! \return The number of threads.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] size_t GetThreadCount() const { return uiMyThreadCount; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Set the smallest chunk a thread is given. Data shorter than two
+    //! chunks is framed on a single thread.
+    //
+    //! \param[in] ullMinChunkSize_ The minimum chunk size in bytes.
+    //----------------------------------------------------------------------------
+    void SetMinChunkSize(uint64_t ullMinChunkSize_) { ullMyMinChunkSize = std::max<uint64_t>(ullMinChunkSize_, 1U); }
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the smallest chunk a thread is given.
+    //
+    //! \return The minimum chunk size in bytes.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] uint64_t GetMinChunkSize() const { return ullMyMinChunkSize; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Frame JSON objects in addition to the other formats.
+    //
+    //! \param[in] bFrameJson_ true to frame JSON objects.
+    //----------------------------------------------------------------------------
+    void SetFrameJson(const bool bFrameJson_) { bMyFrameJson = bFrameJson_; }
+
+    //----------------------------------------------------------------------------
+    //! \brief Find every frame in the provided data.
+    //
+    //! \param[in] pucData_ The data to frame. It must stay valid for the call.
+    //! \param[in] ullDataLength_ The number of bytes in pucData_.
+    //
+    //! \return The frames in the order they appear in the data.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] std::vector<FrameLocation> Frame(const unsigned char* pucData_, uint64_t ullDataLength_) const;
+
+    //----------------------------------------------------------------------------
+    //! \brief Get the internal logger.
+    //
+    //! \return Shared pointer to the internal logger object.
+    //----------------------------------------------------------------------------
+    [[nodiscard]] std::shared_ptr<spdlog::logger> GetLogger() const { return pclMyLogger; }
+
+    //! The default minimum chunk size. Smaller chunks spend a larger share of their time resynchronizing.
+    static constexpr uint64_t DEFAULT_MIN_CHUNK_SIZE = 1 << 20;
+
+  private:
+    std::shared_ptr<spdlog::logger> pclMyLogger;
+    size_t uiMyThreadCount{1};
+    uint64_t ullMyMinChunkSize{DEFAULT_MIN_CHUNK_SIZE};
+    bool bMyFrameJson{false};
+
+    //----------------------------------------------------------------------------
+    //! \brief Frame the data from a starting offset.
+    //
+    //! \param[in,out] clFramer_ The Framer to frame with. Its buffered bytes and
+    //! state are discarded first, so one Framer can be reused across calls, and
+    //! it is attached to pucData_ so that no bytes are copied.
+    //! \param[in] pucData_ The data to frame.
+    //! \param[in] ullDataLength_ The number of bytes in pucData_.
+    //! \param[in] ullBegin_ The offset at which the Framer starts.
+    //! \param[in] ullEnd_ Framing stops at the first frame starting at or after
+    //! this offset.
+    //! \param[in] uiMaxFrames_ Framing stops after this many frames.
+    //! \param[out] vFrames_ The vector to append the frames to.
+    //----------------------------------------------------------------------------
+    void FrameRange(Framer& clFramer_, const unsigned char* pucData_, uint64_t ullDataLength_, uint64_t ullBegin_, uint64_t ullEnd_,
+                    size_t uiMaxFrames_, std::vector<FrameLocation>& vFrames_) const;
+};
+
+} // namespace novatel::edie::oem
@@ -28,6 +28,8 @@
 #define NOVATEL_PARSER_HPP
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "novatel_edie/common/logger.hpp"
 #include "novatel_edie/decoders/common/common.hpp"
@@ -59,6 +61,9 @@ class Parser
     MessageDecoder clMyMessageDecoder;
     Encoder clMyEncoder;
 
+    // Shared by the header and message decoders so that a JSON message is parsed once
+    JsonMessageParser::Ptr pclMyJsonParser{std::make_shared<JsonMessageParser>()};
+
     // Niche components
     RangeDecompressor clMyRangeDecompressor;
     RxConfigHandler clMyRxConfigHandler;
@@ -68,9 +73,14 @@ class Parser
 
     std::unique_ptr<unsigned char[]> pcMyEncodeBuffer{std::make_unique<unsigned char[]>(uiParserInternalBufferSize)};
     unsigned char* pucMyEncodeBufferPointer{nullptr};
-    std::unique_ptr<unsigned char[]> pcMyFrameBuffer{std::make_unique<unsigned char[]>(uiParserInternalBufferSize)};
+    // One byte longer than the largest frame, for the null terminator that JSON decoding relies on
+    std::unique_ptr<unsigned char[]> pcMyFrameBuffer{std::make_unique<unsigned char[]>(uiParserInternalBufferSize + 1)};
     unsigned char* pucMyFrameBufferPointer{nullptr};
 
+    // Scratch messages retained across calls to Read() so their storage is reused
+    IntermediateHeader stMyHeader;
+    CompositeField stMyMessage;
+
     // Configuration options
     bool bMyDecompressRangeCmp{true};
     bool bMyReturnUnknownBytes{true};
@@ -91,7 +101,7 @@ class Parser
     //----------------------------------------------------------------------------
     //! \brief A constructor for the Parser class.
     //
-    //! \param[in] sDbPath_ Filepath to a JSON message DB.
+    //! \param[in] sDbPath_ Filepath to a JSON or binary message DB, see LoadDbFile().
     //----------------------------------------------------------------------------
     Parser(const std::filesystem::path& sDbPath_);
 
@@ -228,6 +238,26 @@ class Parser
     //----------------------------------------------------------------------------
     const Filter::Ptr& GetFilter() const { return pclMyUserFilter; }
 
+    //----------------------------------------------------------------------------
+    //! \brief Decode only some of the fields of a message.
+    //
+    //! \details The other top-level fields are skipped by the MessageDecoder
+    //! and are encoded with default values. See
+    //! MessageDecoderBase::SetProjection().
+    //
+    //! \param[in] messageName_ The name of the message, e.g. "BESTPOS".
+    //! \param[in] fieldNames_ The names of the top-level fields to decode.
+    //----------------------------------------------------------------------------
+    void SetProjection(const std::string& messageName_, std::vector<std::string> fieldNames_)
+    {
+        clMyMessageDecoder.SetProjection(messageName_, std::move(fieldNames_));
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Decode all fields of every message again.
+    //----------------------------------------------------------------------------
+    void ClearProjections() { clMyMessageDecoder.ClearProjections(); }
+
     //----------------------------------------------------------------------------
     //! \brief Get a pointer to the current framed log raw data.
     //
@@ -245,6 +275,26 @@ class Parser
     //----------------------------------------------------------------------------
     [[nodiscard]] size_t Write(const unsigned char* pucData_, size_t uiDataSize_) { return clMyFramer.Write(pucData_, uiDataSize_); }
 
+    //----------------------------------------------------------------------------
+    //! \brief Parse bytes in place from memory owned by the caller.
+    //
+    //! \param[in] pucData_ The first byte of the memory. It must stay valid and
+    //! unchanged until DetachInput() is called.
+    //
+    //! \see FramerBase::Attach()
+    //----------------------------------------------------------------------------
+    void AttachInput(const unsigned char* pucData_)
+    {
+        clMyRangeDecompressor.Reset();
+        clMyFramer.Attach(pucData_);
+    }
+
+    //----------------------------------------------------------------------------
+    //! \brief Discard any buffered bytes and return to copying written bytes into
+    //! the Parser's internal buffer.
+    //----------------------------------------------------------------------------
+    void DetachInput() { AttachInput(nullptr); }
+
     //----------------------------------------------------------------------------
     //! \brief Get the number of bytes available in the Parser's internal buffer.
     //!
@@ -269,6 +319,10 @@ class Parser
     //!   UNKNOWN: A message could not be found and unknown bytes were returned
     //! if requested in the ParserConfigStruct given to SetConfig().
     //!   BUFFER_EMPTY: There are no more bytes to parse in the Parser.
+    //
+    //! \note The intermediate header and message are retained between calls.
+    //! Once a message of a given shape has been read, reading another like it
+    //! makes no heap allocations.
     //----------------------------------------------------------------------------
     [[nodiscard]] STATUS Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbreviated_ = false);
 
@@ -293,6 +347,13 @@ class Parser
     //!   UNKNOWN: A message could not be found and unknown bytes were returned
     //! if requested in the ParserConfigStruct given to SetConfig().
     //!   BUFFER_EMPTY: There are no more bytes to parse in the Parser.
+    //
+    //! \note Frames are decoded directly from the framer's buffer, so the
+    //! pointers in stMessageData_ are only valid until the next call to Write,
+    //! Read, ReadIntermediate or Flush.
+    //!
+    //! Passing the same stMessage_ on every call lets its field storage be
+    //! reused, so that steady-state reads make no heap allocations.
     //----------------------------------------------------------------------------
     [[nodiscard]] STATUS ReadIntermediate(MessageDataStruct& stMessageData_, IntermediateHeader& header_, CompositeField& stMessage_,
                                           MetaDataStruct& stMetaData_, bool bDecodeIncompleteAbbreviated_ = false);
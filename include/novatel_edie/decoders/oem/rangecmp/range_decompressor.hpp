@@ -114,6 +114,10 @@ class RangeDecompressor
     MessageDecoder clMyMessageDecoder;
     Encoder clMyEncoder;
 
+    // Scratch messages retained across calls to Decompress() so their storage is reused
+    IntermediateHeader stMyHeader;
+    CompositeField stMyMessage;
+
     std::shared_ptr<spdlog::logger> pclMyLogger;
     MessageDatabase::Ptr pclMyMsgDB{nullptr};
 
@@ -20,6 +20,8 @@ class PyFileParser : public oem::FileParser
     py_common::PyMessageDatabase::Ptr pclPyMessageDb;
     void SetStreamByPath(const std::filesystem::path& filepath_)
     {
+        // Regular files are memory-mapped where supported
+        if (SetFile(filepath_)) { return; }
         auto ifs = std::make_shared<std::ifstream>(filepath_, std::ios::binary);
         if (!ifs) { throw std::runtime_error("Failed to open file"); }
         if (!SetStream(ifs)) { throw std::runtime_error("Input stream could not be set to the provided file."); }
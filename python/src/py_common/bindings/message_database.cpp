@@ -222,7 +222,7 @@ void py_common::init_common_message_database(nb::module_& m)
             },
             "name"_a = std::string{}, "type"_a = FIELD_TYPE::UNKNOWN, "conversion"_a = std::string{}, "data_type"_a = DATA_TYPE::UNKNOWN,
             "array_length"_a = uint32_t{0})
-        .def_rw("array_length", &ArrayField::arrayLength)
+        .def_ro("array_length", &ArrayField::arrayLength) // cached by the decode plans, so it is only set on construction
         .def("__repr__", [](const ArrayField& field) {
             const std::string& desc = field.description == "[Brief Description]" ? "" : field.description;
             return nb::str("ArrayField(name={!r}, type={}, data_type={}, description={!r}, conversion={!r}, array_length={!r})")
@@ -246,7 +246,7 @@ void py_common::init_common_message_database(nb::module_& m)
             },
             "name"_a = std::string{}, "type"_a = FIELD_TYPE::FIELD_ARRAY, "conversion"_a = std::string{}, "data_type"_a = DATA_TYPE::UNKNOWN,
             "array_length"_a = uint32_t{0}, "fields"_a = std::vector<std::shared_ptr<BaseField>>{})
-        .def_rw("array_length", &FieldArrayField::arrayLength)
+        .def_ro("array_length", &FieldArrayField::arrayLength)
         .def_prop_rw(
             "fields",
             [](FieldArrayField& self) -> const std::vector<BaseField::ConstPtr>& {
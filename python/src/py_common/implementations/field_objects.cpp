@@ -129,8 +129,9 @@ PYCOMMON_EXPORT nb::object py_common::PyField::convert_field(const BaseField& fi
         return pyArr;
     }
 
-    FieldValueVariant fieldValue;
-    if (const auto* cf = GetCompositeField()) { fieldValue = cf->GetFieldValueVariant(field); }
+    // Strings and arrays are viewed in place and only copied into the Python object
+    FieldValueView fieldValue;
+    if (const auto* cf = GetCompositeField()) { fieldValue = cf->GetFieldValueView(field); }
     else if (std::holds_alternative<nb::object>(storage) && nb::isinstance<PyFieldArray>(std::get<nb::object>(storage)))
     {
         auto parentFieldArray = nb::inst_ptr<PyFieldArray>(std::get<nb::object>(storage));
@@ -185,16 +186,13 @@ PYCOMMON_EXPORT nb::object py_common::PyField::convert_field(const BaseField& fi
     return std::visit(
         [&](auto&& value) -> nb::object {
             using T = std::decay_t<decltype(value)>;
-            if constexpr (std::is_same_v<T, std::vector<std::byte>> || std::is_same_v<T, std::vector<CompositeField>>)
+            if constexpr (std::is_same_v<T, FieldArray>)
             {
                 throw std::runtime_error("PyField::convert_field(): field array types should be handled through PyFieldArray");
             }
-            if constexpr (is_specialization_of_v<T, std::vector> || is_specialization_of_v<T, TypedBuffer>)
+            else if constexpr (is_specialization_of_v<T, TypedBuffer>)
             {
-                if constexpr (std::is_same_v<T, std::vector<uint8_t>> || std::is_same_v<T, std::vector<int8_t>> ||
-                              std::is_same_v<T, std::vector<char>> || std::is_same_v<T, std::vector<unsigned char>> ||
-                              std::is_same_v<T, TypedBuffer<uint8_t>> || std::is_same_v<T, TypedBuffer<int8_t>> ||
-                              std::is_same_v<T, TypedBuffer<char>> || std::is_same_v<T, TypedBuffer<unsigned char>>)
+                if constexpr (std::is_same_v<T, TypedBuffer<uint8_t>> || std::is_same_v<T, TypedBuffer<int8_t>>)
                 {
                     if (field.isString)
                     {
@@ -0,0 +1,202 @@
+import os
+import re
+import sys
+import json
+import argparse
+
+# Largest alignment of a fixed field for each message family, see OemAlignmentFunction()
+FAMILY_ALIGNMENT = {
+    'OEM': 4
+}
+
+# C++ type of each data type, as decoded by EDIE (see SimpleTypeVisitor())
+NOVATEL_TO_CTYPES = {
+    'BOOL': 'bool',
+    'CHAR': 'int8_t',
+    'UCHAR': 'uint8_t',
+    'HEXBYTE': 'uint8_t',
+    'SHORT': 'int16_t',
+    'USHORT': 'uint16_t',
+    'INT': 'int32_t',
+    'UINT': 'uint32_t',
+    'LONG': 'int32_t',
+    'ULONG': 'uint32_t',
+    'SATELLITEID': 'uint32_t',
+    'LONGLONG': 'int64_t',
+    'ULONGLONG': 'uint64_t',
+    'FLOAT': 'float',
+    'DOUBLE': 'double'
+}
+
+ENUM_CTYPES = {
+    1: 'int8_t',
+    2: 'int16_t',
+    4: 'int32_t'
+}
+
+FIXED_FIELD_TYPES = ('SIMPLE', 'ENUM', 'FIXED_LENGTH_ARRAY')
+
+CPP_KEYWORDS = {
+    'alignas', 'alignof', 'and', 'and_eq', 'asm', 'auto', 'bitand', 'bitor', 'bool', 'break', 'case', 'catch', 'char',
+    'char16_t', 'char32_t', 'class', 'compl', 'const', 'constexpr', 'const_cast', 'continue', 'decltype', 'default',
+    'delete', 'do', 'double', 'dynamic_cast', 'else', 'enum', 'explicit', 'export', 'extern', 'false', 'float', 'for',
+    'friend', 'goto', 'if', 'inline', 'int', 'long', 'mutable', 'namespace', 'new', 'noexcept', 'not', 'not_eq',
+    'nullptr', 'operator', 'or', 'or_eq', 'private', 'protected', 'public', 'register', 'reinterpret_cast', 'return',
+    'short', 'signed', 'sizeof', 'static', 'static_assert', 'static_cast', 'struct', 'switch', 'template', 'this',
+    'thread_local', 'throw', 'true', 'try', 'typedef', 'typeid', 'typename', 'union', 'unsigned', 'using', 'virtual',
+    'void', 'volatile', 'wchar_t', 'while', 'xor', 'xor_eq'
+}
+
+# Members of the generated layouts and of FieldView/MessageView
+LAYOUT_MEMBERS = {
+    'messageName', 'messageId', 'messageCrc', 'fieldCount', 'fixedFieldBytes', 'fixedFields', 'data', 'Load',
+    'LoadArray', 'Get', 'GetFieldArray', 'Bind', 'CanBind'
+}
+
+
+def to_identifier(name: str, taken: set) -> str:
+    ident = re.sub(r'\W', '_', name)
+    if not ident or ident[0].isdigit():
+        ident = f'_{ident}'
+    if ident in CPP_KEYWORDS or ident in LAYOUT_MEMBERS:
+        ident = f'{ident}_'
+    unique = ident
+    n = 2
+    while unique in taken:
+        unique = f'{ident}_{n}'
+        n += 1
+    taken.add(unique)
+    return unique
+
+
+def fixed_ctype(field: dict):
+    if field['type'] == 'ENUM':
+        return ENUM_CTYPES.get(field['dataType']['length'])
+    return NOVATEL_TO_CTYPES.get(field['dataType']['name'])
+
+
+def gen_layout(fields: list, struct_name: str, alignment: int, layouts: list, header: list = None):
+    """Append the C++ layout of fields, after the layouts of its field arrays, to layouts."""
+    fixed_specs = []
+    accessors = []
+    taken = set()
+    offset = 0
+
+    for position, field in enumerate(fields):
+        ident = to_identifier(field['name'], taken)
+        data_type = field['dataType']
+        field_type = field['type']
+
+        if field_type in FIXED_FIELD_TYPES:
+            length = data_type['length']
+            count = field['arrayLength'] if field_type == 'FIXED_LENGTH_ARRAY' else 1
+            align = min(alignment, length)
+            if align > 1 and offset % align:
+                offset += align - offset % align
+            fixed_specs.append(f'{{{position}, {offset}, {length}, {count}}}')
+
+            ctype = fixed_ctype(field)
+            if ctype is None:
+                accessors.append(f'// {field["name"]}: unsupported data type {data_type["name"]}')
+            elif field_type == 'FIXED_LENGTH_ARRAY':
+                accessors.append(f'[[nodiscard]] TypedBuffer<{ctype}> {ident}() const '
+                                 f'{{ return LoadArray<{ctype}, {offset}, {count}>(); }}')
+            else:
+                accessors.append(f'[[nodiscard]] {ctype} {ident}() const {{ return Load<{ctype}, {offset}>(); }}')
+            offset += length * count
+        elif field_type == 'STRING':
+            accessors.append(f'[[nodiscard]] std::string {ident}() const {{ return Get<std::string, {position}>(); }}')
+        elif field_type == 'VARIABLE_LENGTH_ARRAY':
+            # Variable-length BOOL arrays are stored as uint8_t
+            ctype = 'uint8_t' if data_type['name'] == 'BOOL' else NOVATEL_TO_CTYPES.get(data_type['name'])
+            if ctype is None:
+                accessors.append(f'// {field["name"]}: unsupported data type {data_type["name"]}')
+            else:
+                accessors.append(f'[[nodiscard]] TypedBuffer<{ctype}> {ident}() const '
+                                 f'{{ return Get<TypedBuffer<{ctype}>, {position}>(); }}')
+        elif field_type == 'FIELD_ARRAY':
+            row_name = f'{struct_name}_{ident}'
+            gen_layout(field['fields'], row_name, alignment, layouts)
+            accessors.append(f'[[nodiscard]] FieldArrayView<{row_name}> {ident}() const '
+                             f'{{ return GetFieldArray<{row_name}, {position}>(); }}')
+        else:
+            raise ValueError(f'{struct_name}: unknown type {field_type} of field {field["name"]}')
+
+    layout = f'struct {struct_name} : FieldView<{struct_name}>\n{{\n'
+    for line in header or []:
+        layout += f'    {line}\n'
+    layout += f'    static constexpr size_t fieldCount = {len(fields)};\n'
+    layout += f'    static constexpr size_t fixedFieldBytes = {offset};\n'
+    specs = f'{{{{{", ".join(fixed_specs)}}}}}' if fixed_specs else '{}'
+    layout += f'    static constexpr std::array<FixedFieldSpec, {len(fixed_specs)}> fixedFields{specs};\n'
+    if accessors:
+        layout += '\n'
+    for accessor in accessors:
+        layout += f'    {accessor}\n'
+    layout += '};\n'
+    layout += (f'static_assert(novatel::edie::IsFixedFieldLayout({struct_name}::fixedFields, {alignment}, '
+               f'{struct_name}::fixedFieldBytes), "{struct_name}: inconsistent layout");\n')
+    layouts.append(layout)
+
+
+def gen_message_views(msg_database: dict, out_file: str, namespace: str, messages: list = None):
+    family = msg_database.get('meta', {}).get('messageFamily', '')
+    alignment = FAMILY_ALIGNMENT.get(family, 1)
+    wanted = set(messages) if messages else None
+
+    layouts = []
+    for msg in msg_database['messages']:
+        if wanted is not None and msg['name'] not in wanted:
+            continue
+        crc = msg['latestMsgDefCrc']
+        header = [f'static constexpr std::string_view messageName = "{msg["name"]}";',
+                  f'static constexpr uint16_t messageId = {msg["messageID"]};',
+                  f'static constexpr uint32_t messageCrc = {int(crc)}U;']
+        gen_layout(msg['fields'][str(crc)], to_identifier(msg['name'], set()), alignment, layouts, header)
+
+    if wanted is not None:
+        missing = wanted - {msg['name'] for msg in msg_database['messages']}
+        if missing:
+            raise ValueError(f'Messages not found in the database: {", ".join(sorted(missing))}')
+
+    guard = re.sub(r'\W', '_', os.path.basename(out_file)).upper()
+    with open(out_file, 'w') as fp:
+        fp.write('// Generated by scripts/gen_message_views.py from the message database. Do not edit.\n\n')
+        fp.write(f'#ifndef {guard}\n#define {guard}\n\n')
+        fp.write('#ifdef PASSTHROUGH\n   #undef PASSTHROUGH // Fix name collision in wingdi.h (included by spdlog)\n#endif\n\n')
+        fp.write('#include <array>\n#include <cstdint>\n#include <string>\n#include <string_view>\n\n')
+        fp.write('#include "novatel_edie/decoders/common/message_view.hpp"\n\n')
+        fp.write(f'namespace {namespace} {{\n\n')
+        fp.write('using novatel::edie::FieldArrayView;\n')
+        fp.write('using novatel::edie::FieldView;\n')
+        fp.write('using novatel::edie::FixedFieldSpec;\n')
+        fp.write('using novatel::edie::TypedBuffer;\n\n')
+        fp.write('\n'.join(layouts))
+        fp.write(f'\n}} // namespace {namespace}\n\n')
+        fp.write(f'#endif // {guard}\n')
+
+
+def is_valid_file(parser, arg):
+    if not os.path.exists(arg):
+        parser.error(f'The file {arg} does not exist!')
+    else:
+        return open(arg, 'r')
+
+
+def parse_args():
+    p = argparse.ArgumentParser()
+    p.add_argument('json_db', help='Path to the NovAtel JSON database', type=lambda x: is_valid_file(p, x))
+    p.add_argument('-o', '--out_file', help='Output header file name. Defaults to "message_views.hpp"',
+                   default='message_views.hpp')
+    p.add_argument('-n', '--namespace', help='Namespace of the layouts. Defaults to "novatel::edie::oem::views"',
+                   default='novatel::edie::oem::views')
+    p.add_argument('-m', '--messages', nargs='+', help='Names of the messages to generate. Defaults to all messages')
+    return p.parse_args()
+
+
+if __name__ == '__main__':
+    args = parse_args()
+    msg_defs = json.load(args.json_db)
+    gen_message_views(msg_defs, out_file=args.out_file, namespace=args.namespace, messages=args.messages)
+    print(f'{args.out_file} generated')
+    sys.exit()
@@ -0,0 +1,143 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file byte_scanner.cpp
+// ===============================================================================
+
+#include "novatel_edie/common/byte_scanner.hpp"
+
+#include <cstdint>
+
+#ifdef EDIE_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+namespace novatel::edie {
+
+namespace {
+
+using FindFunction = size_t (*)(const unsigned char*, size_t, const unsigned char*, size_t, const std::array<bool, 256>&);
+
+//-----------------------------------------------------------------------
+size_t FindScalar(const unsigned char* pucData_, const size_t uiLength_, [[maybe_unused]] const unsigned char* pucValues_,
+                  [[maybe_unused]] const size_t uiValueCount_, const std::array<bool, 256>& abLookup_)
+{
+    for (size_t i = 0; i < uiLength_; ++i)
+    {
+        if (abLookup_[pucData_[i]]) { return i; }
+    }
+    return uiLength_;
+}
+
+#ifdef EDIE_SIMD_X86
+//-----------------------------------------------------------------------
+inline uint32_t CountTrailingZeros(const uint32_t uiMask_)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long ulIndex;
+    _BitScanForward(&ulIndex, uiMask_);
+    return static_cast<uint32_t>(ulIndex);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(uiMask_));
+#endif
+}
+
+//-----------------------------------------------------------------------
+size_t FindSse2(const unsigned char* pucData_, const size_t uiLength_, const unsigned char* pucValues_, const size_t uiValueCount_,
+                const std::array<bool, 256>& abLookup_)
+{
+    if (uiValueCount_ == 0) { return uiLength_; }
+
+    __m128i aNeedles[ByteScanner::MAX_VALUES];
+    for (size_t j = 0; j < uiValueCount_; ++j) { aNeedles[j] = _mm_set1_epi8(static_cast<char>(pucValues_[j])); }
+
+    size_t i = 0;
+    for (; i + sizeof(__m128i) <= uiLength_; i += sizeof(__m128i))
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pucData_ + i));
+        __m128i matches = _mm_cmpeq_epi8(block, aNeedles[0]);
+        for (size_t j = 1; j < uiValueCount_; ++j) { matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, aNeedles[j])); }
+
+        const auto uiMask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+        if (uiMask != 0) { return i + CountTrailingZeros(uiMask); }
+    }
+
+    return i + FindScalar(pucData_ + i, uiLength_ - i, pucValues_, uiValueCount_, abLookup_);
+}
+
+//-----------------------------------------------------------------------
+EDIE_TARGET_AVX2 size_t FindAvx2(const unsigned char* pucData_, const size_t uiLength_, const unsigned char* pucValues_,
+                                 const size_t uiValueCount_, const std::array<bool, 256>& abLookup_)
+{
+    if (uiValueCount_ == 0) { return uiLength_; }
+
+    __m256i aNeedles[ByteScanner::MAX_VALUES];
+    for (size_t j = 0; j < uiValueCount_; ++j) { aNeedles[j] = _mm256_set1_epi8(static_cast<char>(pucValues_[j])); }
+
+    size_t i = 0;
+    for (; i + sizeof(__m256i) <= uiLength_; i += sizeof(__m256i))
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pucData_ + i));
+        __m256i matches = _mm256_cmpeq_epi8(block, aNeedles[0]);
+        for (size_t j = 1; j < uiValueCount_; ++j) { matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, aNeedles[j])); }
+
+        const auto uiMask = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+        if (uiMask != 0) { return i + CountTrailingZeros(uiMask); }
+    }
+
+    return i + FindSse2(pucData_ + i, uiLength_ - i, pucValues_, uiValueCount_, abLookup_);
+}
+#endif
+
+//-----------------------------------------------------------------------
+FindFunction SelectFindFunction(const SIMD_LEVEL eLevel_)
+{
+    switch (GetDispatchSimdLevel(eLevel_))
+    {
+#ifdef EDIE_SIMD_X86
+    case SIMD_LEVEL::AVX2: return FindAvx2;
+    case SIMD_LEVEL::SSE2: return FindSse2;
+#endif
+    default: return FindScalar;
+    }
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------
+size_t ByteScanner::Find(const unsigned char* pucData_, const size_t uiLength_) const noexcept
+{
+    static const FindFunction pfFind = SelectFindFunction(GetSupportedSimdLevel());
+    return pfFind(pucData_, uiLength_, aucMyValues.data(), uiMyValueCount, abMyLookup);
+}
+
+//-----------------------------------------------------------------------
+size_t ByteScanner::Find(const unsigned char* pucData_, const size_t uiLength_, const SIMD_LEVEL eLevel_) const noexcept
+{
+    return SelectFindFunction(eLevel_)(pucData_, uiLength_, aucMyValues.data(), uiMyValueCount, abMyLookup);
+}
+
+} // namespace novatel::edie
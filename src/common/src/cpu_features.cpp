@@ -0,0 +1,93 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file cpu_features.cpp
+// ===============================================================================
+
+#include "novatel_edie/common/cpu_features.hpp"
+
+#if defined(EDIE_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace novatel::edie {
+
+//-----------------------------------------------------------------------
+static SIMD_LEVEL DetectSimdLevel() noexcept
+{
+#ifdef EDIE_SIMD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+    int aiCpuInfo[4];
+    __cpuid(aiCpuInfo, 0);
+    const int iMaxLeaf = aiCpuInfo[0];
+    __cpuid(aiCpuInfo, 1);
+    const bool bOsXSave = (aiCpuInfo[2] & (1 << 27)) != 0;
+    const bool bAvx = (aiCpuInfo[2] & (1 << 28)) != 0;
+    // AVX2 also requires the OS to preserve the YMM registers on context switches
+    if (iMaxLeaf >= 7 && bOsXSave && bAvx && (_xgetbv(0) & 0x6) == 0x6)
+    {
+        __cpuidex(aiCpuInfo, 7, 0);
+        if ((aiCpuInfo[1] & (1 << 5)) != 0) { return SIMD_LEVEL::AVX2; }
+    }
+    return SIMD_LEVEL::SSE2;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? SIMD_LEVEL::AVX2 : SIMD_LEVEL::SSE2;
+#endif
+#else
+    return SIMD_LEVEL::SCALAR;
+#endif
+}
+
+//-----------------------------------------------------------------------
+static bool DetectPclmul() noexcept
+{
+#ifdef EDIE_SIMD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+    int aiCpuInfo[4];
+    __cpuid(aiCpuInfo, 1);
+    return (aiCpuInfo[2] & (1 << 1)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul");
+#endif
+#else
+    return false;
+#endif
+}
+
+//-----------------------------------------------------------------------
+SIMD_LEVEL GetSupportedSimdLevel() noexcept
+{
+    static const SIMD_LEVEL eSupportedLevel = DetectSimdLevel();
+    return eSupportedLevel;
+}
+
+//-----------------------------------------------------------------------
+bool IsPclmulSupported() noexcept
+{
+    static const bool bSupported = DetectPclmul();
+    return bSupported;
+}
+
+} // namespace novatel::edie
@@ -0,0 +1,148 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file crc.cpp
+// ===============================================================================
+
+#include "novatel_edie/common/crc.hpp"
+
+#include "novatel_edie/common/cpu_features.hpp"
+
+#ifdef EDIE_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace novatel::edie {
+
+#ifdef EDIE_SIMD_X86
+//-----------------------------------------------------------------------
+// Fold a block of at least 64 bytes whose length is a multiple of 16 into the running
+// (non-inverted) CRC register. This is the bit-reflected variant of the algorithm in
+// Gopal et al., "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction",
+// Intel, 2009. The constants are x^(n) mod P(x) for the fold distances of 512, 128 and 64
+// bits, followed by the Barrett reduction constants, all for P(x) = 0x104C11DB7.
+//-----------------------------------------------------------------------
+EDIE_TARGET_PCLMUL static uint32_t FoldCrc32(const unsigned char* ucBuffer_, size_t uiCount_, const uint32_t uiCrc_)
+{
+    alignas(16) static constexpr uint64_t k1k2[] = {0x0154442BD4ULL, 0x01C6E41596ULL};
+    alignas(16) static constexpr uint64_t k3k4[] = {0x01751997D0ULL, 0x00CCAA009EULL};
+    alignas(16) static constexpr uint64_t k5k0[] = {0x0163CD6124ULL, 0x0000000000ULL};
+    alignas(16) static constexpr uint64_t poly[] = {0x01DB710641ULL, 0x01F7011641ULL};
+
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ucBuffer_ + 0x00));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ucBuffer_ + 0x10));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ucBuffer_ + 0x20));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ucBuffer_ + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(uiCrc_)));
+
+    __m128i x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+    ucBuffer_ += 64;
+    uiCount_ -= 64;
+
+    // Fold four 128-bit lanes in parallel, 64 bytes per iteration
+    while (uiCount_ >= 64)
+    {
+        const __m128i x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        const __m128i x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        const __m128i x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        const __m128i x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(ucBuffer_ + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(ucBuffer_ + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(ucBuffer_ + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(ucBuffer_ + 0x30)));
+
+        ucBuffer_ += 64;
+        uiCount_ -= 64;
+    }
+
+    // Fold the four lanes into one
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+    for (const __m128i& xNext : {x2, x3, x4})
+    {
+        const __m128i x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, xNext), x5);
+    }
+
+    // Fold any remaining 16 byte blocks
+    while (uiCount_ >= 16)
+    {
+        const __m128i x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(ucBuffer_))), x5);
+
+        ucBuffer_ += 16;
+        uiCount_ -= 16;
+    }
+
+    // Fold 128 bits down to 64 bits
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduce to 32 bits
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), x0, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+}
+#endif
+
+//-----------------------------------------------------------------------
+bool IsCrc32FoldingSupported() noexcept
+{
+#ifdef EDIE_SIMD_X86
+    return IsPclmulSupported();
+#else
+    return false;
+#endif
+}
+
+//-----------------------------------------------------------------------
+uint32_t CalculateBlockCrc32Folding(const unsigned char* ucBuffer_, const uint32_t uiCount_, const uint32_t uiInitialCrc_) noexcept
+{
+#ifdef EDIE_SIMD_X86
+    if (uiCount_ >= CRC32_FOLDING_MIN_LENGTH && IsPclmulSupported())
+    {
+        const uint32_t uiFoldedBytes = uiCount_ & ~static_cast<uint32_t>(15);
+        const uint32_t uiCrc = FoldCrc32(ucBuffer_, uiFoldedBytes, uiInitialCrc_);
+        return CalculateBlockCrc<uint32_t, 0xEDB88320UL, true>(ucBuffer_ + uiFoldedBytes, uiCount_ - uiFoldedBytes, uiCrc);
+    }
+#endif
+    return CalculateBlockCrc<uint32_t, 0xEDB88320UL, true>(ucBuffer_, uiCount_, uiInitialCrc_);
+}
+
+} // namespace novatel::edie
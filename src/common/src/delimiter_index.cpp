@@ -0,0 +1,181 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file delimiter_index.cpp
+// ===============================================================================
+
+#include "novatel_edie/common/delimiter_index.hpp"
+
+#include <new>
+
+#ifdef EDIE_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace novatel::edie {
+
+namespace {
+
+//-----------------------------------------------------------------------
+// The bitmaps of one 64-byte chunk, the nth bit of each mask standing for the nth byte
+struct ChunkMasks
+{
+    uint64_t ullField;
+    uint64_t ullEnd;
+    uint64_t ullQuote;
+};
+
+using ChunkFunction = ChunkMasks (*)(const char*, char, char);
+
+//-----------------------------------------------------------------------
+ChunkMasks IndexChunkScalar(const char* pcChunk_, const char cFieldDelimiter_, const char cEndDelimiter_)
+{
+    ChunkMasks stMasks{0, 0, 0};
+    for (uint32_t i = 0; i < 64; ++i)
+    {
+        const char cValue = pcChunk_[i];
+        stMasks.ullField |= static_cast<uint64_t>(cValue == cFieldDelimiter_) << i;
+        stMasks.ullEnd |= static_cast<uint64_t>(cValue == cEndDelimiter_ || cValue == '\0') << i;
+        stMasks.ullQuote |= static_cast<uint64_t>(cValue == '\"') << i;
+    }
+    return stMasks;
+}
+
+#ifdef EDIE_SIMD_X86
+//-----------------------------------------------------------------------
+ChunkMasks IndexChunkSse2(const char* pcChunk_, const char cFieldDelimiter_, const char cEndDelimiter_)
+{
+    const __m128i field = _mm_set1_epi8(cFieldDelimiter_);
+    const __m128i end = _mm_set1_epi8(cEndDelimiter_);
+    const __m128i quote = _mm_set1_epi8('\"');
+    const __m128i zero = _mm_setzero_si128();
+
+    ChunkMasks stMasks{0, 0, 0};
+    for (uint32_t i = 0; i < 64; i += sizeof(__m128i))
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pcChunk_ + i));
+        const __m128i ends = _mm_or_si128(_mm_cmpeq_epi8(block, end), _mm_cmpeq_epi8(block, zero));
+        stMasks.ullField |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, field)))) << i;
+        stMasks.ullEnd |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(ends))) << i;
+        stMasks.ullQuote |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, quote)))) << i;
+    }
+    return stMasks;
+}
+
+//-----------------------------------------------------------------------
+EDIE_TARGET_AVX2 ChunkMasks IndexChunkAvx2(const char* pcChunk_, const char cFieldDelimiter_, const char cEndDelimiter_)
+{
+    const __m256i field = _mm256_set1_epi8(cFieldDelimiter_);
+    const __m256i end = _mm256_set1_epi8(cEndDelimiter_);
+    const __m256i quote = _mm256_set1_epi8('\"');
+    const __m256i zero = _mm256_setzero_si256();
+
+    ChunkMasks stMasks{0, 0, 0};
+    for (uint32_t i = 0; i < 64; i += sizeof(__m256i))
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pcChunk_ + i));
+        const __m256i ends = _mm256_or_si256(_mm256_cmpeq_epi8(block, end), _mm256_cmpeq_epi8(block, zero));
+        stMasks.ullField |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, field)))) << i;
+        stMasks.ullEnd |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(ends))) << i;
+        stMasks.ullQuote |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, quote)))) << i;
+    }
+    return stMasks;
+}
+#endif
+
+//-----------------------------------------------------------------------
+ChunkFunction SelectChunkFunction(const SIMD_LEVEL eLevel_)
+{
+    switch (GetDispatchSimdLevel(eLevel_))
+    {
+#ifdef EDIE_SIMD_X86
+    case SIMD_LEVEL::AVX2: return IndexChunkAvx2;
+    case SIMD_LEVEL::SSE2: return IndexChunkSse2;
+#endif
+    default: return IndexChunkScalar;
+    }
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------
+DelimiterIndex::DelimiterIndex(const char cFieldDelimiter_, const char cEndDelimiter_) noexcept
+    : acMyTokenDelimiters{cFieldDelimiter_, cEndDelimiter_, '\0', '\0'}, acMyQuotedDelimiters{'\"', cEndDelimiter_, '\0', '\0'},
+      acMyRemainingDelimiters{cEndDelimiter_, '\0'}
+{
+}
+
+//-----------------------------------------------------------------------
+bool DelimiterIndex::Build(const char* pcData_, const size_t uiLength_) noexcept
+{
+    static const SIMD_LEVEL eSupportedLevel = GetSupportedSimdLevel();
+    return Build(pcData_, uiLength_, eSupportedLevel);
+}
+
+//-----------------------------------------------------------------------
+bool DelimiterIndex::Build(const char* pcData_, const size_t uiLength_, const SIMD_LEVEL eLevel_) noexcept
+{
+    Clear();
+    if (uiLength_ > MAX_LENGTH) { return false; }
+
+    const size_t uiBlockCount = (uiLength_ + 63) / 64;
+    if (vMyBlocks.size() < uiBlockCount)
+    {
+        try
+        {
+            vMyBlocks.resize(uiBlockCount);
+        }
+        catch (const std::bad_alloc&)
+        {
+            return false;
+        }
+    }
+
+    const ChunkFunction pfIndexChunk = SelectChunkFunction(eLevel_);
+    const char cFieldDelimiter = acMyTokenDelimiters[0];
+    const char cEndDelimiter = acMyTokenDelimiters[1];
+
+    size_t uiBlock = 0;
+    for (; (uiBlock + 1) * 64 <= uiLength_; ++uiBlock)
+    {
+        const ChunkMasks stMasks = pfIndexChunk(pcData_ + uiBlock * 64, cFieldDelimiter, cEndDelimiter);
+        vMyBlocks[uiBlock] = {stMasks.ullField, stMasks.ullEnd, stMasks.ullQuote};
+    }
+
+    // Copy the tail into a full chunk so the vector loads stay within the block, then drop the padding bits
+    const size_t uiTailLength = uiLength_ - uiBlock * 64;
+    if (uiTailLength > 0)
+    {
+        char acTail[64] = {};
+        memcpy(acTail, pcData_ + uiBlock * 64, uiTailLength);
+        const ChunkMasks stMasks = pfIndexChunk(acTail, cFieldDelimiter, cEndDelimiter);
+        const uint64_t ullValid = (uint64_t{1} << uiTailLength) - 1;
+        vMyBlocks[uiBlock] = {stMasks.ullField & ullValid, stMasks.ullEnd & ullValid, stMasks.ullQuote & ullValid};
+    }
+
+    pcMyData = pcData_;
+    uiMyLength = uiLength_;
+    return true;
+}
+
+} // namespace novatel::edie
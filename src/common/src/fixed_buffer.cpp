@@ -0,0 +1,94 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file fixed_buffer.cpp
+// ===============================================================================
+
+#include "novatel_edie/common/fixed_buffer.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace novatel::edie {
+
+//-----------------------------------------------------------------------
+size_t GetMirroredMemoryGranularity() noexcept
+{
+#if defined(__linux__)
+    const long lPageSize = sysconf(_SC_PAGESIZE);
+    return lPageSize > 0 ? static_cast<size_t>(lPageSize) : 0;
+#else
+    return 0;
+#endif
+}
+
+//-----------------------------------------------------------------------
+void* AllocateMirroredMemory(const size_t uiSize_) noexcept
+{
+#if defined(__linux__)
+    if (uiSize_ == 0) { return nullptr; }
+
+    const int iFd = memfd_create("edie_fixed_buffer", MFD_CLOEXEC);
+    if (iFd < 0) { return nullptr; }
+
+    void* pvBase = MAP_FAILED;
+    if (ftruncate(iFd, static_cast<off_t>(uiSize_)) == 0)
+    {
+        // Reserve the whole range first so that nothing else can be mapped between the two views
+        pvBase = mmap(nullptr, 2 * uiSize_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    if (pvBase != MAP_FAILED)
+    {
+        auto* pucBase = static_cast<unsigned char*>(pvBase);
+        if (mmap(pucBase, uiSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFd, 0) == MAP_FAILED ||
+            mmap(pucBase + uiSize_, uiSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFd, 0) == MAP_FAILED)
+        {
+            munmap(pvBase, 2 * uiSize_);
+            pvBase = MAP_FAILED;
+        }
+    }
+
+    // The mappings keep the memory alive after the descriptor is closed
+    close(iFd);
+    return pvBase == MAP_FAILED ? nullptr : pvBase;
+#else
+    static_cast<void>(uiSize_);
+    return nullptr;
+#endif
+}
+
+//-----------------------------------------------------------------------
+void FreeMirroredMemory(void* pvMemory_, const size_t uiSize_) noexcept
+{
+#if defined(__linux__)
+    if (pvMemory_ != nullptr) { munmap(pvMemory_, 2 * uiSize_); }
+#else
+    static_cast<void>(pvMemory_);
+    static_cast<void>(uiSize_);
+#endif
+}
+
+} // namespace novatel::edie
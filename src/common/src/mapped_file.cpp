@@ -0,0 +1,78 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file mapped_file.cpp
+// ===============================================================================
+
+#include "novatel_edie/common/mapped_file.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace novatel::edie {
+
+//-----------------------------------------------------------------------
+bool MappedFile::Open(const std::filesystem::path& clPath_)
+{
+    Close();
+
+#if defined(__unix__) || defined(__APPLE__)
+    const int iFd = open(clPath_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (iFd < 0) { return false; }
+
+    struct stat stStat{};
+    void* pvData = MAP_FAILED;
+    // Pipes and other special files report no useful size and must be streamed instead
+    if (fstat(iFd, &stStat) == 0 && S_ISREG(stStat.st_mode) && stStat.st_size > 0)
+    {
+        pvData = mmap(nullptr, static_cast<size_t>(stStat.st_size), PROT_READ, MAP_PRIVATE, iFd, 0);
+    }
+    // The mapping keeps its own reference to the file
+    close(iFd);
+    if (pvData == MAP_FAILED) { return false; }
+
+    static_cast<void>(madvise(pvData, static_cast<size_t>(stStat.st_size), MADV_SEQUENTIAL));
+    pucMyData = static_cast<const unsigned char*>(pvData);
+    ullMySize = static_cast<uint64_t>(stStat.st_size);
+    return true;
+#else
+    static_cast<void>(clPath_);
+    return false;
+#endif
+}
+
+//-----------------------------------------------------------------------
+void MappedFile::Close() noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    if (pucMyData != nullptr) { munmap(const_cast<unsigned char*>(pucMyData), static_cast<size_t>(ullMySize)); }
+#endif
+    pucMyData = nullptr;
+    ullMySize = 0;
+}
+
+} // namespace novatel::edie
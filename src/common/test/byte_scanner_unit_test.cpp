@@ -0,0 +1,92 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file byte_scanner_unit_test.cpp
+// ===============================================================================
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "novatel_edie/common/byte_scanner.hpp"
+
+using namespace novatel::edie;
+
+constexpr ByteScanner clSyncScanner{0xAA, '#', '%', '<', '$'};
+constexpr SIMD_LEVEL aeSimdLevels[] = {SIMD_LEVEL::SCALAR, SIMD_LEVEL::SSE2, SIMD_LEVEL::AVX2};
+
+// -------------------------------------------------------------------------------------------------------
+// ByteScanner Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST(ByteScannerTest, Contains)
+{
+    ASSERT_TRUE(clSyncScanner.Contains('#'));
+    ASSERT_TRUE(clSyncScanner.Contains(0xAA));
+    ASSERT_FALSE(clSyncScanner.Contains('{'));
+    ASSERT_FALSE(clSyncScanner.Contains(0x00));
+}
+
+TEST(ByteScannerTest, NoMatch)
+{
+    const std::vector<unsigned char> vData(1000, 'x');
+
+    for (const SIMD_LEVEL eLevel : aeSimdLevels)
+    {
+        ASSERT_EQ(clSyncScanner.Find(vData.data(), vData.size(), eLevel), vData.size());
+        ASSERT_EQ(clSyncScanner.Find(vData.data(), 0, eLevel), 0U);
+    }
+    ASSERT_EQ(clSyncScanner.Find(vData.data(), vData.size()), vData.size());
+}
+
+TEST(ByteScannerTest, MatchAtEveryPosition)
+{
+    // Cover matches in the vector body and in the scalar tail of every implementation
+    constexpr size_t uiLength = 100;
+    const unsigned char aucSyncBytes[] = {0xAA, '#', '%', '<', '$'};
+
+    for (size_t uiPosition = 0; uiPosition < uiLength; ++uiPosition)
+    {
+        std::vector<unsigned char> vData(uiLength, 0x55);
+        vData[uiPosition] = aucSyncBytes[uiPosition % sizeof(aucSyncBytes)];
+        if (uiPosition + 3 < uiLength) { vData[uiPosition + 3] = '#'; }
+
+        for (const SIMD_LEVEL eLevel : aeSimdLevels) { ASSERT_EQ(clSyncScanner.Find(vData.data(), vData.size(), eLevel), uiPosition); }
+        ASSERT_EQ(clSyncScanner.Find(vData.data(), vData.size()), uiPosition);
+    }
+}
+
+TEST(ByteScannerTest, Add)
+{
+    ByteScanner clScanner;
+    const std::vector<unsigned char> vData{'x', '<', '#'};
+    ASSERT_EQ(clScanner.Find(vData.data(), vData.size()), vData.size());
+
+    ASSERT_TRUE(clScanner.Add('#'));
+    ASSERT_TRUE(clScanner.Add('#'));
+    ASSERT_EQ(clScanner.Find(vData.data(), vData.size()), 2U);
+
+    for (unsigned char ucValue = 0; ucValue < ByteScanner::MAX_VALUES - 1; ++ucValue) { ASSERT_TRUE(clScanner.Add(ucValue)); }
+    ASSERT_FALSE(clScanner.Add('<'));
+    ASSERT_FALSE(clScanner.Contains('<'));
+    ASSERT_TRUE(clScanner.Add(0));
+}
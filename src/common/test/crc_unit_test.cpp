@@ -24,6 +24,8 @@
 // ! \file crc_unit_test.cpp
 // ===============================================================================
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "novatel_edie/decoders/oem/crc.hpp"
@@ -88,6 +90,27 @@ TEST(CRC32Test, CalculateBlockCRC32_Koopman_reflected)
     ASSERT_EQ(uiCalculatedCRC, 0x904CDDBFUL);
 }
 
+TEST(CRC32Test, CalculateBlockCRC32_Folding_matches_slice_by_8)
+{
+    std::vector<unsigned char> vData(32 * 1024 + 7);
+    for (size_t i = 0; i < vData.size(); ++i) { vData[i] = static_cast<unsigned char>((i * 2654435761U) >> 13); }
+
+    std::vector<uint32_t> vLengths;
+    for (uint32_t uiLength = 0; uiLength <= 300; ++uiLength) { vLengths.push_back(uiLength); }
+    vLengths.push_back(static_cast<uint32_t>(vData.size()));
+
+    for (const uint32_t uiLength : vLengths)
+    {
+        for (const uint32_t uiInitialCrc : {0x00000000UL, 0xFFFFFFFFUL, 0x42D4F5CCUL})
+        {
+            const uint32_t uiExpected = novatel::edie::CalculateBlockCrc<uint32_t, 0xEDB88320UL, true>(vData.data(), uiLength, uiInitialCrc);
+            ASSERT_EQ(novatel::edie::CalculateBlockCrc32Folding(vData.data(), uiLength, uiInitialCrc), uiExpected) << uiLength;
+            ASSERT_EQ(novatel::edie::CalculateBlockCrc32(vData.data(), uiLength, uiInitialCrc), uiExpected) << uiLength;
+            ASSERT_EQ(CalculateBlockCrc32(vData.data(), uiLength, uiInitialCrc), uiExpected) << uiLength;
+        }
+    }
+}
+
 // -------------------------------------------------------------------------------------------------------
 // CRC16 Unit Tests
 // -------------------------------------------------------------------------------------------------------
@@ -0,0 +1,126 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file delimiter_index_unit_test.cpp
+// ===============================================================================
+
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "novatel_edie/common/delimiter_index.hpp"
+
+using namespace novatel::edie;
+
+constexpr SIMD_LEVEL aeIndexSimdLevels[] = {SIMD_LEVEL::SCALAR, SIMD_LEVEL::SSE2, SIMD_LEVEL::AVX2};
+
+// Check every lookup from every position against strcspn()
+static void ExpectMatchesStrcspn(const DelimiterIndex& clIndex_, const std::string& strText_, const char cFieldDelimiter_, const char cEndDelimiter_)
+{
+    const char acTokenDelimiters[] = {cFieldDelimiter_, cEndDelimiter_, '\0'};
+    const char acQuotedDelimiters[] = {'\"', cEndDelimiter_, '\0'};
+    const char acRemainingDelimiters[] = {cEndDelimiter_, '\0'};
+
+    for (size_t i = 0; i <= strText_.size(); ++i)
+    {
+        const char* pcToken = strText_.c_str() + i;
+        ASSERT_EQ(clIndex_.TokenLength(pcToken), strcspn(pcToken, acTokenDelimiters)) << "at " << i;
+        ASSERT_EQ(clIndex_.QuotedLength(pcToken), strcspn(pcToken, acQuotedDelimiters)) << "at " << i;
+        ASSERT_EQ(clIndex_.RemainingLength(pcToken), strcspn(pcToken, acRemainingDelimiters)) << "at " << i;
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+// DelimiterIndex Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST(DelimiterIndexTest, AsciiLog)
+{
+    // Long enough to span several 64-byte chunks and leave a partial one, with delimiters inside a quoted string
+    const std::string strBody = "SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,\"a,b*c\",-17.0000,WGS84,1.3648,1.1806,3.1112,"
+                                "\"\",0.000,0.000,18,18,18,0,00,02,11,01,\"unterminated*c3194e35\r\n";
+
+    for (const SIMD_LEVEL eLevel : aeIndexSimdLevels)
+    {
+        DelimiterIndex clIndex(',', '*');
+        ASSERT_TRUE(clIndex.Build(strBody.c_str(), strBody.size(), eLevel));
+        ExpectMatchesStrcspn(clIndex, strBody, ',', '*');
+    }
+}
+
+TEST(DelimiterIndexTest, AbbreviatedAsciiLog)
+{
+    const std::string strBody = "<     SOL_COMPUTED SINGLE 51.15043874397 -114.03066788586 1097.6822 -17.0000 WGS84 1.3648 1.1806 3.1112\r\n"
+                                "<     \"my base\" 0.000 0.000 18 18 18 0 00 02 11 01\r\n";
+
+    for (const SIMD_LEVEL eLevel : aeIndexSimdLevels)
+    {
+        DelimiterIndex clIndex(' ', '\r');
+        ASSERT_TRUE(clIndex.Build(strBody.c_str(), strBody.size(), eLevel));
+        ExpectMatchesStrcspn(clIndex, strBody, ' ', '\r');
+    }
+}
+
+TEST(DelimiterIndexTest, LookupsBeyondTheBlock)
+{
+    // Only the first part is indexed, lookups that run past it or start outside of it continue in the text
+    const std::string strText = "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789,\"quoted\"*";
+
+    for (const size_t uiIndexed : {size_t{0}, size_t{10}, size_t{64}, size_t{70}})
+    {
+        DelimiterIndex clIndex(',', '*');
+        ASSERT_TRUE(clIndex.Build(strText.c_str(), uiIndexed));
+        ExpectMatchesStrcspn(clIndex, strText, ',', '*');
+    }
+
+    DelimiterIndex clEmptyIndex(',', '*');
+    ExpectMatchesStrcspn(clEmptyIndex, strText, ',', '*');
+}
+
+TEST(DelimiterIndexTest, TooLong)
+{
+    const std::string strText(DelimiterIndex::MAX_LENGTH + 1, ',');
+
+    DelimiterIndex clIndex(',', '*');
+    ASSERT_FALSE(clIndex.Build(strText.c_str(), strText.size()));
+    ASSERT_EQ(clIndex.TokenLength(strText.c_str() + 5), 0U);
+    ASSERT_TRUE(clIndex.Build(strText.c_str(), DelimiterIndex::MAX_LENGTH));
+    ASSERT_EQ(clIndex.TokenLength(strText.c_str() + DelimiterIndex::MAX_LENGTH - 1), 0U);
+}
+
+TEST(DelimiterIndexTest, Reused)
+{
+    // An index reused for a shorter block after a longer one, then emptied
+    const std::string strLong = std::string(200, 'a') + ",b,\"c,d\"*";
+    const std::string strShort = "x,y*";
+
+    DelimiterIndex clIndex(',', '*');
+    ASSERT_TRUE(clIndex.Build(strLong.c_str(), strLong.size()));
+    ExpectMatchesStrcspn(clIndex, strLong, ',', '*');
+    ASSERT_TRUE(clIndex.Build(strShort.c_str(), strShort.size()));
+    ExpectMatchesStrcspn(clIndex, strShort, ',', '*');
+    ExpectMatchesStrcspn(clIndex, strLong, ',', '*');
+
+    clIndex.Clear();
+    ExpectMatchesStrcspn(clIndex, strShort, ',', '*');
+}
@@ -0,0 +1,222 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file fixed_buffer_unit_test.cpp
+// ===============================================================================
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "novatel_edie/common/fixed_buffer.hpp"
+
+using namespace novatel::edie;
+
+constexpr FIXED_BUFFER_BACKEND aeBackends[] = {FIXED_BUFFER_BACKEND::LINEAR, FIXED_BUFFER_BACKEND::MIRRORED};
+
+// -------------------------------------------------------------------------------------------------------
+// FixedBuffer Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST(FixedBufferTest, Backend)
+{
+    const UCharFixedBuffer clLinear(1000);
+    ASSERT_EQ(clLinear.backend(), FIXED_BUFFER_BACKEND::LINEAR);
+    ASSERT_EQ(clLinear.capacity(), 1000U);
+
+    const UCharFixedBuffer clMirrored(1000, FIXED_BUFFER_BACKEND::MIRRORED);
+    const size_t uiGranularity = GetMirroredMemoryGranularity();
+    if (uiGranularity == 0) { ASSERT_EQ(clMirrored.backend(), FIXED_BUFFER_BACKEND::LINEAR); }
+    else
+    {
+        // The capacity is rounded up to a whole number of pages
+        ASSERT_EQ(clMirrored.backend(), FIXED_BUFFER_BACKEND::MIRRORED);
+        ASSERT_EQ(clMirrored.capacity() % uiGranularity, 0U);
+        ASSERT_GE(clMirrored.capacity(), 1000U);
+    }
+}
+
+TEST(FixedBufferTest, MirroredMemoryAliases)
+{
+    const size_t uiGranularity = GetMirroredMemoryGranularity();
+    if (uiGranularity == 0) { GTEST_SKIP() << "Mirrored memory is not supported on this platform"; }
+
+    auto* pucMemory = static_cast<unsigned char*>(AllocateMirroredMemory(uiGranularity));
+    ASSERT_NE(pucMemory, nullptr);
+    pucMemory[0] = 0x12;
+    pucMemory[uiGranularity + 1] = 0x34;
+    ASSERT_EQ(pucMemory[uiGranularity], 0x12);
+    ASSERT_EQ(pucMemory[1], 0x34);
+    FreeMirroredMemory(pucMemory, uiGranularity);
+}
+
+TEST(FixedBufferTest, StreamAcrossWrap)
+{
+    // Push a counting sequence through the buffer in uneven chunks so that the head wraps many times,
+    // and check every access method sees the same logical contents regardless of the backend.
+    for (const FIXED_BUFFER_BACKEND eBackend : aeBackends)
+    {
+        UCharFixedBuffer clBuffer(4096, eBackend);
+        const size_t uiCapacity = clBuffer.capacity();
+
+        std::vector<unsigned char> vSource(uiCapacity * 7);
+        std::iota(vSource.begin(), vSource.end(), static_cast<unsigned char>(0));
+
+        size_t uiWritten = 0;
+        size_t uiConsumed = 0;
+        std::vector<unsigned char> vCopy(uiCapacity);
+
+        while (uiConsumed < vSource.size())
+        {
+            const size_t uiWriteCount = std::min({clBuffer.available_space(), vSource.size() - uiWritten, uiCapacity / 3 + 17});
+            ASSERT_EQ(clBuffer.write(vSource.data() + uiWritten, uiWriteCount), uiWriteCount);
+            uiWritten += uiWriteCount;
+
+            // data() and operator[] must expose every unconsumed byte contiguously
+            ASSERT_EQ(clBuffer.size(), uiWritten - uiConsumed);
+            ASSERT_EQ(std::memcmp(clBuffer.data(), vSource.data() + uiConsumed, clBuffer.size()), 0);
+            ASSERT_EQ(clBuffer[clBuffer.size() - 1], vSource[uiWritten - 1]);
+
+            clBuffer.copy_out(vCopy.data(), clBuffer.size());
+            ASSERT_EQ(std::memcmp(vCopy.data(), vSource.data() + uiConsumed, clBuffer.size()), 0);
+
+            if (clBuffer.size() >= sizeof(uint32_t))
+            {
+                uint32_t uiExpected;
+                std::memcpy(&uiExpected, vSource.data() + uiWritten - sizeof(uint32_t), sizeof(uint32_t));
+                ASSERT_EQ(clBuffer.read_value<uint32_t>(clBuffer.size() - sizeof(uint32_t)), uiExpected);
+            }
+
+            const unsigned char ucLast = vSource[uiWritten - 1];
+            const size_t uiFound = clBuffer.search_char(ucLast, clBuffer.size() > 256 ? clBuffer.size() - 256 : 0);
+            ASSERT_NE(uiFound, UCharFixedBuffer::npos);
+            ASSERT_EQ(clBuffer[uiFound], ucLast);
+
+            const size_t uiEraseCount = std::min(clBuffer.size(), uiCapacity / 4 + 5);
+            clBuffer.erase_begin(uiEraseCount);
+            uiConsumed += uiEraseCount;
+        }
+        ASSERT_TRUE(clBuffer.empty());
+    }
+}
+
+TEST(FixedBufferTest, EraseLeavesElementsInPlace)
+{
+    // Batches of frames point at erased elements, which must stay readable until the next write
+    for (const FIXED_BUFFER_BACKEND eBackend : aeBackends)
+    {
+        UCharFixedBuffer clBuffer(4096, eBackend);
+        const size_t uiCapacity = clBuffer.capacity();
+
+        std::vector<unsigned char> vSource(uiCapacity);
+        std::iota(vSource.begin(), vSource.end(), static_cast<unsigned char>(0));
+
+        // Leave the head near the end of the first mapping so that it wraps while erasing
+        ASSERT_EQ(clBuffer.write(vSource.data(), uiCapacity - 10), uiCapacity - 10);
+        clBuffer.erase_begin(uiCapacity - 20);
+        ASSERT_EQ(clBuffer.write(vSource.data(), 90), 90U);
+
+        std::vector<unsigned char> vExpected(vSource.end() - 20, vSource.end() - 10);
+        vExpected.insert(vExpected.end(), vSource.begin(), vSource.begin() + 90);
+        const unsigned char* pucData = clBuffer.data();
+
+        clBuffer.erase_begin(40);
+        ASSERT_EQ(std::memcmp(pucData, vExpected.data(), vExpected.size()), 0);
+        clBuffer.erase_begin(60);
+        ASSERT_TRUE(clBuffer.empty());
+        ASSERT_EQ(std::memcmp(pucData, vExpected.data(), vExpected.size()), 0);
+    }
+}
+
+TEST(FixedBufferTest, SearchCharsPartialMatchAtEnd)
+{
+    for (const FIXED_BUFFER_BACKEND eBackend : aeBackends)
+    {
+        UCharFixedBuffer clBuffer(4096, eBackend);
+        const std::vector<unsigned char> vFiller(clBuffer.capacity() - 10, 'x');
+
+        // Advance the head most of the way through the buffer before searching
+        ASSERT_EQ(clBuffer.write(vFiller.data(), vFiller.size()), vFiller.size());
+        clBuffer.erase_begin(vFiller.size() - 1);
+
+        const unsigned char aucData[] = {'y', 0xAA, 0x44, 0x12, 'z', 0xAA, 0x44};
+        ASSERT_EQ(clBuffer.write(aucData, sizeof(aucData)), sizeof(aucData));
+
+        constexpr std::array<unsigned char, 3> aucSync{0xAA, 0x44, 0x12};
+        ASSERT_EQ(clBuffer.search_chars(aucSync, 0), 2U);
+        ASSERT_EQ(clBuffer.search_chars(aucSync, 3), 6U);
+        ASSERT_EQ(clBuffer.search_chars(aucSync, 0, 2), UCharFixedBuffer::npos);
+    }
+}
+
+TEST(FixedBufferTest, Attach)
+{
+    std::vector<unsigned char> vExternal(1 << 16);
+    std::iota(vExternal.begin(), vExternal.end(), static_cast<unsigned char>(0));
+
+    for (const FIXED_BUFFER_BACKEND eBackend : aeBackends)
+    {
+        UCharFixedBuffer clBuffer(4096, eBackend);
+        ASSERT_EQ(clBuffer.write(vExternal.data(), 10), 10U);
+
+        // Attaching discards the owned contents
+        clBuffer.attach(vExternal.data());
+        ASSERT_TRUE(clBuffer.attached());
+        ASSERT_TRUE(clBuffer.empty());
+
+        // Only the bytes directly following the window can be written, and they are not copied
+        ASSERT_EQ(clBuffer.write(vExternal.data() + 1, 10), 0U);
+        ASSERT_EQ(clBuffer.write(vExternal.data(), 100), 100U);
+        ASSERT_EQ(clBuffer.data(), vExternal.data());
+        ASSERT_EQ(clBuffer.write(vExternal.data() + 100, clBuffer.available_space()), clBuffer.capacity() - 100);
+        ASSERT_TRUE(clBuffer.full());
+        ASSERT_EQ(clBuffer.write(vExternal.data() + clBuffer.capacity(), 1), 0U);
+
+        // The window slides forward, even when it is emptied
+        clBuffer.erase_begin(clBuffer.size());
+        ASSERT_EQ(clBuffer.data(), vExternal.data() + clBuffer.capacity());
+        const size_t uiOffset = clBuffer.capacity();
+        ASSERT_EQ(clBuffer.write(vExternal.data() + uiOffset, 3000), 3000U);
+        clBuffer.erase_begin(1000);
+        ASSERT_EQ(clBuffer.data(), vExternal.data() + uiOffset + 1000);
+        ASSERT_EQ(clBuffer[0], vExternal[uiOffset + 1000]);
+        static_assert(std::is_same_v<decltype(clBuffer[0]), const unsigned char&>, "attached memory must not be writable through the buffer");
+        ASSERT_EQ(clBuffer.read_value<uint16_t>(5), static_cast<uint16_t>(vExternal[uiOffset + 1005] | (vExternal[uiOffset + 1006] << 8)));
+        ASSERT_EQ(clBuffer.search_char(vExternal[uiOffset + 1200], 0), 200U);
+
+        std::vector<unsigned char> vOut(2000);
+        clBuffer.copy_out(vOut.data(), vOut.size());
+        ASSERT_TRUE(std::equal(vOut.begin(), vOut.end(), vExternal.begin() + static_cast<ptrdiff_t>(uiOffset + 1000)));
+
+        // Detaching returns to the owned storage
+        clBuffer.detach();
+        ASSERT_FALSE(clBuffer.attached());
+        ASSERT_TRUE(clBuffer.empty());
+        const unsigned char aucData[] = {1, 2, 3};
+        ASSERT_EQ(clBuffer.write(aucData, sizeof(aucData)), sizeof(aucData));
+        ASSERT_NE(clBuffer.data(), aucData);
+        ASSERT_EQ(clBuffer[2], 3);
+    }
+}
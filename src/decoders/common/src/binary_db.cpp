@@ -0,0 +1,690 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file binary_db.cpp
+// ===============================================================================
+
+#include "novatel_edie/decoders/common/binary_db.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "novatel_edie/common/mapped_file.hpp"
+#include "novatel_edie/decoders/common/json_db_reader.hpp"
+
+namespace novatel::edie {
+
+namespace {
+
+//-----------------------------------------------------------------------
+// Image layout. Every record is a fixed-size struct of 32-bit or smaller
+// members without implicit padding. Records refer to each other by index
+// and to strings by offset into the string table, so the image holds no
+// pointers. Any change to the layout must bump BINARY_DB_VERSION.
+//-----------------------------------------------------------------------
+
+constexpr char BINARY_DB_MAGIC[8] = {'E', 'D', 'I', 'E', 'M', 'D', 'B', '\0'};
+constexpr uint32_t BINARY_DB_VERSION = 1;
+constexpr uint32_t BINARY_DB_BYTE_ORDER = 0x01020304;
+constexpr uint32_t NO_FIELD_INFO = std::numeric_limits<uint32_t>::max();
+// Field arrays are read recursively, so a chain of nested field arrays deeper than this is rejected
+constexpr uint32_t MAX_FIELD_ARRAY_DEPTH = 32;
+
+struct StringRef
+{
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct TableRef
+{
+    uint32_t offset; // byte offset of the table in the image
+    uint32_t count;  // number of records, or of bytes for the string table
+};
+
+struct ImageHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t imageSize;
+    uint32_t hasMetadata;
+    StringRef subset;
+    StringRef dbVersion;
+    StringRef messageFamily;
+    TableRef strings;
+    TableRef enums;
+    TableRef enumerators;
+    TableRef messages;
+    TableRef fieldInfos;
+    TableRef fields;
+};
+
+struct EnumRecord
+{
+    StringRef id;
+    StringRef name;
+    uint32_t firstEnumerator;
+    uint32_t enumeratorCount;
+};
+
+struct EnumeratorRecord
+{
+    uint32_t value;
+    StringRef name;
+    StringRef description;
+};
+
+struct MessageRecord
+{
+    StringRef id;
+    StringRef name;
+    StringRef description;
+    uint32_t logId;
+    uint32_t latestMessageCrc;
+    uint32_t firstFieldInfo; // one FieldInfo record per definition CRC, sorted by CRC
+    uint32_t fieldInfoCount;
+};
+
+struct FieldInfoRecord
+{
+    uint32_t crc; // 0 for the fields of a field array
+    uint32_t fixedFieldBytes;
+    uint32_t varFieldCount;
+    uint32_t firstField;
+    uint32_t fieldCount;
+};
+
+//! The class of a field definition, which operator== compares.
+enum class FIELD_CLASS : uint8_t
+{
+    BASE,
+    ENUM,
+    ARRAY,
+    FIELD_ARRAY
+};
+
+enum FIELD_FLAGS : uint8_t
+{
+    HAS_WIDTH = 0x01,
+    HAS_PRECISION = 0x02,
+    IS_STRING = 0x04,
+    IS_CSV = 0x08
+};
+
+struct FieldRecord
+{
+    StringRef name;
+    StringRef description;
+    StringRef conversion;
+    StringRef dataTypeDescription;
+    StringRef enumId;
+    StringRef arrayLengthRef;
+    uint32_t index;
+    uint32_t arrayLength;
+    uint32_t fieldSize;
+    uint32_t fieldInfo; // FieldInfo record of a field array, NO_FIELD_INFO otherwise
+    int32_t width;
+    int32_t precision;
+    uint32_t conversionHash;
+    uint16_t dataTypeLength;
+    uint8_t fieldType;
+    uint8_t dataType;
+    uint8_t arrayLengthFieldSize;
+    uint8_t fieldClass;
+    uint8_t flags;
+    uint8_t reserved;
+};
+
+static_assert(sizeof(ImageHeader) == 96 && sizeof(EnumRecord) == 24 && sizeof(EnumeratorRecord) == 20 && sizeof(MessageRecord) == 40 &&
+                  sizeof(FieldInfoRecord) == 20 && sizeof(FieldRecord) == 84,
+              "Binary database records must not contain implicit padding");
+
+//-----------------------------------------------------------------------
+//! Whether a field of the given type may be defined by the given class. The decoders rely on ENUM,
+//! array and FIELD_ARRAY fields having the matching subclass, and a STRING may be either a plain or
+//! an array field.
+bool IsFieldClassOf(FIELD_CLASS eClass_, FIELD_TYPE eType_)
+{
+    switch (eType_)
+    {
+    case FIELD_TYPE::ENUM: return eClass_ == FIELD_CLASS::ENUM;
+    case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
+    case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: return eClass_ == FIELD_CLASS::ARRAY;
+    case FIELD_TYPE::STRING: return eClass_ == FIELD_CLASS::ARRAY || eClass_ == FIELD_CLASS::BASE;
+    case FIELD_TYPE::FIELD_ARRAY: return eClass_ == FIELD_CLASS::FIELD_ARRAY;
+    default: return eClass_ == FIELD_CLASS::BASE;
+    }
+}
+
+//-----------------------------------------------------------------------
+uint32_t ToUint32(size_t value_, const char* what_)
+{
+    if (value_ > std::numeric_limits<uint32_t>::max()) { throw std::runtime_error(std::string(what_) + " does not fit in the binary format"); }
+    return static_cast<uint32_t>(value_);
+}
+
+//============================================================================
+//! \brief Builds the tables of an image from a MessageDatabase.
+//============================================================================
+class ImageWriter
+{
+  public:
+    std::vector<unsigned char> Write(const MessageDatabase& clMessageDb_)
+    {
+        ImageHeader stHeader{};
+        std::memcpy(stHeader.magic, BINARY_DB_MAGIC, sizeof(BINARY_DB_MAGIC));
+        stHeader.version = BINARY_DB_VERSION;
+        stHeader.byteOrder = BINARY_DB_BYTE_ORDER;
+
+        if (const auto pstMetadata = clMessageDb_.GetDbMetadata())
+        {
+            stHeader.hasMetadata = 1;
+            stHeader.subset = AddString(pstMetadata->subset);
+            stHeader.dbVersion = AddString(pstMetadata->version);
+            stHeader.messageFamily = AddString(pstMetadata->messageFamily);
+        }
+
+        for (const auto& pstEnumDef : clMessageDb_.EnumDefinitions()) { AddEnum(*pstEnumDef); }
+        for (const auto& pstMsgDef : clMessageDb_.MessageDefinitions()) { AddMessage(*pstMsgDef); }
+
+        std::vector<unsigned char> vImage(sizeof(ImageHeader));
+        stHeader.enums = AppendTable(vImage, vEnums);
+        stHeader.enumerators = AppendTable(vImage, vEnumerators);
+        stHeader.messages = AppendTable(vImage, vMessages);
+        stHeader.fieldInfos = AppendTable(vImage, vFieldInfos);
+        stHeader.fields = AppendTable(vImage, vFields);
+        stHeader.strings = {ToUint32(vImage.size(), "The image"), ToUint32(sStrings.size(), "The string table")};
+        vImage.insert(vImage.end(), sStrings.begin(), sStrings.end());
+        stHeader.imageSize = ToUint32(vImage.size(), "The image");
+        std::memcpy(vImage.data(), &stHeader, sizeof(stHeader));
+        return vImage;
+    }
+
+  private:
+    std::string sStrings;
+    std::unordered_map<std::string_view, StringRef> mStringRefs;
+    std::vector<EnumRecord> vEnums;
+    std::vector<EnumeratorRecord> vEnumerators;
+    std::vector<MessageRecord> vMessages;
+    std::vector<FieldInfoRecord> vFieldInfos;
+    std::vector<FieldRecord> vFields;
+
+    // Names and descriptions repeat across message versions, so each distinct string is stored once.
+    // The keys view the strings of the database being written, which outlives the writer.
+    StringRef AddString(std::string_view str_)
+    {
+        if (str_.empty()) { return {0, 0}; }
+        const auto it = mStringRefs.find(str_);
+        if (it != mStringRefs.end()) { return it->second; }
+        const StringRef stRef{ToUint32(sStrings.size(), "The string table"), ToUint32(str_.size(), "A string")};
+        sStrings.append(str_);
+        mStringRefs.emplace(str_, stRef);
+        return stRef;
+    }
+
+    template <typename T> static TableRef AppendTable(std::vector<unsigned char>& vImage_, const std::vector<T>& vRecords_)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const TableRef stTable{ToUint32(vImage_.size(), "The image"), ToUint32(vRecords_.size(), "A table")};
+        const auto* pucRecords = reinterpret_cast<const unsigned char*>(vRecords_.data());
+        vImage_.insert(vImage_.end(), pucRecords, pucRecords + vRecords_.size() * sizeof(T));
+        return stTable;
+    }
+
+    void AddEnum(const EnumDefinition& stEnumDef_)
+    {
+        EnumRecord stRecord{};
+        stRecord.id = AddString(stEnumDef_._id);
+        stRecord.name = AddString(stEnumDef_.name);
+        stRecord.firstEnumerator = ToUint32(vEnumerators.size(), "The enumerator table");
+        stRecord.enumeratorCount = ToUint32(stEnumDef_.enumerators.size(), "An enumerator list");
+        for (const auto& stEnumerator : stEnumDef_.enumerators)
+        {
+            EnumeratorRecord stEnumeratorRecord{};
+            stEnumeratorRecord.value = stEnumerator.value;
+            stEnumeratorRecord.name = AddString(stEnumerator.name);
+            stEnumeratorRecord.description = AddString(stEnumerator.description);
+            vEnumerators.push_back(stEnumeratorRecord);
+        }
+        vEnums.push_back(stRecord);
+    }
+
+    void AddMessage(const MessageDefinition& stMsgDef_)
+    {
+        // The FieldInfo map is unordered, so the definitions are written in CRC order to make the image deterministic
+        std::vector<std::pair<uint32_t, const FieldInfo*>> vDefinitions;
+        vDefinitions.reserve(stMsgDef_.fieldInfo.size());
+        for (const auto& [uiCrc, pstFieldInfo] : stMsgDef_.fieldInfo) { vDefinitions.emplace_back(uiCrc, pstFieldInfo.get()); }
+        std::sort(vDefinitions.begin(), vDefinitions.end(), [](const auto& lhs_, const auto& rhs_) { return lhs_.first < rhs_.first; });
+
+        MessageRecord stRecord{};
+        stRecord.id = AddString(stMsgDef_._id);
+        stRecord.name = AddString(stMsgDef_.name);
+        stRecord.description = AddString(stMsgDef_.description);
+        stRecord.logId = stMsgDef_.logID;
+        stRecord.latestMessageCrc = stMsgDef_.latestMessageCrc;
+        stRecord.firstFieldInfo = ToUint32(vFieldInfos.size(), "The field info table");
+        stRecord.fieldInfoCount = ToUint32(vDefinitions.size(), "A message definition");
+        vMessages.push_back(stRecord);
+
+        // Reserve the records of the message first so that they are contiguous, then fill them in
+        vFieldInfos.resize(vFieldInfos.size() + vDefinitions.size());
+        for (size_t i = 0; i < vDefinitions.size(); ++i)
+        {
+            FillFieldInfo(stRecord.firstFieldInfo + i, vDefinitions[i].first, *vDefinitions[i].second);
+        }
+    }
+
+    uint32_t AddFieldInfo(const FieldInfo& stFieldInfo_)
+    {
+        const auto uiIndex = ToUint32(vFieldInfos.size(), "The field info table");
+        vFieldInfos.emplace_back();
+        FillFieldInfo(uiIndex, 0, stFieldInfo_);
+        return uiIndex;
+    }
+
+    // Nested field arrays are appended while the fields are filled in, so records are only ever accessed by index here
+    void FillFieldInfo(size_t uiIndex_, uint32_t uiCrc_, const FieldInfo& stFieldInfo_)
+    {
+        const auto& vFieldDefs = stFieldInfo_.messageOrderedFields;
+        FieldInfoRecord stRecord{};
+        stRecord.crc = uiCrc_;
+        stRecord.fixedFieldBytes = ToUint32(stFieldInfo_.fixedFieldBytes, "A fixed field size");
+        stRecord.varFieldCount = ToUint32(stFieldInfo_.varFieldCount, "A variable field count");
+        stRecord.firstField = ToUint32(vFields.size(), "The field table");
+        stRecord.fieldCount = ToUint32(vFieldDefs.size(), "A field list");
+        vFieldInfos[uiIndex_] = stRecord;
+
+        vFields.resize(vFields.size() + vFieldDefs.size());
+        for (size_t i = 0; i < vFieldDefs.size(); ++i)
+        {
+            const FieldRecord stFieldRecord = MakeFieldRecord(vFieldDefs[i].get());
+            vFields[stRecord.firstField + i] = stFieldRecord;
+        }
+    }
+
+    FieldRecord MakeFieldRecord(const BaseField* pstField_)
+    {
+        FieldRecord stRecord{};
+        stRecord.fieldInfo = NO_FIELD_INFO;
+        if (pstField_ == nullptr) { throw std::runtime_error("A field list contains a null field"); }
+
+        stRecord.name = AddString(pstField_->name);
+        stRecord.description = AddString(pstField_->description);
+        stRecord.conversion = AddString(pstField_->conversion);
+        stRecord.dataTypeDescription = AddString(pstField_->dataType.description);
+        stRecord.index = ToUint32(pstField_->index, "A field index");
+        stRecord.width = pstField_->width.value_or(0);
+        stRecord.precision = pstField_->precision.value_or(0);
+        stRecord.conversionHash = pstField_->conversionHash;
+        stRecord.dataTypeLength = pstField_->dataType.length;
+        stRecord.fieldType = static_cast<uint8_t>(pstField_->type);
+        stRecord.dataType = static_cast<uint8_t>(pstField_->dataType.name);
+        stRecord.flags = static_cast<uint8_t>((pstField_->width ? HAS_WIDTH : 0) | (pstField_->precision ? HAS_PRECISION : 0) |
+                                              (pstField_->isString ? IS_STRING : 0) | (pstField_->isCsv ? IS_CSV : 0));
+        stRecord.fieldClass = static_cast<uint8_t>(FIELD_CLASS::BASE);
+
+        if (const auto* pstEnumField = dynamic_cast<const EnumField*>(pstField_))
+        {
+            stRecord.fieldClass = static_cast<uint8_t>(FIELD_CLASS::ENUM);
+            stRecord.enumId = AddString(pstEnumField->enumId);
+        }
+        else if (const auto* pstArrayField = dynamic_cast<const ArrayField*>(pstField_))
+        {
+            stRecord.fieldClass = static_cast<uint8_t>(FIELD_CLASS::ARRAY);
+            stRecord.arrayLength = pstArrayField->arrayLength;
+            stRecord.arrayLengthRef = AddString(pstArrayField->arrayLengthRef);
+            stRecord.arrayLengthFieldSize = pstArrayField->arrayLengthFieldSize;
+
+            if (const auto* pstFieldArrayField = dynamic_cast<const FieldArrayField*>(pstField_))
+            {
+                if (!pstFieldArrayField->fieldInfo) { throw std::runtime_error("Field array \"" + pstField_->name + "\" has no field info"); }
+                stRecord.fieldClass = static_cast<uint8_t>(FIELD_CLASS::FIELD_ARRAY);
+                stRecord.fieldSize = pstFieldArrayField->fieldSize;
+                stRecord.fieldInfo = AddFieldInfo(*pstFieldArrayField->fieldInfo);
+            }
+        }
+
+        if (!IsFieldClassOf(static_cast<FIELD_CLASS>(stRecord.fieldClass), pstField_->type))
+        {
+            throw std::runtime_error("Field \"" + pstField_->name + "\" is not defined by the class its type requires");
+        }
+        return stRecord;
+    }
+};
+
+//============================================================================
+//! \brief Rebuilds a MessageDatabase from the tables of an image.
+//
+//! Every offset and index read from the image is validated, so a truncated
+//! or corrupted image is rejected rather than read out of bounds.
+//============================================================================
+class ImageReader
+{
+  public:
+    ImageReader(const unsigned char* pucData_, uint64_t ullSize_) : pucMyData(pucData_), ullMySize(ullSize_)
+    {
+        if (!IsBinaryDb(pucData_, ullSize_)) { throw std::runtime_error("Not a binary message database"); }
+        std::memcpy(&stMyHeader, pucData_, sizeof(stMyHeader));
+        if (stMyHeader.version != BINARY_DB_VERSION) { throw std::runtime_error("Unsupported binary database version"); }
+        if (stMyHeader.byteOrder != BINARY_DB_BYTE_ORDER) { throw std::runtime_error("Binary database was written with a different byte order"); }
+        if (stMyHeader.imageSize != ullSize_) { throw std::runtime_error("Binary database size does not match its header"); }
+
+        CheckTable(stMyHeader.strings, 1);
+        CheckTable(stMyHeader.enums, sizeof(EnumRecord));
+        CheckTable(stMyHeader.enumerators, sizeof(EnumeratorRecord));
+        CheckTable(stMyHeader.messages, sizeof(MessageRecord));
+        CheckTable(stMyHeader.fieldInfos, sizeof(FieldInfoRecord));
+        CheckTable(stMyHeader.fields, sizeof(FieldRecord));
+    }
+
+    MessageDatabase::Ptr Read() const
+    {
+        DbMetadata::Ptr pstMetadata;
+        if (stMyHeader.hasMetadata != 0)
+        {
+            pstMetadata = std::make_shared<DbMetadata>();
+            pstMetadata->subset = String(stMyHeader.subset);
+            pstMetadata->version = String(stMyHeader.dbVersion);
+            pstMetadata->messageFamily = String(stMyHeader.messageFamily);
+        }
+
+        std::vector<EnumDefinition::ConstPtr> vEnumDefs;
+        vEnumDefs.reserve(stMyHeader.enums.count);
+        for (uint32_t i = 0; i < stMyHeader.enums.count; ++i) { vEnumDefs.push_back(ReadEnum(Record<EnumRecord>(stMyHeader.enums, i))); }
+
+        std::vector<MessageDefinition::ConstPtr> vMsgDefs;
+        vMsgDefs.reserve(stMyHeader.messages.count);
+        for (uint32_t i = 0; i < stMyHeader.messages.count; ++i)
+        {
+            vMsgDefs.push_back(ReadMessage(Record<MessageRecord>(stMyHeader.messages, i)));
+        }
+
+        return std::make_shared<MessageDatabase>(std::move(vMsgDefs), std::move(vEnumDefs), std::move(pstMetadata));
+    }
+
+  private:
+    const unsigned char* pucMyData;
+    uint64_t ullMySize;
+    ImageHeader stMyHeader{};
+
+    void CheckTable(const TableRef& stTable_, size_t uiRecordSize_) const
+    {
+        if (stTable_.offset > ullMySize || static_cast<uint64_t>(stTable_.count) * uiRecordSize_ > ullMySize - stTable_.offset)
+        {
+            throw std::runtime_error("Binary database table is out of bounds");
+        }
+    }
+
+    // The image may be unaligned, so records are copied out rather than referenced in place
+    template <typename T> T Record(const TableRef& stTable_, uint32_t uiIndex_) const
+    {
+        if (uiIndex_ >= stTable_.count) { throw std::runtime_error("Binary database record index is out of bounds"); }
+        T stRecord;
+        std::memcpy(&stRecord, pucMyData + stTable_.offset + static_cast<size_t>(uiIndex_) * sizeof(T), sizeof(T));
+        return stRecord;
+    }
+
+    std::string String(const StringRef& stRef_) const
+    {
+        if (stRef_.offset > stMyHeader.strings.count || stRef_.length > stMyHeader.strings.count - stRef_.offset)
+        {
+            throw std::runtime_error("Binary database string is out of bounds");
+        }
+        return {reinterpret_cast<const char*>(pucMyData + stMyHeader.strings.offset + stRef_.offset), stRef_.length};
+    }
+
+    EnumDefinition::ConstPtr ReadEnum(const EnumRecord& stRecord_) const
+    {
+        std::vector<EnumDataType> vEnumerators;
+        vEnumerators.reserve(stRecord_.enumeratorCount);
+        for (uint32_t i = 0; i < stRecord_.enumeratorCount; ++i)
+        {
+            const auto stEnumerator = Record<EnumeratorRecord>(stMyHeader.enumerators, stRecord_.firstEnumerator + i);
+            vEnumerators.push_back({stEnumerator.value, String(stEnumerator.name), String(stEnumerator.description)});
+        }
+        return std::make_shared<EnumDefinition>(String(stRecord_.id), String(stRecord_.name), std::move(vEnumerators));
+    }
+
+    MessageDefinition::ConstPtr ReadMessage(const MessageRecord& stRecord_) const
+    {
+        auto pstMsgDef = std::make_shared<MessageDefinition>();
+        pstMsgDef->_id = String(stRecord_.id);
+        pstMsgDef->logID = stRecord_.logId;
+        pstMsgDef->name = String(stRecord_.name);
+        pstMsgDef->description = String(stRecord_.description);
+        pstMsgDef->latestMessageCrc = stRecord_.latestMessageCrc;
+        for (uint32_t i = 0; i < stRecord_.fieldInfoCount; ++i)
+        {
+            const uint32_t uiIndex = stRecord_.firstFieldInfo + i;
+            pstMsgDef->fieldInfo[Record<FieldInfoRecord>(stMyHeader.fieldInfos, uiIndex).crc] = ReadFieldInfo(uiIndex);
+        }
+        return pstMsgDef;
+    }
+
+    FieldInfo::ConstPtr ReadFieldInfo(uint32_t uiIndex_, uint32_t uiDepth_ = 0) const
+    {
+        if (uiDepth_ > MAX_FIELD_ARRAY_DEPTH) { throw std::runtime_error("Binary database field arrays are nested too deeply"); }
+
+        const auto stRecord = Record<FieldInfoRecord>(stMyHeader.fieldInfos, uiIndex_);
+        auto pstFieldInfo = std::make_shared<FieldInfo>();
+        pstFieldInfo->fixedFieldBytes = stRecord.fixedFieldBytes;
+        pstFieldInfo->varFieldCount = stRecord.varFieldCount;
+        pstFieldInfo->messageOrderedFields.reserve(stRecord.fieldCount);
+        for (uint32_t i = 0; i < stRecord.fieldCount; ++i)
+        {
+            pstFieldInfo->messageOrderedFields.push_back(
+                ReadField(Record<FieldRecord>(stMyHeader.fields, stRecord.firstField + i), uiIndex_, uiDepth_));
+        }
+        CheckLayout(*pstFieldInfo);
+        return pstFieldInfo;
+    }
+
+    // Decoding indexes message bodies with the layout, so it must fit in the space the field info gives it
+    static void CheckLayout(const FieldInfo& stFieldInfo_)
+    {
+        std::vector<bool> vVarFieldSeen(stFieldInfo_.varFieldCount, false);
+        for (const auto& pstField : stFieldInfo_.messageOrderedFields)
+        {
+            switch (pstField->type)
+            {
+            case FIELD_TYPE::BITFIELD: [[fallthrough]];
+            case FIELD_TYPE::RESPONSE_ID: [[fallthrough]];
+            case FIELD_TYPE::SIMPLE: [[fallthrough]];
+            case FIELD_TYPE::ENUM: [[fallthrough]];
+            case FIELD_TYPE::FIXED_LENGTH_ARRAY: {
+                const uint64_t ullCount =
+                    pstField->type == FIELD_TYPE::FIXED_LENGTH_ARRAY ? static_cast<const ArrayField&>(*pstField).arrayLength : 1;
+                if (static_cast<uint64_t>(pstField->index) + pstField->dataType.length * ullCount > stFieldInfo_.fixedFieldBytes)
+                {
+                    throw std::runtime_error("Binary database field \"" + pstField->name + "\" lies outside the fixed fields");
+                }
+                break;
+            }
+            case FIELD_TYPE::RESPONSE_STR: [[fallthrough]];
+            case FIELD_TYPE::STRING: [[fallthrough]];
+            case FIELD_TYPE::FIELD_ARRAY: [[fallthrough]];
+            case FIELD_TYPE::VARIABLE_LENGTH_ARRAY:
+                if (pstField->index >= vVarFieldSeen.size() || vVarFieldSeen[pstField->index])
+                {
+                    throw std::runtime_error("Binary database field \"" + pstField->name + "\" has an invalid variable field index");
+                }
+                vVarFieldSeen[pstField->index] = true;
+                break;
+            default: throw std::runtime_error("Binary database field \"" + pstField->name + "\" has no layout");
+            }
+        }
+        if (std::find(vVarFieldSeen.begin(), vVarFieldSeen.end(), false) != vVarFieldSeen.end())
+        {
+            throw std::runtime_error("Binary database variable field count does not match its fields");
+        }
+    }
+
+    BaseField::Ptr ReadField(const FieldRecord& stRecord_, uint32_t uiParentFieldInfo_, uint32_t uiDepth_) const
+    {
+        if (stRecord_.fieldType > static_cast<uint8_t>(FIELD_TYPE::UNKNOWN) || stRecord_.dataType > static_cast<uint8_t>(DATA_TYPE::UNKNOWN))
+        {
+            throw std::runtime_error("Binary database field has an unknown type");
+        }
+        if (stRecord_.fieldClass > static_cast<uint8_t>(FIELD_CLASS::FIELD_ARRAY))
+        {
+            throw std::runtime_error("Binary database field has an unknown class");
+        }
+        if (!IsFieldClassOf(static_cast<FIELD_CLASS>(stRecord_.fieldClass), static_cast<FIELD_TYPE>(stRecord_.fieldType)))
+        {
+            throw std::runtime_error("Binary database field class does not match its type");
+        }
+
+        BaseField::Ptr pstField;
+        switch (static_cast<FIELD_CLASS>(stRecord_.fieldClass))
+        {
+        case FIELD_CLASS::BASE: pstField = std::make_shared<BaseField>(); break;
+        case FIELD_CLASS::ENUM: {
+            auto pstEnumField = std::make_shared<EnumField>();
+            pstEnumField->enumId = String(stRecord_.enumId);
+            pstField = std::move(pstEnumField);
+            break;
+        }
+        case FIELD_CLASS::ARRAY: {
+            auto pstArrayField = std::make_shared<ArrayField>();
+            ReadArrayMembers(stRecord_, *pstArrayField);
+            pstField = std::move(pstArrayField);
+            break;
+        }
+        case FIELD_CLASS::FIELD_ARRAY: {
+            // Nested field infos are always written after their parent, which also rules out cycles
+            if (stRecord_.fieldInfo == NO_FIELD_INFO || stRecord_.fieldInfo <= uiParentFieldInfo_)
+            {
+                throw std::runtime_error("Binary database field array has an invalid field info");
+            }
+            auto pstFieldArrayField = std::make_shared<FieldArrayField>();
+            ReadArrayMembers(stRecord_, *pstFieldArrayField);
+            pstFieldArrayField->fieldSize = stRecord_.fieldSize;
+            pstFieldArrayField->fieldInfo = ReadFieldInfo(stRecord_.fieldInfo, uiDepth_ + 1);
+            pstField = std::move(pstFieldArrayField);
+            break;
+        }
+        }
+
+        // The conversion string was parsed when the image was written, so its cached members are restored as they are
+        pstField->name = String(stRecord_.name);
+        pstField->type = static_cast<FIELD_TYPE>(stRecord_.fieldType);
+        pstField->description = String(stRecord_.description);
+        pstField->conversion = String(stRecord_.conversion);
+        pstField->conversionHash = stRecord_.conversionHash;
+        if ((stRecord_.flags & HAS_WIDTH) != 0) { pstField->width = stRecord_.width; }
+        if ((stRecord_.flags & HAS_PRECISION) != 0) { pstField->precision = stRecord_.precision; }
+        pstField->isString = (stRecord_.flags & IS_STRING) != 0;
+        pstField->isCsv = (stRecord_.flags & IS_CSV) != 0;
+        pstField->dataType.name = static_cast<DATA_TYPE>(stRecord_.dataType);
+        pstField->dataType.length = stRecord_.dataTypeLength;
+        pstField->dataType.description = String(stRecord_.dataTypeDescription);
+        pstField->index = stRecord_.index;
+        return pstField;
+    }
+
+    void ReadArrayMembers(const FieldRecord& stRecord_, ArrayField& stField_) const
+    {
+        stField_.arrayLength = stRecord_.arrayLength;
+        stField_.arrayLengthRef = String(stRecord_.arrayLengthRef);
+        stField_.arrayLengthFieldSize = stRecord_.arrayLengthFieldSize;
+    }
+};
+
+} // namespace
+
+//-----------------------------------------------------------------------
+std::vector<unsigned char> SerializeBinaryDb(const MessageDatabase& clMessageDb_)
+{
+    try
+    {
+        return ImageWriter().Write(clMessageDb_);
+    }
+    catch (const std::runtime_error& e)
+    {
+        throw BinaryDbFailure(__func__, __FILE__, __LINE__, "binary message database", e.what());
+    }
+}
+
+//-----------------------------------------------------------------------
+void WriteBinaryDbFile(const MessageDatabase& clMessageDb_, const std::filesystem::path& filePath_)
+{
+    const auto vImage = SerializeBinaryDb(clMessageDb_);
+    std::ofstream clFile(filePath_, std::ios::binary | std::ios::trunc);
+    clFile.write(reinterpret_cast<const char*>(vImage.data()), static_cast<std::streamsize>(vImage.size()));
+    if (!clFile) { throw BinaryDbFailure(__func__, __FILE__, __LINE__, filePath_, "Failed to write the file"); }
+}
+
+//-----------------------------------------------------------------------
+bool IsBinaryDb(const unsigned char* pucData_, uint64_t ullSize_)
+{
+    return pucData_ != nullptr && ullSize_ >= sizeof(ImageHeader) && std::memcmp(pucData_, BINARY_DB_MAGIC, sizeof(BINARY_DB_MAGIC)) == 0;
+}
+
+//-----------------------------------------------------------------------
+MessageDatabase::Ptr ParseBinaryDb(const unsigned char* pucData_, uint64_t ullSize_)
+{
+    try
+    {
+        return ImageReader(pucData_, ullSize_).Read();
+    }
+    catch (const std::exception& e)
+    {
+        throw BinaryDbFailure(__func__, __FILE__, __LINE__, "binary message database", e.what());
+    }
+}
+
+//-----------------------------------------------------------------------
+MessageDatabase::Ptr LoadBinaryDbFile(const std::filesystem::path& filePath_)
+{
+    MappedFile clMappedFile;
+    if (clMappedFile.Open(filePath_)) { return ParseBinaryDb(clMappedFile.Data(), clMappedFile.Size()); }
+
+    // Memory mapping is not supported on every platform
+    std::ifstream clFile(filePath_, std::ios::binary);
+    if (!clFile) { throw BinaryDbFailure(__func__, __FILE__, __LINE__, filePath_, "Failed to open the file"); }
+    const std::vector<unsigned char> vImage((std::istreambuf_iterator<char>(clFile)), std::istreambuf_iterator<char>());
+    return ParseBinaryDb(vImage.data(), vImage.size());
+}
+
+//-----------------------------------------------------------------------
+MessageDatabase::Ptr LoadDbFile(const std::filesystem::path& filePath_)
+{
+    std::ifstream clFile(filePath_, std::ios::binary);
+    unsigned char aucMagic[sizeof(BINARY_DB_MAGIC)]{};
+    clFile.read(reinterpret_cast<char*>(aucMagic), sizeof(aucMagic));
+    const bool bBinary = clFile.gcount() == sizeof(aucMagic) && std::memcmp(aucMagic, BINARY_DB_MAGIC, sizeof(BINARY_DB_MAGIC)) == 0;
+    clFile.close();
+    return bBinary ? LoadBinaryDbFile(filePath_) : LoadJsonDbFile(filePath_);
+}
+
+} // namespace novatel::edie
@@ -0,0 +1,191 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file decode_plan.cpp
+// ===============================================================================
+
+#include "novatel_edie/decoders/common/decode_plan.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+#include "novatel_edie/decoders/common/message_decoder.hpp"
+
+using namespace novatel::edie;
+
+// -------------------------------------------------------------------------------------------------------
+// Number of bytes that a binary decode of one element of a SIMPLE or FIXED_LENGTH_ARRAY field stores in the fixed fields
+static uint32_t StoredElementBytes(const BaseField& field_)
+{
+    uint32_t uiBytes = 0;
+    try
+    {
+        SimpleTypeVisitor(field_, [&](auto valuePtr) { uiBytes = static_cast<uint32_t>(sizeof(valuePtr)); });
+    }
+    catch (const std::runtime_error&)
+    {
+        // Unsupported data types are not plain copies, the decoder reports them when the field is decoded
+    }
+    return uiBytes;
+}
+
+// -------------------------------------------------------------------------------------------------------
+// Group plain copies whose destinations are contiguous into runs, working backwards so that each op knows the run it starts
+static void GroupPlainCopies(DecodePlan& stPlan_)
+{
+    for (size_t i = stPlan_.ops.size(); i-- > 0;)
+    {
+        auto& stOp = stPlan_.ops[i];
+        stOp.runBytes = 0;
+        stOp.runOps = 0;
+        if (stOp.copyBytes == 0 || stOp.skip) { continue; }
+
+        stOp.runBytes = stOp.copyBytes;
+        stOp.runOps = 1;
+        if (i + 1 < stPlan_.ops.size())
+        {
+            const auto& stNext = stPlan_.ops[i + 1];
+            if (stNext.runOps > 0 && stNext.field->index == stOp.field->index + stOp.copyBytes)
+            {
+                stOp.runBytes += stNext.runBytes;
+                stOp.runOps += stNext.runOps;
+            }
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+// Whether the length of an array in the plan, or in the records of its field arrays, is given by another field
+static bool HasArrayLengthRef(const DecodePlan& stPlan_)
+{
+    for (const DecodeOp& stOp : stPlan_.ops)
+    {
+        if (stOp.arrayField != nullptr && !stOp.arrayField->arrayLengthRef.empty()) { return true; }
+        if (stOp.subPlan != nullptr && HasArrayLengthRef(*stOp.subPlan)) { return true; }
+    }
+    return false;
+}
+
+// -------------------------------------------------------------------------------------------------------
+DecodePlan::ConstPtr novatel::edie::CompileDecodePlan(const FieldInfo& fieldInfo_)
+{
+    auto pclPlan = std::make_shared<DecodePlan>();
+    pclPlan->ops.reserve(fieldInfo_.messageOrderedFields.size());
+
+    for (const auto& field : fieldInfo_.messageOrderedFields)
+    {
+        DecodeOp stOp;
+        stOp.field = field.get();
+        stOp.type = field->type;
+        stOp.typeLength = field->dataType.length;
+        stOp.zConversion = field->conversionHash == CalculateBlockCrc32("Z");
+        stOp.pConversion = field->conversionHash == CalculateBlockCrc32("P");
+
+        switch (field->type)
+        {
+        case FIELD_TYPE::SIMPLE: {
+            const uint32_t uiElementBytes = StoredElementBytes(*field);
+            if (uiElementBytes == stOp.typeLength) { stOp.copyBytes = uiElementBytes; }
+            break;
+        }
+        case FIELD_TYPE::ENUM:
+            stOp.enumField = dynamic_cast<const EnumField*>(field.get());
+            if (stOp.enumField == nullptr) { throw std::runtime_error("CompileDecodePlan(): ENUM field is not of type EnumField."); }
+            if (stOp.typeLength == 1 || stOp.typeLength == 2 || stOp.typeLength == 4) { stOp.copyBytes = stOp.typeLength; }
+            break;
+        case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
+        case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: [[fallthrough]];
+        case FIELD_TYPE::STRING: {
+            stOp.arrayField = dynamic_cast<const ArrayField*>(field.get());
+            if (stOp.arrayField != nullptr) { stOp.arrayLength = stOp.arrayField->arrayLength; }
+            else if (field->type != FIELD_TYPE::STRING) { throw std::runtime_error("CompileDecodePlan(): array field is not of type ArrayField."); }
+
+            if (field->type == FIELD_TYPE::FIXED_LENGTH_ARRAY && stOp.arrayLength > 0)
+            {
+                const uint32_t uiElementBytes = StoredElementBytes(*field);
+                if (uiElementBytes == stOp.typeLength) { stOp.copyBytes = uiElementBytes * stOp.arrayLength; }
+            }
+            break;
+        }
+        case FIELD_TYPE::FIELD_ARRAY:
+            // A missing definition is reported by the decoder as malformed input
+            stOp.fieldArrayField = dynamic_cast<const FieldArrayField*>(field.get());
+            if (stOp.fieldArrayField != nullptr && stOp.fieldArrayField->fieldInfo != nullptr)
+            {
+                stOp.arrayField = stOp.fieldArrayField;
+                stOp.arrayLength = stOp.fieldArrayField->arrayLength;
+                stOp.subPlan = stOp.fieldArrayField->fieldInfo->GetDecodePlanPtr();
+                stOp.flatArray = stOp.fieldArrayField->fieldInfo->varFieldCount == 0;
+            }
+            else { stOp.fieldArrayField = nullptr; }
+            break;
+        default: break;
+        }
+
+        pclPlan->ops.push_back(stOp);
+    }
+
+    GroupPlainCopies(*pclPlan);
+    return pclPlan;
+}
+
+// -------------------------------------------------------------------------------------------------------
+DecodePlan::ConstPtr novatel::edie::ProjectDecodePlan(const DecodePlan& stPlan_, const std::vector<std::string>& vFieldNames_)
+{
+    auto pclPlan = std::make_shared<DecodePlan>(stPlan_);
+
+    std::vector<std::string_view> vKeptNames(vFieldNames_.begin(), vFieldNames_.end());
+    for (const DecodeOp& stOp : stPlan_.ops)
+    {
+        if (stOp.arrayField != nullptr && !stOp.arrayField->arrayLengthRef.empty()) { vKeptNames.emplace_back(stOp.arrayField->arrayLengthRef); }
+    }
+
+    for (DecodeOp& stOp : pclPlan->ops)
+    {
+        const bool bNamed = std::find(vKeptNames.begin(), vKeptNames.end(), stOp.field->name) != vKeptNames.end();
+        stOp.skip = !bNamed && (stOp.subPlan == nullptr || !HasArrayLengthRef(*stOp.subPlan));
+    }
+
+    GroupPlainCopies(*pclPlan);
+    return pclPlan;
+}
+
+// -------------------------------------------------------------------------------------------------------
+const DecodePlan& FieldInfo::GetDecodePlan() const
+{
+    const DecodePlan::ConstPtr pclPlan = std::atomic_load(&decodePlan);
+    // The cache keeps the plan alive until InvalidateCaches() is called
+    return pclPlan != nullptr ? *pclPlan : *GetDecodePlanPtr();
+}
+
+// -------------------------------------------------------------------------------------------------------
+DecodePlan::ConstPtr FieldInfo::GetDecodePlanPtr() const
+{
+    DecodePlan::ConstPtr pclPlan = std::atomic_load(&decodePlan);
+    if (pclPlan != nullptr) { return pclPlan; }
+
+    // If another thread compiles the plan first, keep its plan so that references to it stay valid
+    DecodePlan::ConstPtr pclCompiled = CompileDecodePlan(*this);
+    if (std::atomic_compare_exchange_strong(&decodePlan, &pclPlan, pclCompiled)) { return pclCompiled; }
+    return pclPlan;
+}
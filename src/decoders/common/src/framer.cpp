@@ -26,6 +26,8 @@
 
 #include "novatel_edie/decoders/common/framer.hpp"
 
+#include <utility>
+
 using namespace novatel::edie;
 
 [[nodiscard]] STATUS FramerBase::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, MetaDataBase& stMetaData_, bool bMetadataOnly_)
@@ -86,3 +88,65 @@ using namespace novatel::edie;
 
     return STATUS::SUCCESS;
 }
+
+[[nodiscard]] STATUS FramerBase::GetFrameView(FrameView& stFrameView_, MetaDataBase& stMetaData_, uint32_t uiMaxFrameLength_)
+{
+    stFrameView_ = FrameView{};
+
+    // An unconsumed view leaves the framer mid-frame, so start over to return the same frame again
+    if (uiMyFrameViewLength != 0)
+    {
+        uiMyFrameViewLength = 0;
+        InitAttributes();
+        ResetState();
+    }
+
+    // Framers never write to the destination in metadata-only mode, so the internal buffer is passed only to satisfy
+    // the null check. Payload-only mode is suspended since a view must span exactly the bytes that Consume() discards.
+    const bool bPayloadOnly = std::exchange(bMyPayloadOnly, false);
+    const STATUS eStatus = GetFrame(const_cast<unsigned char*>(pclMyBuffer->data()), uiMaxFrameLength_, stMetaData_, /*bMetadataOnly=*/true);
+    bMyPayloadOnly = bPayloadOnly;
+
+    if (eStatus == STATUS::SUCCESS || eStatus == STATUS::UNKNOWN)
+    {
+        uiMyFrameViewLength = stMetaData_.uiLength;
+        stFrameView_ = FrameView{pclMyBuffer->data(), stMetaData_.uiLength};
+    }
+
+    return eStatus;
+}
+
+[[nodiscard]] size_t FramerBase::GetFrames(FrameDescriptor* pstFrames_, size_t uiMaxFrames_, const unsigned char*& pucFrameData_,
+                                           MetaDataBase& stMetaData_, uint32_t uiMaxFrameLength_)
+{
+    // An unconsumed view leaves the framer mid-frame, so start over from the front of the buffer
+    if (uiMyFrameViewLength != 0)
+    {
+        uiMyFrameViewLength = 0;
+        InitAttributes();
+        ResetState();
+    }
+
+    // Erasing from the buffer only advances its head, so every frame stays in place behind the batch start
+    pucFrameData_ = pclMyBuffer->data();
+    if (pstFrames_ == nullptr) { return 0; }
+
+    const bool bPayloadOnly = std::exchange(bMyPayloadOnly, false);
+    uint32_t uiOffset = 0;
+    size_t uiFrameCount = 0;
+
+    while (uiFrameCount < uiMaxFrames_)
+    {
+        const STATUS eStatus = GetFrame(const_cast<unsigned char*>(pucFrameData_), uiMaxFrameLength_, stMetaData_, /*bMetadataOnly=*/true);
+        if (eStatus != STATUS::SUCCESS && eStatus != STATUS::UNKNOWN) { break; }
+
+        pstFrames_[uiFrameCount++] = FrameDescriptor{uiOffset, stMetaData_.uiLength, stMetaData_.eFormat, eStatus};
+        uiOffset += stMetaData_.uiLength;
+        pclMyBuffer->erase_begin(stMetaData_.uiLength);
+        InitAttributes();
+        ResetState();
+    }
+
+    bMyPayloadOnly = bPayloadOnly;
+    return uiFrameCount;
+}
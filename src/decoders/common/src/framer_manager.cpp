@@ -30,8 +30,9 @@
 
 using namespace novatel::edie;
 
-FramerManager::FramerManager(const std::vector<std::string>& selectedFramers)
-    : pclMyLogger(GetBaseLoggerManager()->RegisterLogger("FramerManager")), pclMyFixedBuffer(std::make_shared<UCharFixedBuffer>())
+FramerManager::FramerManager(const std::vector<std::string>& selectedFramers, const FIXED_BUFFER_BACKEND eBufferBackend_)
+    : pclMyLogger(GetBaseLoggerManager()->RegisterLogger("FramerManager")),
+      pclMyFixedBuffer(std::make_shared<UCharFixedBuffer>(RECOMMENDED_FRAME_BUFFER_SIZE, eBufferBackend_))
 {
     pclMyLogger->info("Note: the FramerManager is under active development and should be treated as an experimental feature. "
                       "Currently, the FramerManager is simply a thin wrapper around the OEM Framer. Until we have implemented "
@@ -43,21 +44,34 @@ FramerManager::FramerManager(const std::vector<std::string>& selectedFramers)
     {
         auto framerId = CalculateBlockCrc32(name);
         auto it = factoryMap.find(framerId);
-        if (it != factoryMap.end())
+        if (it == factoryMap.end()) { pclMyLogger->warn("Framer '{}' not found in registered framer factories.", name); }
+        else if (framerRegistry.size() == MAX_FRAMERS) { pclMyLogger->warn("Framer '{}' not added, at most {} framers are supported.", name, MAX_FRAMERS); }
+        else
         {
-            auto& constructors = it->second;
-            auto metadataInstance = constructors.second();
-            auto framerInstance = constructors.first(pclMyFixedBuffer);
-            framerRegistry.emplace_back(name, framerId, std::move(framerInstance), std::move(metadataInstance));
+            const auto& registration = it->second;
+            auto metadataInstance = registration.metadataConstructor();
+            auto framerInstance = registration.framerFactory(pclMyFixedBuffer);
+            auto& entry = framerRegistry.emplace_back(name, framerId, std::move(framerInstance), std::move(metadataInstance));
+            entry.dispatchBit = uint64_t{1} << (framerRegistry.size() - 1);
+
+            if (registration.syncBytes.empty())
+            {
+                for (auto& framerMask : aullMyDispatchTable) { framerMask |= entry.dispatchBit; }
+                clMySyncScanner.reset();
+            }
+            for (const unsigned char syncByte : registration.syncBytes)
+            {
+                aullMyDispatchTable[syncByte] |= entry.dispatchBit;
+                if (clMySyncScanner && !clMySyncScanner->Add(syncByte)) { clMySyncScanner.reset(); }
+            }
             pclMyLogger->info("Registered framer '{}'", name);
         }
-        else { pclMyLogger->warn("Framer '{}' not found in registered framer factories.", name); }
     }
 }
 
 void FramerManager::RegisterFramer(const std::string& framerName_,
                                    std::function<std::unique_ptr<FramerBase>(std::shared_ptr<UCharFixedBuffer>)> framerFactory_,
-                                   std::function<std::unique_ptr<MetaDataBase>()> metadataConstructor_)
+                                   std::function<std::unique_ptr<MetaDataBase>()> metadataConstructor_, std::vector<unsigned char> syncBytes_)
 {
     auto& factoryMap = GetFramerFactories();
     auto framerId = CalculateBlockCrc32(framerName_);
@@ -70,16 +84,12 @@ void FramerManager::RegisterFramer(const std::string& framerName_,
                                  " Please choose a different name for '" +
                                  framerName_ + "'.");
     }
-    factoryMap[framerId] = {std::move(framerFactory_), std::move(metadataConstructor_)};
+    factoryMap[framerId] = {std::move(framerFactory_), std::move(metadataConstructor_), std::move(syncBytes_)};
 }
 
-std::unordered_map<std::uint32_t, std::pair<std::function<std::unique_ptr<FramerBase>(std::shared_ptr<UCharFixedBuffer>)>,
-                                            std::function<std::unique_ptr<MetaDataBase>()>>>&
-FramerManager::GetFramerFactories()
+std::unordered_map<std::uint32_t, FramerRegistration>& FramerManager::GetFramerFactories()
 {
-    static std::unordered_map<uint32_t, std::pair<std::function<std::unique_ptr<FramerBase>(std::shared_ptr<UCharFixedBuffer>)>,
-                                                  std::function<std::unique_ptr<MetaDataBase>()>>>
-        factories;
+    static std::unordered_map<uint32_t, FramerRegistration> factories;
     return factories;
 }
 
@@ -92,13 +102,29 @@ MetaDataBase* FramerManager::GetMetaData(const std::string& framerName_)
     return nullptr;
 }
 
-void FramerManager::ResetAllFramerStates() const
+void FramerManager::ResetAllFramerStates()
 {
-    for (const auto& framer : framerRegistry)
+    for (auto& framer : framerRegistry)
     {
         framer.framerInstance->InitAttributes();
         framer.framerInstance->ResetState();
+        framer.uiScanCursor = 0;
+    }
+    ullMyConsultedFramers = 0;
+}
+
+void FramerManager::ResetConsultedFramerStates()
+{
+    for (auto& framer : framerRegistry)
+    {
+        if ((framer.dispatchBit & ullMyConsultedFramers) != 0)
+        {
+            framer.framerInstance->InitAttributes();
+            framer.framerInstance->ResetState();
+            framer.uiScanCursor = 0;
+        }
     }
+    ullMyConsultedFramers = 0;
 }
 
 FramerEntry* FramerManager::GetFramerEntry(const std::string framerName_)
@@ -110,26 +136,37 @@ FramerEntry* FramerManager::GetFramerEntry(const std::string framerName_)
     return nullptr;
 }
 
-STATUS FramerManager::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, MetaDataBase*& stMetaData_)
+STATUS FramerManager::FindFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, MetaDataBase*& stMetaData_)
 {
-    while (true)
-    {
-        if (pclMyFixedBuffer->empty()) { return STATUS::BUFFER_EMPTY; }
+    if (pclMyFixedBuffer->empty()) { return STATUS::BUFFER_EMPTY; }
 
-        STATUS eStatus = STATUS::UNKNOWN;
-        MetaDataBase* currentMetaData;
-        auto registrySize = framerRegistry.size();
+    STATUS eStatus = STATUS::UNKNOWN;
+    MetaDataBase* currentMetaData;
+    auto registrySize = framerRegistry.size();
 
-        auto bestFramerIndex = registrySize;
-        auto bestOffset = static_cast<uint32_t>(pclMyFixedBuffer->size());
-        STATUS bestStatus = STATUS::UNKNOWN;
+    const size_t uiBufferSize = pclMyFixedBuffer->size();
+    auto bestFramerIndex = registrySize;
+    auto bestOffset = static_cast<uint32_t>(uiBufferSize);
+    STATUS bestStatus = STATUS::UNKNOWN;
 
-        // Scan for first frame offset among all registered framers
+    // Scan for first frame offset among the framers selected by the mask
+    auto pollFramers = [&](const uint64_t ullFramerMask_) {
         for (size_t i = 0; i < registrySize; i++)
         {
             auto& framer = framerRegistry[i];
+            if ((framer.dispatchBit & ullFramerMask_) == 0) { continue; }
+
+            ullMyConsultedFramers |= framer.dispatchBit;
             currentMetaData = framer.metadataInstance.get();
-            eStatus = framer.framerInstance->GetFrame(pucFrameBuffer_, uiFrameBufferSize_, *currentMetaData, /*bMetadataOnly=*/true);
+
+            // A framer resumes scanning where it left off, so skip it entirely if nothing was written since it last looked
+            if (framer.uiScanCursor == uiBufferSize && framer.uiScanFrameBufferSize == uiFrameBufferSize_) { eStatus = STATUS::INCOMPLETE; }
+            else
+            {
+                eStatus = framer.framerInstance->GetFrame(pucFrameBuffer_, uiFrameBufferSize_, *currentMetaData, /*bMetadataOnly=*/true);
+                framer.uiScanCursor = eStatus == STATUS::INCOMPLETE ? uiBufferSize : 0;
+                framer.uiScanFrameBufferSize = uiFrameBufferSize_;
+            }
 
             // If any framer returns a known status, keep it as the best candidate. If multiple framers
             // return known statuses but no framer returns SUCCESS, one of the known statuses will be returned.
@@ -139,57 +176,190 @@ STATUS FramerManager::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameB
                 bestStatus = eStatus;
                 stMetaData_ = currentMetaData;
                 // If a framer sees a valid, complete frame, then use it immediately
-                if (eStatus == STATUS::SUCCESS) { break; }
+                if (eStatus == STATUS::SUCCESS) { return; }
             }
             // Track the smallest offset among framers with UNKNOWN statuses to possibly discard unknown bytes later
             else if (currentMetaData->uiLength < bestOffset) { bestOffset = currentMetaData->uiLength; }
         }
+    };
+
+    // A framer can only recognize a frame starting with one of its sync bytes, so try those framers first. If none of
+    // them does, the others still have to report where their next sync bytes are to size the run of unknown bytes.
+    const uint64_t ullCandidates = aullMyDispatchTable[(*pclMyFixedBuffer)[0]];
+    pollFramers(ullCandidates);
+    if (bestFramerIndex == registrySize) { pollFramers(~ullCandidates); }
+
+    assert((bestStatus == STATUS::UNKNOWN && bestFramerIndex == registrySize) ||
+           (bestStatus != STATUS::UNKNOWN && bestFramerIndex < registrySize));
 
-        assert((bestStatus == STATUS::UNKNOWN && bestFramerIndex == registrySize) ||
-               (bestStatus != STATUS::UNKNOWN && bestFramerIndex < registrySize));
+    // No frame found at all
+    if (bestFramerIndex == registrySize)
+    {
+        assert(bestOffset > 0 && bestOffset <= static_cast<uint32_t>(pclMyFixedBuffer->size()));
+        stMyMetaData.uiLength = bestOffset;
+        stMyMetaData.eFormat = HEADER_FORMAT::UNKNOWN;
+        stMetaData_ = &stMyMetaData; // There is no valid MetaData object to use from a Framer so use the MetaDataBase from FramerManager
+        return STATUS::UNKNOWN;
+    }
 
-        // No frame found at all
-        if (bestFramerIndex == registrySize)
+    if (bestStatus == STATUS::SUCCESS)
+    {
+        // Move this framer to the front
+        if (bestFramerIndex != 0)
         {
-            assert(bestOffset > 0 && bestOffset <= static_cast<uint32_t>(pclMyFixedBuffer->size()));
-            HandleUnknownBytes(pucFrameBuffer_, bestOffset);
-            stMyMetaData.uiLength = bestOffset;
-            stMyMetaData.eFormat = HEADER_FORMAT::UNKNOWN;
-            stMetaData_ = &stMyMetaData; // There is no valid MetaData object to use from a Framer so use the MetaDataBase from FramerManager
-            return STATUS::UNKNOWN;
+            std::rotate(framerRegistry.begin(), framerRegistry.begin() + bestFramerIndex, framerRegistry.begin() + bestFramerIndex + 1);
         }
 
-        if (bestStatus == STATUS::SUCCESS)
+        if (stMetaData_->uiLength > uiFrameBufferSize_) { return STATUS::BUFFER_FULL; }
+    }
+
+    return bestStatus;
+}
+
+STATUS FramerManager::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, MetaDataBase*& stMetaData_)
+{
+    const STATUS eStatus = FindFrame(pucFrameBuffer_, uiFrameBufferSize_, stMetaData_);
+
+    if (eStatus == STATUS::UNKNOWN && bMySkipAheadResync)
+    {
+        SkipUnknownBytes(uiFrameBufferSize_, stMetaData_, bMyReportUnknownBytes ? pucFrameBuffer_ : nullptr);
+        uiMyFrameViewLength = 0;
+    }
+    else if (eStatus == STATUS::UNKNOWN) { HandleUnknownBytes(pucFrameBuffer_, stMetaData_->uiLength); }
+    else if (eStatus == STATUS::SUCCESS)
+    {
+        pclMyFixedBuffer->copy_out(pucFrameBuffer_, stMetaData_->uiLength);
+        pclMyFixedBuffer->erase_begin(stMetaData_->uiLength);
+        uiMyFrameViewLength = 0;
+        ResetConsultedFramerStates();
+    }
+
+    return eStatus;
+}
+
+STATUS FramerManager::GetFrameView(FrameView& stFrameView_, MetaDataBase*& stMetaData_, uint32_t uiMaxFrameLength_)
+{
+    stFrameView_ = FrameView{};
+
+    // An unconsumed view leaves the framers mid-frame, so start over to return the same frame again
+    if (uiMyFrameViewLength != 0)
+    {
+        uiMyFrameViewLength = 0;
+        ResetConsultedFramerStates();
+    }
+
+    // Framers never write to the destination in metadata-only mode, so the shared buffer is passed only to satisfy the null check
+    const unsigned char* pucFrame = pclMyFixedBuffer->data();
+    const STATUS eStatus = FindFrame(const_cast<unsigned char*>(pucFrame), uiMaxFrameLength_, stMetaData_);
+
+    if (eStatus == STATUS::UNKNOWN && bMySkipAheadResync)
+    {
+        // The skipped bytes leave the buffer while resynchronizing, so there is nothing left to consume
+        SkipUnknownBytes(uiMaxFrameLength_, stMetaData_);
+        stFrameView_ = FrameView{pucFrame, stMetaData_->uiLength};
+    }
+    else if (eStatus == STATUS::SUCCESS || eStatus == STATUS::UNKNOWN)
+    {
+        uiMyFrameViewLength = stMetaData_->uiLength;
+        stFrameView_ = FrameView{pclMyFixedBuffer->data(), stMetaData_->uiLength};
+    }
+
+    return eStatus;
+}
+
+void FramerManager::Consume()
+{
+    if (uiMyFrameViewLength == 0) { return; }
+
+    pclMyFixedBuffer->erase_begin(uiMyFrameViewLength);
+    uiMyFrameViewLength = 0;
+    ResetConsultedFramerStates();
+}
+
+size_t FramerManager::GetFrames(FrameDescriptor* pstFrames_, size_t uiMaxFrames_, const unsigned char*& pucFrameData_, uint32_t uiMaxFrameLength_)
+{
+    // An unconsumed view leaves the framers mid-frame, so start over from the front of the buffer
+    if (uiMyFrameViewLength != 0)
+    {
+        uiMyFrameViewLength = 0;
+        ResetConsultedFramerStates();
+    }
+
+    // Erasing from the buffer only advances its head, so every frame stays in place behind the batch start
+    pucFrameData_ = pclMyFixedBuffer->data();
+    if (pstFrames_ == nullptr) { return 0; }
+
+    MetaDataBase* pstMetaData = nullptr;
+    uint32_t uiOffset = 0;
+    size_t uiFrameCount = 0;
+
+    while (uiFrameCount < uiMaxFrames_)
+    {
+        const STATUS eStatus = FindFrame(const_cast<unsigned char*>(pucFrameData_), uiMaxFrameLength_, pstMetaData);
+        if (eStatus != STATUS::SUCCESS && eStatus != STATUS::UNKNOWN) { break; }
+
+        if (eStatus == STATUS::UNKNOWN && bMySkipAheadResync) { SkipUnknownBytes(uiMaxFrameLength_, pstMetaData); }
+        else
         {
-            // Move this framer to the front
-            if (bestFramerIndex != 0)
-            {
-                std::rotate(framerRegistry.begin(), framerRegistry.begin() + bestFramerIndex, framerRegistry.begin() + bestFramerIndex + 1);
-            }
+            pclMyFixedBuffer->erase_begin(pstMetaData->uiLength);
+            ResetConsultedFramerStates();
+        }
 
-            if (stMetaData_->uiLength > uiFrameBufferSize_) { return STATUS::BUFFER_FULL; }
+        pstFrames_[uiFrameCount++] = FrameDescriptor{uiOffset, pstMetaData->uiLength, pstMetaData->eFormat, eStatus};
+        uiOffset += pstMetaData->uiLength;
+    }
 
-            pclMyFixedBuffer->copy_out(pucFrameBuffer_, stMetaData_->uiLength);
-            pclMyFixedBuffer->erase_begin(stMetaData_->uiLength);
-            ResetAllFramerStates();
-            return STATUS::SUCCESS;
+    return uiFrameCount;
+}
+
+void FramerManager::SkipUnknownBytes(const uint32_t uiMaxLength_, MetaDataBase*& stMetaData_, unsigned char* pucUnknownBytes_)
+{
+    auto& clBuffer = *pclMyFixedBuffer;
+    uint32_t uiUnknownBytes = stMetaData_->uiLength;
+    uint32_t uiSkipped = 0;
+
+    while (true)
+    {
+        uiUnknownBytes = std::min(uiUnknownBytes, uiMaxLength_ - uiSkipped);
+        if (pucUnknownBytes_ != nullptr) { clBuffer.copy_out(pucUnknownBytes_ + uiSkipped, uiUnknownBytes); }
+        clBuffer.erase_begin(uiUnknownBytes);
+        uiSkipped += uiUnknownBytes;
+        ResetConsultedFramerStates();
+
+        // Jump over every byte that no framer's frames can start with without consulting the framers
+        const size_t uiSearchEnd = std::min(clBuffer.size(), static_cast<size_t>(uiMaxLength_ - uiSkipped));
+        const unsigned char* pucData = clBuffer.data();
+        size_t uiNextSync = 0;
+        if (clMySyncScanner) { uiNextSync = clMySyncScanner->Find(pucData, uiSearchEnd); }
+        else
+        {
+            while (uiNextSync < uiSearchEnd && aullMyDispatchTable[pucData[uiNextSync]] == 0) { uiNextSync++; }
         }
+        if (pucUnknownBytes_ != nullptr) { clBuffer.copy_out(pucUnknownBytes_ + uiSkipped, uiNextSync); }
+        clBuffer.erase_begin(uiNextSync);
+        uiSkipped += static_cast<uint32_t>(uiNextSync);
 
-        if (bestStatus != STATUS::UNKNOWN) { return bestStatus; }
+        if (uiSkipped == uiMaxLength_ || clBuffer.empty()) { break; }
 
-        // else
-        // Framer failed — discard 1 byte and retry
-        HandleUnknownBytes(pucFrameBuffer_, 1);
-        pucFrameBuffer_ += 1;
-        uiFrameBufferSize_ -= 1;
+        // Let the framers size the unknown bytes at the candidate, or stop if a frame might start there
+        MetaDataBase* pstMetaData = nullptr;
+        if (FindFrame(const_cast<unsigned char*>(clBuffer.data()), uiMaxLength_, pstMetaData) != STATUS::UNKNOWN)
+        {
+            ResetConsultedFramerStates();
+            break;
+        }
+        uiUnknownBytes = pstMetaData->uiLength;
     }
 
-    return STATUS::UNKNOWN;
+    stMyMetaData.eFormat = HEADER_FORMAT::UNKNOWN;
+    stMyMetaData.uiLength = uiSkipped;
+    stMetaData_ = &stMyMetaData;
 }
 
-void FramerManager::HandleUnknownBytes(unsigned char* pucBuffer_, size_t uiUnknownBytes_) const
+void FramerManager::HandleUnknownBytes(unsigned char* pucBuffer_, size_t uiUnknownBytes_)
 {
     if (bMyReportUnknownBytes && pucBuffer_ != nullptr) { pclMyFixedBuffer->copy_out(pucBuffer_, uiUnknownBytes_); }
     pclMyFixedBuffer->erase_begin(uiUnknownBytes_);
-    ResetAllFramerStates();
+    uiMyFrameViewLength = 0;
+    ResetConsultedFramerStates();
 }
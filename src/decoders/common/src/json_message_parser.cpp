@@ -0,0 +1,56 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file json_message_parser.cpp
+// ===============================================================================
+
+#include "novatel_edie/decoders/common/json_message_parser.hpp"
+
+#include <cstring>
+
+using namespace novatel::edie;
+
+// -------------------------------------------------------------------------------------------------------
+simdjson::error_code JsonMessageParser::Parse(const std::string_view svMessage_, simdjson::dom::element& clRoot_, const bool bShare_)
+{
+    // simdjson reads past the end of its input, so copy the message into a padded buffer that is kept between messages
+    // rather than letting the parser allocate a padded copy of each message
+    if (vMyPaddedInput.size() < svMessage_.size() + simdjson::SIMDJSON_PADDING) { vMyPaddedInput.resize(svMessage_.size() + simdjson::SIMDJSON_PADDING); }
+    std::memcpy(vMyPaddedInput.data(), svMessage_.data(), svMessage_.size());
+
+    const simdjson::error_code eError = clMyParser.parse(vMyPaddedInput.data(), svMessage_.size(), false).get(clMyRoot);
+    pcMySharedMessage = bShare_ && eError == simdjson::SUCCESS ? svMessage_.data() : nullptr;
+    uiMySharedLength = svMessage_.size();
+    clRoot_ = clMyRoot;
+    return eError;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool JsonMessageParser::TakeShared(const std::string_view svMessage_, simdjson::dom::element& clRoot_)
+{
+    if (pcMySharedMessage == nullptr || pcMySharedMessage != svMessage_.data() || uiMySharedLength != svMessage_.size()) { return false; }
+
+    pcMySharedMessage = nullptr;
+    clRoot_ = clMyRoot;
+    return true;
+}
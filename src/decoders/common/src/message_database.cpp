@@ -26,6 +26,7 @@
 
 #include "novatel_edie/decoders/common/message_database.hpp"
 
+#include <memory>
 #include <unordered_set>
 
 #include "novatel_edie/decoders/common/common.hpp"
@@ -57,17 +58,17 @@ void MessageDatabase::RemoveEnumeration(std::string_view strEnumeration_)
 }
 
 //-----------------------------------------------------------------------
-uint32_t MessageDatabase::MsgNameToMsgId(std::string sMsgName_) const
+uint32_t MessageDatabase::MsgNameToMsgId(std::string_view sMsgName_) const
 {
     uint32_t uiSiblingId = NULL_SIBLING_ID;
     uint32_t uiMsgFormat;
     uint32_t uiResponse;
 
     // Ingest the sibling information, i.e. the _1 from LOGNAMEA_1
-    if (sMsgName_.find_last_of('_') != std::string::npos && sMsgName_.find_last_of('_') == sMsgName_.size() - 2)
+    if (sMsgName_.size() >= 2 && sMsgName_.find_last_of('_') == sMsgName_.size() - 2)
     {
         uiSiblingId = static_cast<uint32_t>(ToDigit(sMsgName_.back()));
-        sMsgName_.resize(sMsgName_.size() - 2);
+        sMsgName_.remove_suffix(2);
     }
 
     // If this is an abbrev msg (no format information), we will be able to find the MsgDef
@@ -80,22 +81,22 @@ uint32_t MessageDatabase::MsgNameToMsgId(std::string sMsgName_) const
         return CreateMsgId(pclMessageDef->logID, uiSiblingId, uiMsgFormat, uiResponse);
     }
 
-    switch (sMsgName_.back())
+    switch (sMsgName_.empty() ? '\0' : sMsgName_.back())
     {
     case 'R': // ASCII Response
         uiResponse = static_cast<uint32_t>(true);
         uiMsgFormat = static_cast<uint32_t>(MESSAGE_FORMAT::ASCII);
-        sMsgName_.pop_back();
+        sMsgName_.remove_suffix(1);
         break;
     case 'A': // ASCII
         uiResponse = static_cast<uint32_t>(false);
         uiMsgFormat = static_cast<uint32_t>(MESSAGE_FORMAT::ASCII);
-        sMsgName_.pop_back();
+        sMsgName_.remove_suffix(1);
         break;
     case 'B': // Binary
         uiResponse = static_cast<uint32_t>(false);
         uiMsgFormat = static_cast<uint32_t>(MESSAGE_FORMAT::BINARY);
-        sMsgName_.pop_back();
+        sMsgName_.remove_suffix(1);
         break;
     default: // Abbreviated ASCII
         uiResponse = static_cast<uint32_t>(false);
@@ -182,6 +183,69 @@ std::unordered_map<std::string, std::function<size_t(const size_t, const uintptr
     return alignmentFunctions;
 }
 
+// ---------------------------------------------------------------------------
+//! Positions of the fields of a FieldInfo by name, the first one for a repeated name
+struct FieldNameIndex
+{
+    std::unordered_map<std::string, size_t> positions;
+};
+
+// ---------------------------------------------------------------------------
+static std::shared_ptr<const FieldNameIndex> BuildFieldNameIndex(const FieldInfo& fieldInfo_)
+{
+    auto pclIndex = std::make_shared<FieldNameIndex>();
+    pclIndex->positions.reserve(fieldInfo_.messageOrderedFields.size());
+    for (size_t i = 0; i < fieldInfo_.messageOrderedFields.size(); ++i)
+    {
+        if (fieldInfo_.messageOrderedFields[i] != nullptr) { pclIndex->positions.emplace(fieldInfo_.messageOrderedFields[i]->name, i); }
+    }
+    return pclIndex;
+}
+
+// ---------------------------------------------------------------------------
+BaseField::ConstPtr FieldInfo::GetFieldDefByName(const std::string& fieldName_) const
+{
+    std::shared_ptr<const FieldNameIndex> pclIndex = std::atomic_load(&nameIndex);
+    if (pclIndex == nullptr)
+    {
+        // If another thread builds the index first, keep its index
+        std::shared_ptr<const FieldNameIndex> pclBuilt = BuildFieldNameIndex(*this);
+        if (std::atomic_compare_exchange_strong(&nameIndex, &pclIndex, pclBuilt)) { pclIndex = std::move(pclBuilt); }
+    }
+
+    const auto it = pclIndex->positions.find(fieldName_);
+    if (it != pclIndex->positions.end() && it->second < messageOrderedFields.size())
+    {
+        const BaseField::ConstPtr& pclField = messageOrderedFields[it->second];
+        if (pclField != nullptr && pclField->name == fieldName_) { return pclField; }
+    }
+
+    // The name is absent or the index is stale because messageOrderedFields changed without InvalidateCaches()
+    for (const BaseField::ConstPtr& pclField : messageOrderedFields)
+    {
+        if (pclField != nullptr && pclField->name == fieldName_)
+        {
+            std::atomic_store(&nameIndex, BuildFieldNameIndex(*this));
+            return pclField;
+        }
+    }
+    return nullptr;
+}
+
+// ---------------------------------------------------------------------------
+void FieldInfo::InvalidateCaches()
+{
+    std::atomic_store(&decodePlan, std::shared_ptr<const DecodePlan>{});
+    std::atomic_store(&nameIndex, std::shared_ptr<const FieldNameIndex>{});
+}
+
+// ---------------------------------------------------------------------------
+FieldHandle FieldInfo::GetFieldHandle(const std::string& fieldName_) const
+{
+    const BaseField::ConstPtr pclField = GetFieldDefByName(fieldName_);
+    return pclField != nullptr ? FieldHandle(*pclField) : FieldHandle();
+}
+
 // ---------------------------------------------------------------------------
 FieldInfo::ConstPtr BuildFieldInfo(std::vector<BaseField::Ptr> fields, std::string messageFamily)
 {
@@ -235,6 +299,7 @@ FieldInfo::ConstPtr BuildFieldInfo(std::vector<BaseField::Ptr> fields, std::stri
     fieldInfo->fixedFieldBytes = fixedBytes;
     fieldInfo->varFieldCount = varFields;
     fieldInfo->messageOrderedFields = std::move(constFields);
+    fieldInfo->nameIndex = BuildFieldNameIndex(*fieldInfo);
     return fieldInfo;
 }
 
@@ -38,6 +38,163 @@ void MessageDecoderBase::LoadJsonDb(MessageDatabase::Ptr pclMessageDb_)
     ValidateMessageDatabaseFamily(pclMyMsgDb, sMyExpectedMessageFamily, pclMyLogger);
     pclMyMsgDb = std::move(pclMessageDb_);
     InitEnumDefinitions();
+    BindFieldConverters();
+}
+
+// -------------------------------------------------------------------------------------------------------
+DecodePlan::ConstPtr MessageDecoderBase::BindDecodePlan(const DecodePlan& stPlan_) const
+{
+    auto pclPlan = std::make_shared<DecodePlan>(stPlan_);
+    for (DecodeOp& stOp : pclPlan->ops)
+    {
+        const auto itAscii = asciiFieldMap.find(stOp.field->conversionHash);
+        stOp.asciiConverter = itAscii != asciiFieldMap.end() ? itAscii->second : nullptr;
+        const auto itJson = jsonFieldMap.find(stOp.field->conversionHash);
+        stOp.jsonConverter = itJson != jsonFieldMap.end() ? itJson->second : nullptr;
+        if (stOp.subPlan != nullptr) { stOp.subPlan = BindDecodePlan(*stOp.subPlan); }
+    }
+    return pclPlan;
+}
+
+// -------------------------------------------------------------------------------------------------------
+const MessageDecoderBase::BoundPlan* MessageDecoderBase::FindBoundPlan(const FieldInfo& fieldInfo_) const
+{
+    const auto it = mMyBoundPlans.find(&fieldInfo_);
+    // The base plan is kept alive by the bound plan, so a recompiled plan cannot take its address
+    if (it == mMyBoundPlans.end() || &fieldInfo_.GetDecodePlan() != it->second.basePlan.get()) { return nullptr; }
+    return &it->second;
+}
+
+// -------------------------------------------------------------------------------------------------------
+DecodePlan::ConstPtr MessageDecoderBase::GetBoundPlan(const FieldInfo& fieldInfo_) const
+{
+    const BoundPlan* pstBoundPlan = FindBoundPlan(fieldInfo_);
+    return pstBoundPlan != nullptr ? pstBoundPlan->plan : GetLateBoundPlan(fieldInfo_).plan;
+}
+
+// -------------------------------------------------------------------------------------------------------
+MessageDecoderBase::BoundPlan MessageDecoderBase::GetLateBoundPlan(const FieldInfo& fieldInfo_) const
+{
+    DecodePlan::ConstPtr pclBasePlan = fieldInfo_.GetDecodePlanPtr();
+
+    std::lock_guard<std::mutex> lock(stMyLateBoundPlans.mutex);
+    BoundPlan& stBoundPlan = stMyLateBoundPlans.plans[&fieldInfo_];
+    // The base plan is kept alive by the bound plan, so neither a recompiled plan nor a new field info at the same address can match it
+    if (stBoundPlan.basePlan != pclBasePlan)
+    {
+        DecodePlan::ConstPtr pclPlan = BindDecodePlan(*pclBasePlan);
+        DecodePlan::ConstPtr pclProjectedPlan = ProjectLateBoundPlan(fieldInfo_, *pclPlan);
+        stBoundPlan = {nullptr, std::move(pclBasePlan), std::move(pclPlan), std::move(pclProjectedPlan)};
+    }
+    return stBoundPlan;
+}
+
+// -------------------------------------------------------------------------------------------------------
+DecodePlan::ConstPtr MessageDecoderBase::ProjectLateBoundPlan(const FieldInfo& fieldInfo_, const DecodePlan& stPlan_) const
+{
+    if (pclMyMsgDb == nullptr) { return nullptr; }
+
+    // A field info does not know its message, so look for it among the projected messages
+    for (const auto& [sMessageName, vFieldNames] : mMyProjections)
+    {
+        const MessageDefinition::ConstPtr pclMessageDef = pclMyMsgDb->GetMsgDef(sMessageName);
+        if (pclMessageDef == nullptr) { continue; }
+        for (const auto& [uiCrc, pclFieldInfo] : pclMessageDef->fieldInfo)
+        {
+            if (pclFieldInfo.get() == &fieldInfo_) { return ProjectDecodePlan(stPlan_, vFieldNames); }
+        }
+    }
+    return nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void MessageDecoderBase::BindFieldConverters()
+{
+    mMyBoundPlans.clear();
+    ClearLateBoundPlans();
+    if (pclMyMsgDb == nullptr) { return; }
+
+    // Bind the plans of the database up front so that decoding calls the converters of their ops directly
+    for (const auto& pclMessageDef : pclMyMsgDb->MessageDefinitions())
+    {
+        for (const auto& [uiCrc, pclFieldInfo] : pclMessageDef->fieldInfo)
+        {
+            if (pclFieldInfo == nullptr) { continue; }
+            try
+            {
+                DecodePlan::ConstPtr pclBasePlan = pclFieldInfo->GetDecodePlanPtr();
+                DecodePlan::ConstPtr pclPlan = BindDecodePlan(*pclBasePlan);
+                mMyBoundPlans[pclFieldInfo.get()] = {pclFieldInfo, std::move(pclBasePlan), std::move(pclPlan), nullptr};
+            }
+            catch (const std::runtime_error& e)
+            {
+                // The message is reported when it is decoded
+                SPDLOG_LOGGER_WARN(pclMyLogger, "LoadJsonDb(): Could not compile {}: {}", pclMessageDef->name, e.what());
+            }
+        }
+    }
+
+    CompileProjectedPlans();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void MessageDecoderBase::SetProjection(const std::string& messageName_, std::vector<std::string> fieldNames_)
+{
+    mMyProjections[messageName_] = std::move(fieldNames_);
+    CompileProjectedPlans();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void MessageDecoderBase::ClearProjections()
+{
+    mMyProjections.clear();
+    for (auto& [pclFieldInfo, stBoundPlan] : mMyBoundPlans) { stBoundPlan.projectedPlan = nullptr; }
+    ClearLateBoundPlans();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void MessageDecoderBase::ClearLateBoundPlans()
+{
+    std::lock_guard<std::mutex> lock(stMyLateBoundPlans.mutex);
+    stMyLateBoundPlans.plans.clear();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void MessageDecoderBase::CompileProjectedPlans()
+{
+    for (auto& [pclFieldInfo, stBoundPlan] : mMyBoundPlans) { stBoundPlan.projectedPlan = nullptr; }
+    // Late bound plans are projected when they are bound again
+    ClearLateBoundPlans();
+    if (pclMyMsgDb == nullptr) { return; }
+
+    for (const auto& [sMessageName, vFieldNames] : mMyProjections)
+    {
+        const MessageDefinition::ConstPtr pclMessageDef = pclMyMsgDb->GetMsgDef(sMessageName);
+        if (pclMessageDef == nullptr)
+        {
+            SPDLOG_LOGGER_WARN(pclMyLogger, "SetProjection(): Unknown message {}, projected once it is added to the database", sMessageName);
+            continue;
+        }
+
+        for (const auto& [uiCrc, pclFieldInfo] : pclMessageDef->fieldInfo)
+        {
+            if (pclFieldInfo == nullptr) { continue; }
+            if (uiCrc == pclMessageDef->latestMessageCrc)
+            {
+                for (const std::string& sFieldName : vFieldNames)
+                {
+                    if (pclFieldInfo->GetFieldDefByName(sFieldName) == nullptr)
+                    {
+                        SPDLOG_LOGGER_WARN(pclMyLogger, "SetProjection(): {} has no field {}", sMessageName, sFieldName);
+                    }
+                }
+            }
+
+            // A message added to the database since BindFieldConverters() is projected when it is bound on first use
+            const auto it = mMyBoundPlans.find(pclFieldInfo.get());
+            if (it != mMyBoundPlans.end()) { it->second.projectedPlan = ProjectDecodePlan(*it->second.plan, vFieldNames); }
+        }
+    }
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -268,103 +425,226 @@ void MessageDecoderBase::DecodeBinaryField(const BaseField& pstMessageDataType_,
 template void MessageDecoderBase::DecodeBinaryField<true>(const BaseField&, const unsigned char**, CompositeField&, size_t);
 template void MessageDecoderBase::DecodeBinaryField<false>(const BaseField&, const unsigned char**, CompositeField&, size_t);
 
+// -------------------------------------------------------------------------------------------------------
+// Leave an empty payload in a variable field skipped by a projection, so that the message can still be encoded
+static void EmplaceAbsentField(const DecodeOp& stOp_, CompositeField& clCompField_)
+{
+    const BaseField& field = *stOp_.field;
+    switch (stOp_.type)
+    {
+    case FIELD_TYPE::STRING: [[fallthrough]];
+    case FIELD_TYPE::RESPONSE_STR: clCompField_.EmplaceVarField<std::string>(field.index); break;
+    case FIELD_TYPE::FIELD_ARRAY: clCompField_.EmplaceVarField<CompositeFieldArray>(field.index); break;
+    case FIELD_TYPE::VARIABLE_LENGTH_ARRAY:
+        if (field.isString) { clCompField_.EmplaceVarField<std::string>(field.index); }
+        else
+        {
+            SimpleTypeVisitor(field, [&](auto tag) {
+                using T = std::conditional_t<std::is_same_v<decltype(tag), bool>, uint8_t, decltype(tag)>;
+                clCompField_.EmplaceVarField<std::vector<T>>(field.index);
+            });
+        }
+        break;
+    default: break;
+    }
+}
+
 // -------------------------------------------------------------------------------------------------------
 STATUS
-MessageDecoderBase::DecodeBinary(const FieldInfo& vMsgDefFields_, const unsigned char** ppucLogBuf_, CompositeField& clCompField_,
+MessageDecoderBase::DecodeBinary(const DecodePlan& stPlan_, const unsigned char** ppucLogBuf_, CompositeField& clCompField_,
                                  const uint32_t uiMessageLength_) const
 {
     const unsigned char* pucTempStart = *ppucLogBuf_;
 
-    for (const auto& field : vMsgDefFields_.messageOrderedFields)
+    for (size_t i = 0; i < stPlan_.ops.size(); ++i)
     {
-        auto fieldTypeLength = static_cast<uint8_t>(field->dataType.length);
-        *ppucLogBuf_ += fMyAlignmentFunc(fieldTypeLength, reinterpret_cast<uintptr_t>(pucTempStart), reinterpret_cast<uintptr_t>(*ppucLogBuf_));
+        const DecodeOp& stOp = stPlan_.ops[i];
+        const BaseField& field = *stOp.field;
+
+        *ppucLogBuf_ += Align(stOp.typeLength, pucTempStart, *ppucLogBuf_);
 
-        switch (field->type)
+        // A run of plain copies is contiguous in the fixed fields. Take as much of it as is also contiguous in the message, and
+        // only if it ends within the message, so that a short message stops after the same field as it would field by field.
+        uint32_t uiRunOps = stOp.runOps;
+        uint32_t uiRunBytes = stOp.runBytes;
+        for (uint32_t j = 1; bMyAligned && j < uiRunOps; ++j)
         {
-        case FIELD_TYPE::SIMPLE: DecodeBinaryField<true>(*field, ppucLogBuf_, clCompField_, 1); break;
-        case FIELD_TYPE::ENUM:
-            switch (field->dataType.length)
+            const DecodeOp& stRunOp = stPlan_.ops[i + j];
+            const size_t uiRunOffset = stRunOp.field->index - field.index;
+            if (Align(stRunOp.typeLength, pucTempStart, *ppucLogBuf_ + uiRunOffset) != 0)
             {
-            case 1: clCompField_.SetFieldValue<true>(field->index, LoadValueFromBuffer<uint8_t>(*ppucLogBuf_)); break;
-            case 2: clCompField_.SetFieldValue<true>(field->index, LoadValueFromBuffer<uint16_t>(*ppucLogBuf_)); break;
-            case 4: clCompField_.SetFieldValue<true>(field->index, LoadValueFromBuffer<uint32_t>(*ppucLogBuf_)); break;
-            default:
-                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeBinary(): Invalid field length\n");
-                throw std::runtime_error("DecodeBinary(): Invalid field length\n");
+                uiRunOps = j;
+                uiRunBytes = static_cast<uint32_t>(uiRunOffset);
             }
-            *ppucLogBuf_ += field->dataType.length;
-            break;
-        case FIELD_TYPE::RESPONSE_ID:
-            clCompField_.SetFieldValue<true>(field->index, LoadValueFromBuffer<int32_t>(*ppucLogBuf_));
-            *ppucLogBuf_ += sizeof(int32_t);
-            break;
-        case FIELD_TYPE::RESPONSE_STR: {
-            std::string_view sTemp(reinterpret_cast<const char*>(*ppucLogBuf_), uiMessageLength_ - sizeof(int32_t)); // Remove CRC
-            clCompField_.SetFieldValue<false>(field->index, std::string(sTemp));
-            // Binary response string is not null terminated or 4 byte aligned
-            *ppucLogBuf_ += sTemp.size();
-            break;
         }
-        case FIELD_TYPE::FIXED_LENGTH_ARRAY: {
-            const uint32_t uiArraySize = dynamic_cast<const ArrayField*>(field.get())->arrayLength;
-            DecodeBinaryField<true>(*field, ppucLogBuf_, clCompField_, uiArraySize);
-            break;
+
+        if (stOp.skip)
+        {
+            STATUS eStatus = SkipBinaryOp(stOp, pucTempStart, ppucLogBuf_, clCompField_, uiMessageLength_);
+            if (eStatus != STATUS::SUCCESS) { return eStatus; }
+            EmplaceAbsentField(stOp, clCompField_);
         }
-        case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
-            const uint32_t uiArraySize = GetArrayLength(pucTempStart, ppucLogBuf_, dynamic_cast<const ArrayField&>(*field), clCompField_);
-            DecodeBinaryField<false>(*field, ppucLogBuf_, clCompField_, uiArraySize);
-            break;
+        else if (uiRunOps > 1 && static_cast<int64_t>(uiMessageLength_) - (*ppucLogBuf_ - pucTempStart) >= uiRunBytes)
+        {
+            clCompField_.SetFieldValue<true>(field.index, reinterpret_cast<const std::byte*>(*ppucLogBuf_), uiRunBytes);
+            *ppucLogBuf_ += uiRunBytes;
+            i += uiRunOps - 1;
         }
-        case FIELD_TYPE::STRING: {
-            // This version of a string is different. It is hopefully null terminated.
-            std::string_view sTemp(reinterpret_cast<const char*>(*ppucLogBuf_));
-            clCompField_.SetFieldValue<false>(field->index, std::string(sTemp));
-            *ppucLogBuf_ += sTemp.size() + 1; // + 1 to consume the NULL at the end of the string.
-            AddStringFieldPadding(pucTempStart, ppucLogBuf_);
-            break;
+        else if (stOp.copyBytes > 0)
+        {
+            // SIMPLE, ENUM or FIXED_LENGTH_ARRAY field stored as it is encoded
+            clCompField_.SetFieldValue<true>(field.index, reinterpret_cast<const std::byte*>(*ppucLogBuf_), stOp.copyBytes);
+            *ppucLogBuf_ += stOp.copyBytes;
         }
-        case FIELD_TYPE::FIELD_ARRAY: {
-            auto fieldArrayDef = std::dynamic_pointer_cast<const FieldArrayField>(field);
-            if (!fieldArrayDef)
+        else
+        {
+            switch (stOp.type)
             {
-                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeBinary(): FIELD_ARRAY definition cast failed");
-                return STATUS::MALFORMED_INPUT;
+            case FIELD_TYPE::SIMPLE: DecodeBinaryField<true>(field, ppucLogBuf_, clCompField_, 1); break;
+            case FIELD_TYPE::ENUM:
+                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeBinary(): Invalid field length\n");
+                throw std::runtime_error("DecodeBinary(): Invalid field length\n");
+            case FIELD_TYPE::RESPONSE_ID:
+                clCompField_.SetFieldValue<true>(field.index, LoadValueFromBuffer<int32_t>(*ppucLogBuf_));
+                *ppucLogBuf_ += sizeof(int32_t);
+                break;
+            case FIELD_TYPE::RESPONSE_STR: {
+                std::string_view sTemp(reinterpret_cast<const char*>(*ppucLogBuf_), uiMessageLength_ - sizeof(int32_t)); // Remove CRC
+                clCompField_.EmplaceVarField<std::string>(field.index).assign(sTemp);
+                // Binary response string is not null terminated or 4 byte aligned
+                *ppucLogBuf_ += sTemp.size();
+                break;
             }
-            const auto* subFieldDefinitions = fieldArrayDef.get();
-            const uint32_t uiArraySize = GetArrayLength(pucTempStart, ppucLogBuf_, *subFieldDefinitions, clCompField_);
-
-            if (subFieldDefinitions->fieldInfo->varFieldCount == 0)
-            {
-                const size_t totalBytes = uiArraySize * subFieldDefinitions->fieldInfo->fixedFieldBytes;
-                // Store flat FIELD_ARRAY directly as std::vector<std::byte>
-                std::vector<std::byte> flatFieldData(reinterpret_cast<const std::byte*>(*ppucLogBuf_),
-                                                     reinterpret_cast<const std::byte*>(*ppucLogBuf_) + totalBytes);
-                clCompField_.SetFieldValue(*field, FlatFieldArray(std::move(flatFieldData), subFieldDefinitions->fieldInfo.get()));
-                *ppucLogBuf_ += totalBytes;
+            case FIELD_TYPE::FIXED_LENGTH_ARRAY: DecodeBinaryField<true>(field, ppucLogBuf_, clCompField_, stOp.arrayLength); break;
+            case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
+                const uint32_t uiArraySize = GetArrayLength(pucTempStart, ppucLogBuf_, *stOp.arrayField, clCompField_);
+                if (bMyViewDecoding)
+                {
+                    SimpleTypeVisitor(field, [&](auto tag) {
+                        using T = std::conditional_t<std::is_same_v<decltype(tag), bool>, uint8_t, decltype(tag)>;
+                        clCompField_.BorrowVarField<T>(field.index, reinterpret_cast<const std::byte*>(*ppucLogBuf_), uiArraySize);
+                    });
+                    *ppucLogBuf_ += field.dataType.length * uiArraySize;
+                }
+                else { DecodeBinaryField<false>(field, ppucLogBuf_, clCompField_, uiArraySize); }
+                break;
             }
-            else
-            {
-                std::vector<CompositeField> vFieldArrayContainer(uiArraySize);
-                for (uint32_t i = 0; i < uiArraySize; ++i)
+            case FIELD_TYPE::STRING: {
+                // This version of a string is different. It is hopefully null terminated.
+                std::string_view sTemp(reinterpret_cast<const char*>(*ppucLogBuf_));
+                clCompField_.EmplaceVarField<std::string>(field.index).assign(sTemp);
+                *ppucLogBuf_ += sTemp.size() + 1; // + 1 to consume the NULL at the end of the string.
+                AddStringFieldPadding(pucTempStart, ppucLogBuf_);
+                break;
+            }
+            case FIELD_TYPE::FIELD_ARRAY: {
+                const FieldArrayField* subFieldDefinitions = stOp.fieldArrayField;
+                if (subFieldDefinitions == nullptr)
                 {
-                    *ppucLogBuf_ +=
-                        fMyAlignmentFunc(fieldTypeLength, reinterpret_cast<uintptr_t>(pucTempStart), reinterpret_cast<uintptr_t>(*ppucLogBuf_));
-                    vFieldArrayContainer[i] =
-                        CompositeField(subFieldDefinitions->fieldInfo->fixedFieldBytes, subFieldDefinitions->fieldInfo->varFieldCount);
-                    vFieldArrayContainer[i].SetFieldInfo(subFieldDefinitions->fieldInfo);
-                    STATUS eStatus = DecodeBinary(*subFieldDefinitions->fieldInfo, ppucLogBuf_, vFieldArrayContainer[i],
-                                                  uiMessageLength_ - static_cast<uint32_t>(*ppucLogBuf_ - pucTempStart));
-                    if (eStatus != STATUS::SUCCESS) { return eStatus; }
+                    SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeBinary(): FIELD_ARRAY definition cast failed");
+                    return STATUS::MALFORMED_INPUT;
                 }
-                clCompField_.SetFieldValue(*field, std::move(vFieldArrayContainer));
+                const uint32_t uiArraySize = GetArrayLength(pucTempStart, ppucLogBuf_, *subFieldDefinitions, clCompField_);
+
+                if (stOp.flatArray)
+                {
+                    const size_t totalBytes = uiArraySize * subFieldDefinitions->fieldInfo->fixedFieldBytes;
+                    // Store flat FIELD_ARRAY directly as its encoded bytes
+                    auto& clFlatArray = clCompField_.EmplaceVarField<FlatFieldArray>(field.index);
+                    const auto* pucElements = reinterpret_cast<const std::byte*>(*ppucLogBuf_);
+                    if (bMyViewDecoding) { clFlatArray.AssignView(pucElements, totalBytes, subFieldDefinitions->fieldInfo.get()); }
+                    else { clFlatArray.Assign(pucElements, totalBytes, subFieldDefinitions->fieldInfo.get()); }
+                    *ppucLogBuf_ += totalBytes;
+                }
+                else
+                {
+                    auto& vFieldArrayContainer = clCompField_.EmplaceVarField<CompositeFieldArray>(field.index);
+                    vFieldArrayContainer.reserve(uiArraySize);
+                    for (uint32_t j = 0; j < uiArraySize; ++j)
+                    {
+                        *ppucLogBuf_ += Align(stOp.typeLength, pucTempStart, *ppucLogBuf_);
+                        CompositeField& clRecord = clCompField_.EmplaceRecord(vFieldArrayContainer, subFieldDefinitions->fieldInfo);
+                        STATUS eStatus = DecodeBinary(*stOp.subPlan, ppucLogBuf_, clRecord,
+                                                      uiMessageLength_ - static_cast<uint32_t>(*ppucLogBuf_ - pucTempStart));
+                        if (eStatus != STATUS::SUCCESS) { return eStatus; }
+                    }
+                }
+                break;
+            }
+            default:
+                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeBinary(): Unknown field type\n");
+                throw std::runtime_error("DecodeBinary(): Unknown field type\n");
             }
-            break;
         }
-        default:
-            SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeBinary(): Unknown field type\n");
-            throw std::runtime_error("DecodeBinary(): Unknown field type\n");
+
+        if (*ppucLogBuf_ - pucTempStart >= static_cast<int32_t>(uiMessageLength_)) { return STATUS::SUCCESS; }
+    }
+    return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS MessageDecoderBase::SkipBinaryOp(const DecodeOp& stOp_, const unsigned char* pucTempStart_, const unsigned char** ppucLogBuf_,
+                                        const CompositeField& clCompField_, const uint32_t uiMessageLength_) const
+{
+    const BaseField& field = *stOp_.field;
+
+    switch (stOp_.type)
+    {
+    case FIELD_TYPE::SIMPLE: [[fallthrough]];
+    case FIELD_TYPE::ENUM: *ppucLogBuf_ += field.dataType.length; break;
+    case FIELD_TYPE::RESPONSE_ID: *ppucLogBuf_ += sizeof(int32_t); break;
+    case FIELD_TYPE::RESPONSE_STR: *ppucLogBuf_ += uiMessageLength_ - sizeof(int32_t); break;
+    case FIELD_TYPE::FIXED_LENGTH_ARRAY: *ppucLogBuf_ += static_cast<size_t>(field.dataType.length) * stOp_.arrayLength; break;
+    case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
+        const uint32_t uiArraySize = GetArrayLength(pucTempStart_, ppucLogBuf_, *stOp_.arrayField, clCompField_);
+        *ppucLogBuf_ += static_cast<size_t>(field.dataType.length) * uiArraySize;
+        break;
+    }
+    case FIELD_TYPE::STRING:
+        *ppucLogBuf_ += strlen(reinterpret_cast<const char*>(*ppucLogBuf_)) + 1; // + 1 to consume the NULL at the end of the string.
+        AddStringFieldPadding(pucTempStart_, ppucLogBuf_);
+        break;
+    case FIELD_TYPE::FIELD_ARRAY: {
+        const FieldArrayField* subFieldDefinitions = stOp_.fieldArrayField;
+        if (subFieldDefinitions == nullptr)
+        {
+            SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeBinary(): FIELD_ARRAY definition cast failed");
+            return STATUS::MALFORMED_INPUT;
+        }
+        const uint32_t uiArraySize = GetArrayLength(pucTempStart_, ppucLogBuf_, *subFieldDefinitions, clCompField_);
+
+        if (stOp_.flatArray) { *ppucLogBuf_ += uiArraySize * subFieldDefinitions->fieldInfo->fixedFieldBytes; }
+        else
+        {
+            for (uint32_t i = 0; i < uiArraySize; ++i)
+            {
+                *ppucLogBuf_ += Align(stOp_.typeLength, pucTempStart_, *ppucLogBuf_);
+                STATUS eStatus = SkipBinary(*stOp_.subPlan, ppucLogBuf_, clCompField_,
+                                            uiMessageLength_ - static_cast<uint32_t>(*ppucLogBuf_ - pucTempStart_));
+                if (eStatus != STATUS::SUCCESS) { return eStatus; }
+            }
         }
+        break;
+    }
+    default:
+        SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeBinary(): Unknown field type\n");
+        throw std::runtime_error("DecodeBinary(): Unknown field type\n");
+    }
+
+    return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS MessageDecoderBase::SkipBinary(const DecodePlan& stPlan_, const unsigned char** ppucLogBuf_, const CompositeField& clCompField_,
+                                      const uint32_t uiMessageLength_) const
+{
+    const unsigned char* pucTempStart = *ppucLogBuf_;
+
+    for (const DecodeOp& stOp : stPlan_.ops)
+    {
+        *ppucLogBuf_ += Align(stOp.typeLength, pucTempStart, *ppucLogBuf_);
+        STATUS eStatus = SkipBinaryOp(stOp, pucTempStart, ppucLogBuf_, clCompField_, uiMessageLength_);
+        if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
         if (*ppucLogBuf_ - pucTempStart >= static_cast<int32_t>(uiMessageLength_)) { return STATUS::SUCCESS; }
     }
@@ -381,16 +661,41 @@ void MessageDecoderBase::DecodeAsciiField(const BaseField& field_, const char**
 }
 
 // -------------------------------------------------------------------------------------------------------
+// Store decoded array elements directly into a fixed array field, or into the payload of a variable-length array field
+template <typename ElementType, typename Container = std::vector<ElementType>> class ArrayElementStore
+{
+  public:
+    ArrayElementStore(CompositeField& clCompField_, const BaseField& field_, uint32_t uiArraySize_, bool fixed_)
+        : clMyCompField(clCompField_), uiMyIndex(field_.index), pvMyValues(nullptr)
+    {
+        if (!fixed_)
+        {
+            pvMyValues = &clCompField_.EmplaceVarField<Container>(field_.index);
+            pvMyValues->resize(uiArraySize_);
+        }
+    }
+
+    void operator()(uint32_t uiElement_, ElementType value_)
+    {
+        if (pvMyValues != nullptr) { (*pvMyValues)[uiElement_] = value_; }
+        else { clMyCompField.SetFieldValue<true>(uiMyIndex + uiElement_ * sizeof(ElementType), value_); }
+    }
+
+  private:
+    CompositeField& clMyCompField;
+    size_t uiMyIndex;
+    Container* pvMyValues;
+};
+
 // Decode an ASCII array formatted with the %Z conversion string
-static STATUS DecodeZConversionStringAsciiArray(std::vector<uint8_t>& vDecodedValues_, const char** ppcLogBuf_, uint32_t uiArraySize_)
+template <typename StoreFunc> static STATUS DecodeZConversionStringAsciiArray(StoreFunc&& store_, const char** ppcLogBuf_, uint32_t uiArraySize_)
 {
-    vDecodedValues_.resize(uiArraySize_);
     for (uint32_t i = 0; i < uiArraySize_; ++i)
     {
         uint32_t uiValueRead = 0;
         if (sscanf(*ppcLogBuf_, "%02x", &uiValueRead) != 1) { return STATUS::MALFORMED_INPUT; }
         *ppcLogBuf_ += 2;
-        vDecodedValues_[i] = static_cast<uint8_t>(uiValueRead);
+        store_(i, static_cast<uint8_t>(uiValueRead));
     }
 
     return STATUS::SUCCESS;
@@ -427,36 +732,39 @@ template <typename CharType> static STATUS DecodeNonCommaSeparatedAsciiArrayFiel
 
 // Decode an ASCII array made up of non-comma separated values, e.g. a raw ASCII values or hex representations
 template <typename CharType>
-static STATUS DecodeNonCommaSeparatedAsciiArray(CompositeField& clCompField_, const char** ppcLogBuf_, const BaseField::ConstPtr& field_,
+static STATUS DecodeNonCommaSeparatedAsciiArray(CompositeField& clCompField_, const char** ppcLogBuf_, const BaseField& field_,
                                                 uint32_t uiArraySize_, bool fixed_)
 {
-    std::vector<CharType> vDecodedValues(uiArraySize_);
+    ArrayElementStore<CharType> store(clCompField_, field_, uiArraySize_, fixed_);
     for (uint32_t i = 0; i < uiArraySize_; ++i)
     {
-        STATUS eStatus = DecodeNonCommaSeparatedAsciiArrayField(vDecodedValues[i], ppcLogBuf_);
+        CharType cValue = 0;
+        STATUS eStatus = DecodeNonCommaSeparatedAsciiArrayField(cValue, ppcLogBuf_);
         if (eStatus != STATUS::SUCCESS) { return eStatus; }
+        store(i, cValue);
     }
-    if (fixed_) { clCompField_.SetFieldValue<true>(field_->index, std::move(vDecodedValues)); }
-    else { clCompField_.SetFieldValue<false>(field_->index, std::move(vDecodedValues)); }
     return STATUS::SUCCESS;
 }
 
 // Decode an ASCII array which is formatted like a string with opening and closing quotes, e.g. "string value"
-static STATUS DecodeStringAsciiArray(std::string& sDecodedValue_, const char** ppcLogBuf_, uint32_t uiArraySize_)
+// Elements after the closing quote are stored as '\0'.
+template <typename StoreFunc> static STATUS DecodeStringAsciiArray(StoreFunc&& store_, const char** ppcLogBuf_, uint32_t uiArraySize_)
 {
-    sDecodedValue_.assign(uiArraySize_, '\0');
-
     // Look for opening double-quote
     if (**ppcLogBuf_ != '\"') { return STATUS::MALFORMED_INPUT; }
     *ppcLogBuf_ += 1;
 
-    for (uint32_t i = 0; i < uiArraySize_; ++i)
+    uint32_t uiDecoded = 0;
+    for (; uiDecoded < uiArraySize_; ++uiDecoded)
     {
         if (**ppcLogBuf_ == '\"') { break; }
 
-        STATUS eStatus = DecodeNonCommaSeparatedAsciiArrayField(sDecodedValue_[i], ppcLogBuf_);
+        char cValue = '\0';
+        STATUS eStatus = DecodeNonCommaSeparatedAsciiArrayField(cValue, ppcLogBuf_);
         if (eStatus != STATUS::SUCCESS) { return eStatus; }
+        store_(uiDecoded, cValue);
     }
+    for (uint32_t i = uiDecoded; i < uiArraySize_; ++i) { store_(i, '\0'); }
 
     // Look for closing double-quote
     if (**ppcLogBuf_ != '\"') { return STATUS::MALFORMED_INPUT; }
@@ -465,222 +773,279 @@ static STATUS DecodeStringAsciiArray(std::string& sDecodedValue_, const char** p
     return STATUS::SUCCESS;
 }
 
-template <bool Abbreviated>
-STATUS MessageDecoderBase::DecodeAscii(const FieldInfo& vMsgDefFields_, const char** ppcLogBuf_, CompositeField& clCompField_,
-                                       const char* pcBufEnd_) const
+// Skip over an ASCII array made up of non-comma separated values
+static STATUS SkipNonCommaSeparatedAsciiArray(const char** ppcLogBuf_, uint32_t uiArraySize_)
 {
-    constexpr char fieldDelim = Abbreviated ? ' ' : ',';
-    constexpr char endDelim = Abbreviated ? '\r' : '*';
+    for (uint32_t i = 0; i < uiArraySize_; ++i)
+    {
+        char cValue = 0;
+        STATUS eStatus = DecodeNonCommaSeparatedAsciiArrayField(cValue, ppcLogBuf_);
+        if (eStatus != STATUS::SUCCESS) { return eStatus; }
+    }
+    return STATUS::SUCCESS;
+}
 
-    // Null-terminated C-strings for strcspn
-    constexpr std::array<char, 3> tokenDelimiters = {fieldDelim, endDelim, '\0'};
-    constexpr std::array<char, 3> unquotedStringDelimiters = {fieldDelim, endDelim, '\0'};
-    constexpr std::array<char, 3> quotedStringDelimiters = {'\"', endDelim, '\0'};
-    constexpr std::array<char, 2> responseDelimiters = {endDelim, '\0'};
+// -------------------------------------------------------------------------------------------------------
+template <bool Abbreviated, bool Skip>
+STATUS MessageDecoderBase::DecodeAsciiOp(const DecodeOp& stOp_, const char** ppcLogBuf_, CompositeField* pclCompField_, const char* pcBufEnd_,
+                                         const DelimiterIndex& clIndex_, bool& bEarlyEndOfMessage_) const
+{
+    constexpr char endDelim = Abbreviated ? '\r' : '*';
 
-    if (pcBufEnd_ == nullptr) { pcBufEnd_ = static_cast<const char*>(std::memchr(*ppcLogBuf_, '\0', MAX_ASCII_MESSAGE_LENGTH)); }
+    const BaseField& field = *stOp_.field;
 
-    for (const auto& field : vMsgDefFields_.messageOrderedFields)
-    {
-        if (*ppcLogBuf_ >= pcBufEnd_) { return STATUS::MALFORMED_INPUT; } // We encountered the end of the buffer unexpectedly
+    if (*ppcLogBuf_ >= pcBufEnd_) { return STATUS::MALFORMED_INPUT; } // We encountered the end of the buffer unexpectedly
 
-        if constexpr (Abbreviated) { ConsumeAbbrevFormatting(ppcLogBuf_); }
+    if constexpr (Abbreviated) { ConsumeAbbrevFormatting(ppcLogBuf_); }
 
-        size_t tokenLength = strcspn(*ppcLogBuf_, tokenDelimiters.data());
-        if (tokenLength == 0) { return STATUS::MALFORMED_INPUT; }
+    size_t tokenLength = clIndex_.TokenLength(*ppcLogBuf_);
+    if (tokenLength == 0) { return STATUS::MALFORMED_INPUT; }
 
-        bool bEarlyEndOfMessage = (*(*ppcLogBuf_ + tokenLength) == endDelim);
+    bEarlyEndOfMessage_ = (*(*ppcLogBuf_ + tokenLength) == endDelim);
 
-        switch (field->type)
+    switch (stOp_.type)
+    {
+    case FIELD_TYPE::SIMPLE:
+        if constexpr (!Skip)
         {
-        case FIELD_TYPE::SIMPLE:
             try
             {
-                DecodeAsciiField(*field, ppcLogBuf_, tokenLength, clCompField_);
+                DecodeAsciiField(stOp_, ppcLogBuf_, tokenLength, *pclCompField_);
             }
             catch (const std::runtime_error&)
             {
                 SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAsciiField(): Exception when decoding field. Malformed Input\n");
                 return STATUS::MALFORMED_INPUT;
             }
-            *ppcLogBuf_ += tokenLength + 1;
-            break;
-        case FIELD_TYPE::ENUM: {
+        }
+        *ppcLogBuf_ += tokenLength + 1;
+        break;
+    case FIELD_TYPE::ENUM:
+        if constexpr (!Skip)
+        {
             std::string_view sEnum(*ppcLogBuf_, tokenLength);
-            const auto* enumField = dynamic_cast<const EnumField*>(field.get());
-            const int32_t enumValue = GetEnumValue(enumField->enumDef, sEnum);
-            switch (enumField->dataType.length)
+            const int32_t enumValue = GetEnumValue(stOp_.enumField->enumDef, sEnum);
+            switch (stOp_.typeLength)
             {
-            case 1: clCompField_.SetFieldValue<true>(field->index, static_cast<int8_t>(enumValue)); break;
-            case 2: clCompField_.SetFieldValue<true>(field->index, static_cast<int16_t>(enumValue)); break;
-            default: clCompField_.SetFieldValue<true>(field->index, enumValue); break;
+            case 1: pclCompField_->SetFieldValue<true>(field.index, static_cast<int8_t>(enumValue)); break;
+            case 2: pclCompField_->SetFieldValue<true>(field.index, static_cast<int16_t>(enumValue)); break;
+            default: pclCompField_->SetFieldValue<true>(field.index, enumValue); break;
             }
-            *ppcLogBuf_ += tokenLength + 1;
-            break;
         }
-        case FIELD_TYPE::STRING:
-            switch (**ppcLogBuf_)
+        *ppcLogBuf_ += tokenLength + 1;
+        break;
+    case FIELD_TYPE::STRING:
+        switch (**ppcLogBuf_)
+        {
+        case ',': [[fallthrough]];
+        case '*':
+            if constexpr (!Skip) { pclCompField_->EmplaceVarField<std::string>(field.index); }
+            *ppcLogBuf_ += 1;
+            break;
+        case '"':
+        {
+            // If a field delimiter character is in the string, the previous tokenLength value is invalid.
+            tokenLength = clIndex_.QuotedLength(*ppcLogBuf_ + 1); // Look for LAST '"' character, skipping past the first.
+            if constexpr (!Skip)
             {
-            case ',': [[fallthrough]];
-            case '*':
-                clCompField_.SetFieldValue<false>(field->index, std::string(""));
-                *ppcLogBuf_ += 1;
-                break;
-            case '"':
-                // If a field delimiter character is in the string, the previous tokenLength value is invalid.
-                tokenLength = strcspn(*ppcLogBuf_ + 1, quotedStringDelimiters.data()); // Look for LAST '"' character, skipping past the first.
-                clCompField_.SetFieldValue<false>(field->index, std::string(*ppcLogBuf_ + 1, tokenLength)); // + 1 to pass opening double-quote.
-                // Skip past the first '"', string token and the remaining characters ('"' and ',').
-                *ppcLogBuf_ += tokenLength + strcspn(*ppcLogBuf_ + tokenLength + 1, unquotedStringDelimiters.data()) + 2;
-                break;
-            default:
-                // Unquoted string: initial tokenLength is the length of the string
-                clCompField_.SetFieldValue<false>(field->index, std::string(*ppcLogBuf_, tokenLength));
-                *ppcLogBuf_ += tokenLength + 1;
-                break;
+                pclCompField_->EmplaceVarField<std::string>(field.index).assign(*ppcLogBuf_ + 1, tokenLength); // + 1 to pass opening double-quote.
             }
+            // The delimiter after the closing '"' decides whether the message ends here, not one inside the string.
+            const char* pcClosingQuote = *ppcLogBuf_ + tokenLength + 1;
+            const size_t uiTrailingLength = clIndex_.TokenLength(pcClosingQuote);
+            bEarlyEndOfMessage_ = (pcClosingQuote[uiTrailingLength] == endDelim);
+            // Skip past the first '"', string token and the remaining characters ('"' and ',').
+            *ppcLogBuf_ = pcClosingQuote + uiTrailingLength + 1;
             break;
-        case FIELD_TYPE::RESPONSE_ID: {
+        }
+        default:
+            // Unquoted string: initial tokenLength is the length of the string
+            if constexpr (!Skip) { pclCompField_->EmplaceVarField<std::string>(field.index).assign(*ppcLogBuf_, tokenLength); }
+            *ppcLogBuf_ += tokenLength + 1;
+            break;
+        }
+        break;
+    case FIELD_TYPE::RESPONSE_ID:
+        if constexpr (!Skip)
+        {
             // Ensure we get the whole response (skip over delimiters in responses)
-            tokenLength = strcspn(*ppcLogBuf_, responseDelimiters.data());
+            tokenLength = clIndex_.RemainingLength(*ppcLogBuf_);
             std::string_view sResponse(*ppcLogBuf_, tokenLength);
-            if (sResponse == "OK") { clCompField_.SetFieldValue<true>(field->index, static_cast<int32_t>(1)); }
+            if (sResponse == "OK") { pclCompField_->SetFieldValue<true>(field.index, static_cast<int32_t>(1)); }
             // Note: This won't match responses with format specifiers in them (%d, %s, etc.), they will be given id=0
-            else { clCompField_.SetFieldValue<true>(field->index, GetResponseId(vMyResponseDefinitions, sResponse.substr(svErrorPrefix.length()))); }
-            // Do not advance buffer, need to reprocess this field for the following RESPONSE_STR.
-            bEarlyEndOfMessage = false;
-            break;
+            else { pclCompField_->SetFieldValue<true>(field.index, GetResponseId(vMyResponseDefinitions, sResponse.substr(svErrorPrefix.length()))); }
         }
-        case FIELD_TYPE::RESPONSE_STR:
-            // Response strings aren't surrounded by double quotes, ensure we get the whole response (skip over certain delimiters in responses)
-            tokenLength = strcspn(*ppcLogBuf_, responseDelimiters.data());
-            clCompField_.SetFieldValue<false>(field->index, std::string(*ppcLogBuf_, tokenLength));
-            *ppcLogBuf_ += tokenLength + 1;
-            break;
-        case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
-        case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
-            bool fixed = (field->type == FIELD_TYPE::FIXED_LENGTH_ARRAY);
-            uint32_t uiArraySize = 0;
-            if (fixed) { uiArraySize = dynamic_cast<const ArrayField*>(field.get())->arrayLength; }
-            else
+        // Do not advance buffer, need to reprocess this field for the following RESPONSE_STR.
+        bEarlyEndOfMessage_ = false;
+        break;
+    case FIELD_TYPE::RESPONSE_STR:
+        // Response strings aren't surrounded by double quotes, ensure we get the whole response (skip over certain delimiters in responses)
+        tokenLength = clIndex_.RemainingLength(*ppcLogBuf_);
+        if constexpr (!Skip) { pclCompField_->EmplaceVarField<std::string>(field.index).assign(*ppcLogBuf_, tokenLength); }
+        *ppcLogBuf_ += tokenLength + 1;
+        break;
+    case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
+    case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
+        bool fixed = (stOp_.type == FIELD_TYPE::FIXED_LENGTH_ARRAY);
+        uint32_t uiArraySize = 0;
+        if (fixed) { uiArraySize = stOp_.arrayLength; }
+        else
+        {
+            auto result = std::from_chars(*ppcLogBuf_, *ppcLogBuf_ + tokenLength + 1, uiArraySize);
+            if (result.ec != std::errc())
             {
-                auto result = std::from_chars(*ppcLogBuf_, *ppcLogBuf_ + tokenLength + 1, uiArraySize);
-                if (result.ec != std::errc())
-                {
-                    SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::VARIABLE_LENGTH_ARRAY: Array length not valid number. Malformed Input\n");
-                    return STATUS::MALFORMED_INPUT;
-                }
-
-                if (uiArraySize > dynamic_cast<const ArrayField*>(field.get())->arrayLength)
-                {
-                    SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::VARIABLE_LENGTH_ARRAY: Array larger than JSON length. Malformed Input\n");
-                    return STATUS::MALFORMED_INPUT;
-                }
-
-                *ppcLogBuf_ += tokenLength + 1;
-                tokenLength = strcspn(*ppcLogBuf_, unquotedStringDelimiters.data());
+                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::VARIABLE_LENGTH_ARRAY: Array length not valid number. Malformed Input\n");
+                return STATUS::MALFORMED_INPUT;
             }
 
-            STATUS eStatus = STATUS::SUCCESS;
-            if (field->conversionHash == CalculateBlockCrc32("Z"))
+            if (uiArraySize > stOp_.arrayLength)
             {
-                assert(field->dataType.name == DATA_TYPE::UCHAR || field->dataType.name == DATA_TYPE::HEXBYTE);
-                std::vector<uint8_t> vDecodedValues;
-                eStatus = DecodeZConversionStringAsciiArray(vDecodedValues, ppcLogBuf_, uiArraySize);
-                if (eStatus == STATUS::SUCCESS)
-                {
-                    if (fixed)
-                    {
-                        if (uiArraySize > 0) { clCompField_.SetFieldValue<true>(field->index, vDecodedValues.data(), uiArraySize); }
-                    }
-                    else { clCompField_.SetFieldValue<false>(field->index, std::move(vDecodedValues)); }
-                }
-                *ppcLogBuf_ += 1;
+                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::VARIABLE_LENGTH_ARRAY: Array larger than JSON length. Malformed Input\n");
+                return STATUS::MALFORMED_INPUT;
             }
-            else if (field->isString)
+
+            *ppcLogBuf_ += tokenLength + 1;
+            tokenLength = clIndex_.TokenLength(*ppcLogBuf_);
+        }
+
+        STATUS eStatus = STATUS::SUCCESS;
+        if (stOp_.zConversion)
+        {
+            assert(field.dataType.name == DATA_TYPE::UCHAR || field.dataType.name == DATA_TYPE::HEXBYTE);
+            if constexpr (Skip) { *ppcLogBuf_ += 2 * static_cast<size_t>(uiArraySize); } // Two hex digits per element
+            else
             {
-                std::string sDecodedValue;
-                eStatus = DecodeStringAsciiArray(sDecodedValue, ppcLogBuf_, uiArraySize);
-                if (eStatus != STATUS::SUCCESS) { return eStatus; }
-                if (fixed) { clCompField_.SetFieldValue<true>(field->index, std::move(sDecodedValue)); }
-                else { clCompField_.SetFieldValue<false>(field->index, std::move(sDecodedValue)); }
-                *ppcLogBuf_ += 1;
+                ArrayElementStore<uint8_t> store(*pclCompField_, field, uiArraySize, fixed);
+                eStatus = DecodeZConversionStringAsciiArray(store, ppcLogBuf_, uiArraySize);
             }
-            else if (!field->isCsv)
+            *ppcLogBuf_ += 1;
+        }
+        else if (field.isString)
+        {
+            if constexpr (Skip) { eStatus = DecodeStringAsciiArray([](uint32_t, char) {}, ppcLogBuf_, uiArraySize); }
+            else
             {
-                eStatus = field->dataType.name == DATA_TYPE::CHAR
-                              ? DecodeNonCommaSeparatedAsciiArray<int8_t>(clCompField_, ppcLogBuf_, field, uiArraySize, fixed)
-                              : DecodeNonCommaSeparatedAsciiArray<uint8_t>(clCompField_, ppcLogBuf_, field, uiArraySize, fixed);
-                if (eStatus != STATUS::SUCCESS) { return eStatus; }
-                *ppcLogBuf_ += 1;
+                ArrayElementStore<char, std::string> store(*pclCompField_, field, uiArraySize, fixed);
+                eStatus = DecodeStringAsciiArray(store, ppcLogBuf_, uiArraySize);
             }
+            if (eStatus != STATUS::SUCCESS) { return eStatus; }
+            *ppcLogBuf_ += 1;
+        }
+        else if (!field.isCsv)
+        {
+            if constexpr (Skip) { eStatus = SkipNonCommaSeparatedAsciiArray(ppcLogBuf_, uiArraySize); }
             else
+            {
+                eStatus = field.dataType.name == DATA_TYPE::CHAR
+                              ? DecodeNonCommaSeparatedAsciiArray<int8_t>(*pclCompField_, ppcLogBuf_, field, uiArraySize, fixed)
+                              : DecodeNonCommaSeparatedAsciiArray<uint8_t>(*pclCompField_, ppcLogBuf_, field, uiArraySize, fixed);
+            }
+            if (eStatus != STATUS::SUCCESS) { return eStatus; }
+            *ppcLogBuf_ += 1;
+        }
+        else
+        {
+            if constexpr (!Skip)
             {
                 if (!fixed)
                 {
-                    SimpleTypeVisitor(*field, [&](auto&& arg) {
+                    SimpleTypeVisitor(field, [&](auto&& arg) {
                         using T = std::decay_t<decltype(arg)>;
                         using StoredType = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
-                        clCompField_.SetFieldValue<false>(field->index, std::vector<StoredType>(uiArraySize));
+                        pclCompField_->EmplaceVarField<std::vector<StoredType>>(field.index).resize(uiArraySize);
                     });
                 }
-                for (uint32_t i = 0; i < uiArraySize; ++i)
-                {
-                    tokenLength = strcspn(*ppcLogBuf_, unquotedStringDelimiters.data());
-                    DecodeAsciiField(*field, ppcLogBuf_, tokenLength, clCompField_, i, fixed);
-                    *ppcLogBuf_ += tokenLength + 1;
-                }
             }
-            if (eStatus != STATUS::SUCCESS)
+            for (uint32_t i = 0; i < uiArraySize; ++i)
             {
-                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::ARRAY: Malformed Input\n");
-                return eStatus;
+                tokenLength = clIndex_.TokenLength(*ppcLogBuf_);
+                if constexpr (!Skip) { DecodeAsciiField(stOp_, ppcLogBuf_, tokenLength, *pclCompField_, i, fixed); }
+                *ppcLogBuf_ += tokenLength + 1;
             }
+        }
+        if (eStatus != STATUS::SUCCESS)
+        {
+            SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::ARRAY: Malformed Input\n");
+            return eStatus;
+        }
 
-            break;
+        break;
+    }
+    case FIELD_TYPE::FIELD_ARRAY: {
+        uint32_t uiArraySize;
+        auto result = std::from_chars(*ppcLogBuf_, *ppcLogBuf_ + tokenLength + 1, uiArraySize);
+        if (result.ec != std::errc())
+        {
+            SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::FIELD_ARRAY: Field Array length not valid number. Malformed Input\n");
+            return STATUS::MALFORMED_INPUT;
         }
-        case FIELD_TYPE::FIELD_ARRAY: {
-            uint32_t uiArraySize;
-            auto result = std::from_chars(*ppcLogBuf_, *ppcLogBuf_ + tokenLength + 1, uiArraySize);
-            if (result.ec != std::errc())
-            {
-                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::FIELD_ARRAY: Field Array length not valid number. Malformed Input\n");
-                return STATUS::MALFORMED_INPUT;
-            }
 
-            *ppcLogBuf_ = result.ptr;
+        *ppcLogBuf_ = result.ptr;
 
-            ++*ppcLogBuf_;
-            auto fieldArrayDef = std::dynamic_pointer_cast<const FieldArrayField>(field);
-            if (!fieldArrayDef)
-            {
-                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::FIELD_ARRAY: Definition cast failed");
-                return STATUS::MALFORMED_INPUT;
-            }
-            const auto* subFieldDefinitions = fieldArrayDef.get();
+        ++*ppcLogBuf_;
+        const FieldArrayField* subFieldDefinitions = stOp_.fieldArrayField;
+        if (subFieldDefinitions == nullptr)
+        {
+            SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::FIELD_ARRAY: Definition cast failed");
+            return STATUS::MALFORMED_INPUT;
+        }
 
-            if (uiArraySize > subFieldDefinitions->arrayLength)
+        if (uiArraySize > subFieldDefinitions->arrayLength)
+        {
+            SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::FIELD_ARRAY: Array size too large. Malformed Input\n");
+            return STATUS::MALFORMED_INPUT;
+        }
+
+        if constexpr (Skip)
+        {
+            for (uint32_t i = 0; i < uiArraySize; ++i)
             {
-                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii()::FIELD_ARRAY: Array size too large. Malformed Input\n");
-                return STATUS::MALFORMED_INPUT;
+                STATUS eStatus = DecodeAsciiOps<Abbreviated, true>(*stOp_.subPlan, ppcLogBuf_, nullptr, pcBufEnd_, clIndex_);
+                if (eStatus != STATUS::SUCCESS) { return eStatus; }
             }
-
-            std::vector<CompositeField> pvFieldArrayContainer(uiArraySize);
+        }
+        else
+        {
+            auto& pvFieldArrayContainer = pclCompField_->EmplaceVarField<CompositeFieldArray>(field.index);
+            pvFieldArrayContainer.reserve(uiArraySize);
 
             for (uint32_t i = 0; i < uiArraySize; ++i)
             {
-                pvFieldArrayContainer[i] =
-                    CompositeField(subFieldDefinitions->fieldInfo->fixedFieldBytes, subFieldDefinitions->fieldInfo->varFieldCount);
-                pvFieldArrayContainer[i].SetFieldInfo(subFieldDefinitions->fieldInfo);
-                STATUS eStatus = DecodeAscii<Abbreviated>(*subFieldDefinitions->fieldInfo, ppcLogBuf_, pvFieldArrayContainer[i], pcBufEnd_);
+                CompositeField& clRecord = pclCompField_->EmplaceRecord(pvFieldArrayContainer, subFieldDefinitions->fieldInfo);
+                STATUS eStatus = DecodeAsciiOps<Abbreviated, false>(*stOp_.subPlan, ppcLogBuf_, &clRecord, pcBufEnd_, clIndex_);
                 if (eStatus != STATUS::SUCCESS) { return eStatus; }
             }
-            clCompField_.SetFieldValue(*field, std::move(pvFieldArrayContainer));
-            break;
         }
-        default:
-            SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii(): Unknown field type");
-            throw std::runtime_error("DecodeAscii(): Unknown field type");
+        break;
+    }
+    default:
+        SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeAscii(): Unknown field type");
+        throw std::runtime_error("DecodeAscii(): Unknown field type");
+    }
+
+    return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+template <bool Abbreviated, bool Skip>
+STATUS MessageDecoderBase::DecodeAsciiOps(const DecodePlan& stPlan_, const char** ppcLogBuf_, CompositeField* pclCompField_, const char* pcBufEnd_,
+                                          const DelimiterIndex& clIndex_, std::vector<const char*>* pvFieldStarts_) const
+{
+    for (const DecodeOp& stOp : stPlan_.ops)
+    {
+        if (pvFieldStarts_ != nullptr) { pvFieldStarts_->push_back(*ppcLogBuf_); }
+
+        bool bEarlyEndOfMessage = false;
+        if (!Skip && stOp.skip)
+        {
+            STATUS eStatus = DecodeAsciiOp<Abbreviated, true>(stOp, ppcLogBuf_, nullptr, pcBufEnd_, clIndex_, bEarlyEndOfMessage);
+            if (eStatus != STATUS::SUCCESS) { return eStatus; }
+            EmplaceAbsentField(stOp, *pclCompField_);
+        }
+        else
+        {
+            STATUS eStatus = DecodeAsciiOp<Abbreviated, Skip>(stOp, ppcLogBuf_, pclCompField_, pcBufEnd_, clIndex_, bEarlyEndOfMessage);
+            if (eStatus != STATUS::SUCCESS) { return eStatus; }
         }
 
         if constexpr (!Abbreviated)
@@ -692,198 +1057,235 @@ STATUS MessageDecoderBase::DecodeAscii(const FieldInfo& vMsgDefFields_, const ch
     return STATUS::SUCCESS;
 }
 
+// -------------------------------------------------------------------------------------------------------
+namespace {
+
+//! Lends out the delimiter index of the calling thread, empty, so that its bitmaps are neither placed on the stack
+//! of every decode nor allocated again for each message. A decode nested in another on the same thread, e.g. from a
+//! field converter, gets an index of its own.
+class DelimiterIndexLease
+{
+  public:
+    explicit DelimiterIndexLease(const bool bAbbreviated_)
+    {
+        thread_local DelimiterIndex clThreadIndex(',', '*');
+        thread_local DelimiterIndex clThreadAbbreviatedIndex(' ', '\r');
+        // Each index is lent out on its own, so an ASCII decode nested in an abbreviated one still gets the thread's index
+        thread_local bool bThreadIndexLent = false;
+        thread_local bool bThreadAbbreviatedIndexLent = false;
+
+        bool& bLent = bAbbreviated_ ? bThreadAbbreviatedIndexLent : bThreadIndexLent;
+        if (bLent)
+        {
+            pclMyIndex = &clMyNestedIndex.emplace(bAbbreviated_ ? ' ' : ',', bAbbreviated_ ? '\r' : '*');
+            return;
+        }
+        pclMyIndex = bAbbreviated_ ? &clThreadAbbreviatedIndex : &clThreadIndex;
+        pclMyIndex->Clear();
+        pbMyLent = &bLent;
+        *pbMyLent = true;
+    }
+
+    ~DelimiterIndexLease()
+    {
+        if (pbMyLent != nullptr) { *pbMyLent = false; }
+    }
+
+    DelimiterIndexLease(const DelimiterIndexLease&) = delete;
+    DelimiterIndexLease& operator=(const DelimiterIndexLease&) = delete;
+
+    [[nodiscard]] DelimiterIndex& Get() const { return *pclMyIndex; }
+
+  private:
+    DelimiterIndex* pclMyIndex{nullptr};
+    bool* pbMyLent{nullptr};
+    std::optional<DelimiterIndex> clMyNestedIndex;
+};
+
+} // namespace
+
+// -------------------------------------------------------------------------------------------------------
+template <bool Abbreviated>
+STATUS MessageDecoderBase::DecodeAscii(const DecodePlan& stPlan_, const char** ppcLogBuf_, CompositeField& clCompField_,
+                                       const char* pcBufEnd_) const
+{
+    if (pcBufEnd_ == nullptr) { pcBufEnd_ = static_cast<const char*>(std::memchr(*ppcLogBuf_, '\0', MAX_ASCII_MESSAGE_LENGTH)); }
+
+    // Index the delimiters of the whole body up front so each token is measured with a bitmap lookup
+    const DelimiterIndexLease clIndexLease(Abbreviated);
+    DelimiterIndex& clIndex = clIndexLease.Get();
+    if (pcBufEnd_ != nullptr) { clIndex.Build(*ppcLogBuf_, static_cast<size_t>(pcBufEnd_ - *ppcLogBuf_)); }
+
+    return DecodeAsciiOps<Abbreviated, false>(stPlan_, ppcLogBuf_, &clCompField_, pcBufEnd_, clIndex);
+}
+
 // explicit template instantiations
-template STATUS MessageDecoderBase::DecodeAscii<true>(const FieldInfo&, const char**, CompositeField&, const char*) const;
-template STATUS MessageDecoderBase::DecodeAscii<false>(const FieldInfo&, const char**, CompositeField&, const char*) const;
+template STATUS MessageDecoderBase::DecodeAscii<true>(const DecodePlan&, const char**, CompositeField&, const char*) const;
+template STATUS MessageDecoderBase::DecodeAscii<false>(const DecodePlan&, const char**, CompositeField&, const char*) const;
 
 // -------------------------------------------------------------------------------------------------------
-STATUS MessageDecoderBase::DecodeJson(const FieldInfo& vMsgDefFields_, simdjson::dom::element jsonData, CompositeField& clCompField_) const
+STATUS MessageDecoderBase::DecodeJsonOp(const DecodeOp& stOp_, simdjson::dom::element jsonData, CompositeField& clCompField_) const
 {
-    for (const auto& field : vMsgDefFields_.messageOrderedFields)
+    const BaseField& field = *stOp_.field;
+
+    simdjson::dom::element clField;
+    if (jsonData[field.name].get(clField) != simdjson::SUCCESS)
+    {
+        SPDLOG_LOGGER_WARN(pclMyLogger, "Field '{}' not found in JSON", field.name);
+        return STATUS::SUCCESS;
+    }
+
+    switch (stOp_.type)
     {
-        simdjson::dom::element clField;
-        if (jsonData[field->name].get(clField) != simdjson::SUCCESS)
+    case FIELD_TYPE::SIMPLE:
+        try
         {
-            SPDLOG_LOGGER_WARN(pclMyLogger, "Field '{}' not found in JSON", field->name);
-            continue;
+            DecodeJsonField(stOp_, clField, clCompField_);
+        }
+        catch (const std::runtime_error&)
+        {
+            SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeJsonField(): Exception when decoding field. Malformed Input\n");
+            return STATUS::MALFORMED_INPUT;
         }
+        break;
 
-        switch (field->type)
+    case FIELD_TYPE::ENUM: {
+        std::string_view enumValue;
+        if (clField.get(enumValue) == simdjson::SUCCESS)
         {
-        case FIELD_TYPE::SIMPLE:
-            try
-            {
-                DecodeJsonField(*field, clField, clCompField_);
-            }
-            catch (const std::runtime_error&)
-            {
-                SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeJsonField(): Exception when decoding field. Malformed Input\n");
-                return STATUS::MALFORMED_INPUT;
-            }
-            break;
+            const int32_t parsedEnumValue = GetEnumValue(stOp_.enumField->enumDef, enumValue);
 
-        case FIELD_TYPE::ENUM: {
-            std::string_view enumValue;
-            if (clField.get(enumValue) == simdjson::SUCCESS)
+            switch (stOp_.typeLength)
             {
-                const auto* enumField = dynamic_cast<const EnumField*>(field.get());
-                const int32_t parsedEnumValue = GetEnumValue(enumField->enumDef, enumValue);
-
-                switch (enumField->dataType.length)
-                {
-                case 1: clCompField_.SetFieldValue<true>(field->index, static_cast<int8_t>(parsedEnumValue)); break;
-                case 2: clCompField_.SetFieldValue<true>(field->index, static_cast<int16_t>(parsedEnumValue)); break;
-                default: clCompField_.SetFieldValue<true>(field->index, parsedEnumValue); break;
-                }
+            case 1: clCompField_.SetFieldValue<true>(field.index, static_cast<int8_t>(parsedEnumValue)); break;
+            case 2: clCompField_.SetFieldValue<true>(field.index, static_cast<int16_t>(parsedEnumValue)); break;
+            default: clCompField_.SetFieldValue<true>(field.index, parsedEnumValue); break;
             }
-            break;
         }
+        break;
+    }
 
-        case FIELD_TYPE::STRING: [[fallthrough]];
-        case FIELD_TYPE::RESPONSE_STR: {
-            std::string_view strValue;
-            if (clField.get(strValue) == simdjson::SUCCESS) { clCompField_.SetFieldValue<false>(field->index, std::string(strValue)); }
-            break;
-        }
+    case FIELD_TYPE::STRING: [[fallthrough]];
+    case FIELD_TYPE::RESPONSE_STR: {
+        std::string_view strValue;
+        if (clField.get(strValue) == simdjson::SUCCESS) { clCompField_.EmplaceVarField<std::string>(field.index).assign(strValue); }
+        break;
+    }
 
-        case FIELD_TYPE::RESPONSE_ID: {
-            std::string_view sResponse;
-            if (clField.get(sResponse) == simdjson::SUCCESS)
+    case FIELD_TYPE::RESPONSE_ID: {
+        std::string_view sResponse;
+        if (clField.get(sResponse) == simdjson::SUCCESS)
+        {
+            if (sResponse == "OK") { clCompField_.SetFieldValue<true>(field.index, 1); }
+            else
             {
-                if (sResponse == "OK") { clCompField_.SetFieldValue<true>(field->index, 1); }
-                else
-                {
-                    clCompField_.SetFieldValue<true>(field->index, GetResponseId(vMyResponseDefinitions, sResponse.substr(svErrorPrefix.length())));
-                }
+                clCompField_.SetFieldValue<true>(field.index, GetResponseId(vMyResponseDefinitions, sResponse.substr(svErrorPrefix.length())));
             }
-            break;
         }
+        break;
+    }
 
-        case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
-        case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
-            const bool fixed = (field->type == FIELD_TYPE::FIXED_LENGTH_ARRAY);
-            const auto* arrayField = dynamic_cast<const ArrayField*>(field.get());
-            const uint32_t uiArraySize = (fixed && arrayField != nullptr) ? arrayField->arrayLength : 0;
+    case FIELD_TYPE::FIXED_LENGTH_ARRAY: [[fallthrough]];
+    case FIELD_TYPE::VARIABLE_LENGTH_ARRAY: {
+        const bool fixed = (stOp_.type == FIELD_TYPE::FIXED_LENGTH_ARRAY);
+        const uint32_t uiArraySize = fixed ? stOp_.arrayLength : 0;
 
-            if (field->isString)
+        if (field.isString)
+        {
+            std::string_view strValue;
+            if (clField.get(strValue) == simdjson::SUCCESS)
             {
-                std::string_view strValue;
-                if (clField.get(strValue) == simdjson::SUCCESS)
+                if (fixed)
                 {
-                    if (fixed)
-                    {
-                        if (strValue.size() > uiArraySize) { return STATUS::MALFORMED_INPUT; }
-                        std::vector<uint8_t> vDecodedValues(uiArraySize, 0);
-                        for (size_t i = 0; i < strValue.size(); ++i) { vDecodedValues[i] = static_cast<uint8_t>(strValue[i]); }
-                        if (!vDecodedValues.empty()) { clCompField_.SetFieldValue<true>(field->index, vDecodedValues.data(), vDecodedValues.size()); }
-                    }
-                    else { clCompField_.SetFieldValue<false>(field->index, std::string(strValue)); }
+                    if (strValue.size() > uiArraySize) { return STATUS::MALFORMED_INPUT; }
+                    ArrayElementStore<uint8_t> store(clCompField_, field, uiArraySize, fixed);
+                    for (uint32_t i = 0; i < uiArraySize; ++i) { store(i, i < strValue.size() ? static_cast<uint8_t>(strValue[i]) : 0); }
                 }
+                else { clCompField_.EmplaceVarField<std::string>(field.index).assign(strValue); }
             }
-            else
+        }
+        else
+        {
+            simdjson::dom::array array;
+            if (clField.get(array) == simdjson::SUCCESS)
             {
-                simdjson::dom::array array;
-                if (clField.get(array) == simdjson::SUCCESS)
+                if (stOp_.zConversion)
                 {
-                    if (field->conversionHash == CalculateBlockCrc32("Z"))
+                    if (fixed && array.size() > uiArraySize) { return STATUS::MALFORMED_INPUT; }
+                    const uint32_t uiStoredSize = fixed ? uiArraySize : static_cast<uint32_t>(array.size());
+                    ArrayElementStore<uint8_t> store(clCompField_, field, uiStoredSize, fixed);
+                    uint32_t i = 0;
+                    for (simdjson::dom::element it : array)
                     {
-                        if (fixed)
-                        {
-                            if (array.size() > uiArraySize) { return STATUS::MALFORMED_INPUT; }
-                            std::vector<uint8_t> vDecodedValues(uiArraySize, 0);
-                            size_t i = 0;
-                            for (simdjson::dom::element it : array)
-                            {
-                                uint64_t value;
-                                if (it.get(value) != simdjson::SUCCESS) { return STATUS::MALFORMED_INPUT; }
-                                vDecodedValues[i++] = static_cast<uint8_t>(value);
-                            }
-                            if (!vDecodedValues.empty())
-                            {
-                                clCompField_.SetFieldValue<true>(field->index, vDecodedValues.data(), vDecodedValues.size());
-                            }
-                        }
-                        else
-                        {
-                            std::vector<uint8_t> vDecodedValues;
-                            vDecodedValues.reserve(array.size());
-                            for (simdjson::dom::element it : array)
-                            {
-                                uint64_t value;
-                                if (it.get(value) != simdjson::SUCCESS) { return STATUS::MALFORMED_INPUT; }
-                                vDecodedValues.emplace_back(static_cast<uint8_t>(value));
-                            }
-                            clCompField_.SetFieldValue<false>(field->index, std::move(vDecodedValues));
-                        }
+                        uint64_t value;
+                        if (it.get(value) != simdjson::SUCCESS) { return STATUS::MALFORMED_INPUT; }
+                        store(i++, static_cast<uint8_t>(value));
                     }
-                    else if (field->conversionHash == CalculateBlockCrc32("P"))
+                    for (; i < uiStoredSize; ++i) { store(i, 0); }
+                }
+                else if (stOp_.pConversion)
+                {
+                    if (fixed && array.size() > uiArraySize) { return STATUS::MALFORMED_INPUT; }
+                    const uint32_t uiStoredSize = fixed ? uiArraySize : static_cast<uint32_t>(array.size());
+                    ArrayElementStore<int8_t> store(clCompField_, field, uiStoredSize, fixed);
+                    uint32_t i = 0;
+                    for (simdjson::dom::element it : array)
                     {
-                        if (fixed)
-                        {
-                            if (array.size() > uiArraySize) { return STATUS::MALFORMED_INPUT; }
-                            std::vector<int8_t> vDecodedValues(uiArraySize, 0);
-                            size_t i = 0;
-                            for (simdjson::dom::element it : array)
-                            {
-                                int64_t value;
-                                if (it.get(value) != simdjson::SUCCESS) { return STATUS::MALFORMED_INPUT; }
-                                vDecodedValues[i++] = static_cast<int8_t>(value);
-                            }
-                            if (!vDecodedValues.empty())
-                            {
-                                clCompField_.SetFieldValue<true>(field->index, vDecodedValues.data(), vDecodedValues.size());
-                            }
-                        }
-                        else
-                        {
-                            std::vector<int8_t> vDecodedValues;
-                            vDecodedValues.reserve(array.size());
-                            for (simdjson::dom::element it : array)
-                            {
-                                int64_t value;
-                                if (it.get(value) != simdjson::SUCCESS) { return STATUS::MALFORMED_INPUT; }
-                                vDecodedValues.emplace_back(static_cast<int8_t>(value));
-                            }
-                            clCompField_.SetFieldValue<false>(field->index, std::move(vDecodedValues));
-                        }
+                        int64_t value;
+                        if (it.get(value) != simdjson::SUCCESS) { return STATUS::MALFORMED_INPUT; }
+                        store(i++, static_cast<int8_t>(value));
                     }
-                    else { return STATUS::MALFORMED_INPUT; }
+                    for (; i < uiStoredSize; ++i) { store(i, 0); }
                 }
+                else { return STATUS::MALFORMED_INPUT; }
             }
-            break;
         }
+        break;
+    }
 
-        case FIELD_TYPE::FIELD_ARRAY: {
-            simdjson::dom::array array;
-            auto error = clField.get(array);
-            if (error) { return STATUS::MALFORMED_INPUT; }
-
-            auto fieldArrayDef = std::dynamic_pointer_cast<const FieldArrayField>(field);
-            if (!fieldArrayDef) { return STATUS::MALFORMED_INPUT; }
-            const auto* subFieldDefinitions = fieldArrayDef.get();
+    case FIELD_TYPE::FIELD_ARRAY: {
+        simdjson::dom::array array;
+        auto error = clField.get(array);
+        if (error) { return STATUS::MALFORMED_INPUT; }
 
-            std::vector<CompositeField> vFieldArrayContainer;
-            vFieldArrayContainer.reserve(array.size());
+        const FieldArrayField* subFieldDefinitions = stOp_.fieldArrayField;
+        if (subFieldDefinitions == nullptr) { return STATUS::MALFORMED_INPUT; }
 
-            for (simdjson::dom::element element : array)
-            {
-                vFieldArrayContainer.emplace_back(subFieldDefinitions->fieldInfo->fixedFieldBytes, subFieldDefinitions->fieldInfo->varFieldCount);
-                auto& stSubMessageBody = vFieldArrayContainer.back();
-                stSubMessageBody.SetFieldInfo(subFieldDefinitions->fieldInfo);
+        auto& vFieldArrayContainer = clCompField_.EmplaceVarField<CompositeFieldArray>(field.index);
+        vFieldArrayContainer.reserve(array.size());
 
-                // Recursively decode the subfields
-                STATUS eStatus = DecodeJson(*subFieldDefinitions->fieldInfo, element, stSubMessageBody);
-                if (eStatus != STATUS::SUCCESS) { return eStatus; }
-            }
+        for (simdjson::dom::element element : array)
+        {
+            auto& stSubMessageBody = clCompField_.EmplaceRecord(vFieldArrayContainer, subFieldDefinitions->fieldInfo);
 
-            clCompField_.SetFieldValue(*field, std::move(vFieldArrayContainer));
-            break;
+            // Recursively decode the subfields
+            STATUS eStatus = DecodeJson(*stOp_.subPlan, element, stSubMessageBody);
+            if (eStatus != STATUS::SUCCESS) { return eStatus; }
         }
+        break;
+    }
 
-        default:
-            SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeJson(): Unknown field type '{}'", field->name);
-            throw std::runtime_error("DecodeJson(): Unknown field type");
+    default:
+        SPDLOG_LOGGER_CRITICAL(pclMyLogger, "DecodeJson(): Unknown field type '{}'", field.name);
+        throw std::runtime_error("DecodeJson(): Unknown field type");
+    }
+
+    return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS MessageDecoderBase::DecodeJson(const DecodePlan& stPlan_, simdjson::dom::element jsonData, CompositeField& clCompField_) const
+{
+    for (const DecodeOp& stOp : stPlan_.ops)
+    {
+        if (stOp.skip)
+        {
+            EmplaceAbsentField(stOp, clCompField_);
+            continue;
         }
+
+        STATUS eStatus = DecodeJsonOp(stOp, jsonData, clCompField_);
+        if (eStatus != STATUS::SUCCESS) { return eStatus; }
     }
 
     return STATUS::SUCCESS;
@@ -899,14 +1301,12 @@ void MessageDecoderBase::DecodeJsonField(const BaseField& field_, simdjson::dom:
 }
 
 // -------------------------------------------------------------------------------------------------------
-STATUS
-MessageDecoderBase::Decode(const unsigned char* pucMessage_, CompositeField& stInterMessage_, MetaDataBase& stMetaData_) const
+STATUS MessageDecoderBase::FindMessageDefinition(const unsigned char* pucMessage_, MetaDataBase& stMetaData_,
+                                                 MessageDefinition::ConstPtr& pclMsgDef_) const
 {
     if (pucMessage_ == nullptr) { return STATUS::NULL_PROVIDED; }
     if (pclMyMsgDb == nullptr) { return STATUS::NO_DATABASE; }
 
-    const unsigned char* pucTempInData = pucMessage_;
-
     if (stMetaData_.bResponse && (stMetaData_.eFormat != HEADER_FORMAT::BINARY && stMetaData_.eFormat != HEADER_FORMAT::SHORT_BINARY &&
                                   stMetaData_.eFormat != HEADER_FORMAT::ASCII && stMetaData_.eFormat != HEADER_FORMAT::SHORT_ASCII &&
                                   stMetaData_.eFormat != HEADER_FORMAT::ABB_ASCII && stMetaData_.eFormat != HEADER_FORMAT::SHORT_ABB_ASCII))
@@ -914,9 +1314,9 @@ MessageDecoderBase::Decode(const unsigned char* pucMessage_, CompositeField& stI
         return STATUS::NO_DEFINITION;
     }
 
-    MessageDefinition::ConstPtr pclMsgDef = GetMessageDefinition(stMetaData_);
+    pclMsgDef_ = GetMessageDefinition(stMetaData_);
 
-    if (pclMsgDef == nullptr)
+    if (pclMsgDef_ == nullptr)
     {
         LogMissingMsgDef(*pclMyLogger, stMetaData_.usMessageId);
         return STATUS::NO_DEFINITION;
@@ -927,11 +1327,37 @@ MessageDecoderBase::Decode(const unsigned char* pucMessage_, CompositeField& stI
         SPDLOG_LOGGER_INFO(pclMyLogger, "RXCONFIG payload must be decoded via RxConfigHandler, not MessageDecoder.");
         return STATUS::UNSUPPORTED;
     }
+
+    return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS
+MessageDecoderBase::Decode(const unsigned char* pucMessage_, CompositeField& stInterMessage_, MetaDataBase& stMetaData_) const
+{
+    MessageDefinition::ConstPtr pclMsgDef;
+    const STATUS eDefStatus = FindMessageDefinition(pucMessage_, stMetaData_, pclMsgDef);
+    if (eDefStatus != STATUS::SUCCESS) { return eDefStatus; }
+
+    const unsigned char* pucTempInData = pucMessage_;
+
     const uint32_t uiMessageCrc = stMetaData_.bResponse ? 0 : stMetaData_.uiMessageCrc;
     const FieldInfo& msgFieldInfo = pclMsgDef->GetMsgDefFromCrc(uiMessageCrc);
+    // A field info that is not bound, e.g. of a message added to the database since, is bound on first use
+    BoundPlan stLateBoundPlan;
+    const BoundPlan* pstBoundPlan = FindBoundPlan(msgFieldInfo);
+    if (pstBoundPlan == nullptr)
+    {
+        stLateBoundPlan = GetLateBoundPlan(msgFieldInfo);
+        pstBoundPlan = &stLateBoundPlan;
+    }
+    const bool bProjected = pstBoundPlan->projectedPlan != nullptr;
+    const DecodePlan& stPlan = bProjected ? *pstBoundPlan->projectedPlan : *pstBoundPlan->plan;
 
+    stInterMessage_.Reset();
     stInterMessage_.resize(msgFieldInfo.fixedFieldBytes, msgFieldInfo.varFieldCount);
     stInterMessage_.SetFieldInfo(pclMsgDef, uiMessageCrc);
+    if (bProjected) { stInterMessage_.SetProjection(pstBoundPlan->projectedPlan); }
 
     // Decode the detected format
     switch (stMetaData_.eFormat)
@@ -939,14 +1365,14 @@ MessageDecoderBase::Decode(const unsigned char* pucMessage_, CompositeField& stI
     case HEADER_FORMAT::ASCII: [[fallthrough]];
     case HEADER_FORMAT::SHORT_ASCII: {
         const auto* pcTempInData = reinterpret_cast<const char*>(pucTempInData);
-        return DecodeAscii<false>(msgFieldInfo, &pcTempInData, stInterMessage_,
+        return DecodeAscii<false>(stPlan, &pcTempInData, stInterMessage_,
                                   stMetaData_.uiLength > stMetaData_.uiHeaderLength ? pcTempInData + stMetaData_.uiLength - stMetaData_.uiHeaderLength
                                                                                     : nullptr);
     }
     case HEADER_FORMAT::ABB_ASCII: [[fallthrough]];
     case HEADER_FORMAT::SHORT_ABB_ASCII: {
         const auto* pcTempInData = reinterpret_cast<const char*>(pucTempInData);
-        return DecodeAscii<true>(msgFieldInfo, &pcTempInData, stInterMessage_,
+        return DecodeAscii<true>(stPlan, &pcTempInData, stInterMessage_,
                                  stMetaData_.uiLength > stMetaData_.uiHeaderLength ? pcTempInData + stMetaData_.uiLength - stMetaData_.uiHeaderLength
                                                                                    : nullptr);
     }
@@ -954,19 +1380,24 @@ MessageDecoderBase::Decode(const unsigned char* pucMessage_, CompositeField& stI
     case HEADER_FORMAT::SHORT_BINARY:
         if (msgFieldInfo.varFieldCount == 0)
         {
-            // Fast path: if there are no variable-length fields, copy the entire message to the fixed region
-            stInterMessage_.SetFieldValue<true>(0, reinterpret_cast<const std::byte*>(pucTempInData), msgFieldInfo.fixedFieldBytes);
+            // Fast path: if there are no variable-length fields, the message is the fixed region
+            const auto* pucFixedFields = reinterpret_cast<const std::byte*>(pucTempInData);
+            if (bMyViewDecoding) { stInterMessage_.BorrowFixedFields(pucFixedFields, msgFieldInfo.fixedFieldBytes); }
+            else { stInterMessage_.SetFieldValue<true>(0, pucFixedFields, msgFieldInfo.fixedFieldBytes); }
             return STATUS::SUCCESS;
         }
-        return DecodeBinary(msgFieldInfo, &pucTempInData, stInterMessage_, stMetaData_.uiBinaryMsgLength);
+        return DecodeBinary(stPlan, &pucTempInData, stInterMessage_, stMetaData_.uiBinaryMsgLength);
     case HEADER_FORMAT::JSON: {
-        simdjson::dom::parser parser;
         simdjson::dom::element clJsonFields;
 
         std::string_view jsonStringView(reinterpret_cast<const char*>(pucTempInData)); // Assumes null-terminated data
 
-        auto error = parser.parse(jsonStringView).get(clJsonFields);
-        if (error)
+        // Without a parser set, parse with one of our own so that concurrent decodes don't share a document
+        JsonMessageParser clLocalParser;
+        JsonMessageParser& clJsonParser = pclMyJsonParser != nullptr ? *pclMyJsonParser : clLocalParser;
+
+        // Reuse the document parsed by the header decoder when it shares this decoder's parser
+        if (!clJsonParser.TakeShared(jsonStringView, clJsonFields) && clJsonParser.Parse(jsonStringView, clJsonFields) != simdjson::SUCCESS)
         {
             SPDLOG_LOGGER_ERROR(pclMyLogger, "JSON parsing error:"); // TODO: {}", error.message());
             return STATUS::MALFORMED_INPUT;
@@ -979,9 +1410,169 @@ MessageDecoderBase::Decode(const unsigned char* pucMessage_, CompositeField& stI
             return STATUS::MALFORMED_INPUT;
         }
 
-        return DecodeJson(msgFieldInfo, body, stInterMessage_);
+        return DecodeJson(stPlan, body, stInterMessage_);
     }
     default: //
         return STATUS::UNKNOWN;
     }
 }
+
+// -------------------------------------------------------------------------------------------------------
+STATUS MessageDecoderBase::DecodeLazy(const unsigned char* pucMessage_, LazyCompositeField& stMessage_, MetaDataBase& stMetaData_) const
+{
+    CompositeField& clFields = stMessage_.clMyFields;
+    stMessage_.pclMyDecoder = this;
+    stMessage_.pclMyPlan = nullptr;
+    stMessage_.eMyFormat = stMetaData_.eFormat;
+    stMessage_.vMyFieldStarts.clear();
+    stMessage_.vMyDecoded.clear();
+
+    const bool bAbbreviated = stMetaData_.eFormat == HEADER_FORMAT::ABB_ASCII || stMetaData_.eFormat == HEADER_FORMAT::SHORT_ABB_ASCII;
+    const bool bAscii = bAbbreviated || stMetaData_.eFormat == HEADER_FORMAT::ASCII || stMetaData_.eFormat == HEADER_FORMAT::SHORT_ASCII;
+
+    // Binary fields need no conversion, so binary bodies are decoded in full
+    if (!bAscii && stMetaData_.eFormat != HEADER_FORMAT::JSON)
+    {
+        const STATUS eStatus = Decode(pucMessage_, clFields, stMetaData_);
+        if (eStatus != STATUS::SUCCESS) { return eStatus; }
+        stMessage_.pclMyPlan = GetBoundPlan(*clFields.GetFieldInfo());
+        stMessage_.vMyDecoded.assign(stMessage_.pclMyPlan->ops.size(), 1);
+        return STATUS::SUCCESS;
+    }
+
+    MessageDefinition::ConstPtr pclMsgDef;
+    const STATUS eDefStatus = FindMessageDefinition(pucMessage_, stMetaData_, pclMsgDef);
+    if (eDefStatus != STATUS::SUCCESS) { return eDefStatus; }
+
+    const uint32_t uiMessageCrc = stMetaData_.bResponse ? 0 : stMetaData_.uiMessageCrc;
+    const FieldInfo& msgFieldInfo = pclMsgDef->GetMsgDefFromCrc(uiMessageCrc);
+    stMessage_.pclMyPlan = GetBoundPlan(msgFieldInfo);
+    const DecodePlan& stPlan = *stMessage_.pclMyPlan;
+
+    clFields.Reset();
+    clFields.resize(msgFieldInfo.fixedFieldBytes, msgFieldInfo.varFieldCount);
+    clFields.SetFieldInfo(pclMsgDef, uiMessageCrc);
+    stMessage_.vMyDecoded.assign(stPlan.ops.size(), 0);
+
+    if (!bAscii)
+    {
+        simdjson::dom::element clJsonFields;
+        std::string_view jsonStringView(reinterpret_cast<const char*>(pucMessage_)); // Assumes null-terminated data
+
+        // The body is converted after this call, so its document must be kept by the message. Without a parser set,
+        // the message keeps a parser of its own, which is reused unless a copy of the message still refers to it.
+        if (pclMyJsonParser != nullptr) { stMessage_.pclMyJsonParser = pclMyJsonParser; }
+        else if (stMessage_.pclMyJsonParser == nullptr || stMessage_.pclMyJsonParser.use_count() != 1)
+        {
+            stMessage_.pclMyJsonParser = std::make_shared<JsonMessageParser>();
+        }
+
+        JsonMessageParser& clJsonParser = *stMessage_.pclMyJsonParser;
+        if (!clJsonParser.TakeShared(jsonStringView, clJsonFields) && clJsonParser.Parse(jsonStringView, clJsonFields) != simdjson::SUCCESS)
+        {
+            SPDLOG_LOGGER_ERROR(pclMyLogger, "JSON parsing error:");
+            return STATUS::MALFORMED_INPUT;
+        }
+
+        if (clJsonFields["body"].get(stMessage_.clMyJsonBody) != simdjson::SUCCESS)
+        {
+            SPDLOG_LOGGER_WARN(pclMyLogger, "Field 'body' not found in JSON");
+            return STATUS::MALFORMED_INPUT;
+        }
+        return STATUS::SUCCESS;
+    }
+
+    // Walk the tokens of the body to find where each field starts without converting any of them
+    const auto* pcTempInData = reinterpret_cast<const char*>(pucMessage_);
+    const char* pcBufEnd = stMetaData_.uiLength > stMetaData_.uiHeaderLength
+                               ? pcTempInData + stMetaData_.uiLength - stMetaData_.uiHeaderLength
+                               : static_cast<const char*>(std::memchr(pcTempInData, '\0', MAX_ASCII_MESSAGE_LENGTH));
+    stMessage_.pcMyBufEnd = pcBufEnd;
+
+    const DelimiterIndexLease clIndexLease(bAbbreviated);
+    DelimiterIndex& clIndex = clIndexLease.Get();
+    if (pcBufEnd != nullptr) { clIndex.Build(pcTempInData, static_cast<size_t>(pcBufEnd - pcTempInData)); }
+
+    const STATUS eStatus = bAbbreviated ? DecodeAsciiOps<true, true>(stPlan, &pcTempInData, nullptr, pcBufEnd, clIndex, &stMessage_.vMyFieldStarts)
+                                        : DecodeAsciiOps<false, true>(stPlan, &pcTempInData, nullptr, pcBufEnd, clIndex, &stMessage_.vMyFieldStarts);
+
+    // Fields after an early end of the message are left at their defaults, as Decode() does
+    stMessage_.vMyFieldStarts.resize(stPlan.ops.size(), nullptr);
+    return eStatus;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void MessageDecoderBase::DecodeLazyField(const LazyCompositeField& stMessage_, size_t uiOp_) const
+{
+    const DecodeOp& stOp = stMessage_.pclMyPlan->ops[uiOp_];
+    STATUS eStatus = STATUS::SUCCESS;
+
+    // Indexing the rest of the body only pays off for the many tokens of a field array, others are measured with strcspn()
+    const bool bAbbreviated = stMessage_.eMyFormat == HEADER_FORMAT::ABB_ASCII || stMessage_.eMyFormat == HEADER_FORMAT::SHORT_ABB_ASCII;
+    const DelimiterIndexLease clIndexLease(bAbbreviated);
+    DelimiterIndex& clIndex = clIndexLease.Get();
+    const char* pcToken = stMessage_.vMyFieldStarts.empty() ? nullptr : stMessage_.vMyFieldStarts[uiOp_];
+    if (stOp.type == FIELD_TYPE::FIELD_ARRAY && pcToken != nullptr && stMessage_.pcMyBufEnd != nullptr)
+    {
+        clIndex.Build(pcToken, static_cast<size_t>(stMessage_.pcMyBufEnd - pcToken));
+    }
+
+    switch (stMessage_.eMyFormat)
+    {
+    case HEADER_FORMAT::ASCII: [[fallthrough]];
+    case HEADER_FORMAT::SHORT_ASCII:
+        if (pcToken != nullptr)
+        {
+            bool bEarlyEndOfMessage = false;
+            eStatus = DecodeAsciiOp<false, false>(stOp, &pcToken, &stMessage_.clMyFields, stMessage_.pcMyBufEnd, clIndex, bEarlyEndOfMessage);
+        }
+        break;
+    case HEADER_FORMAT::ABB_ASCII: [[fallthrough]];
+    case HEADER_FORMAT::SHORT_ABB_ASCII:
+        if (pcToken != nullptr)
+        {
+            bool bEarlyEndOfMessage = false;
+            eStatus = DecodeAsciiOp<true, false>(stOp, &pcToken, &stMessage_.clMyFields, stMessage_.pcMyBufEnd, clIndex, bEarlyEndOfMessage);
+        }
+        break;
+    case HEADER_FORMAT::JSON: eStatus = DecodeJsonOp(stOp, stMessage_.clMyJsonBody, stMessage_.clMyFields); break;
+    default: break;
+    }
+
+    if (eStatus != STATUS::SUCCESS) { throw std::runtime_error("LazyCompositeField: failed to decode field: " + stOp.field->name); }
+    stMessage_.vMyDecoded[uiOp_] = 1;
+}
+
+// -------------------------------------------------------------------------------------------------------
+size_t LazyCompositeField::FindOp(const BaseField& field_) const
+{
+    if (pclMyPlan == nullptr) { throw std::runtime_error("LazyCompositeField: no message has been decoded"); }
+
+    const std::vector<DecodeOp>& vOps = pclMyPlan->ops;
+    for (size_t i = 0; i < vOps.size(); ++i)
+    {
+        if (vOps[i].field == &field_) { return i; }
+    }
+    throw std::runtime_error("LazyCompositeField: field is not part of the message: " + field_.name);
+}
+
+// -------------------------------------------------------------------------------------------------------
+const CompositeField& LazyCompositeField::DecodeField(const BaseField& field_) const
+{
+    const size_t uiOp = FindOp(field_);
+    if (vMyDecoded[uiOp] == 0) { pclMyDecoder->DecodeLazyField(*this, uiOp); }
+    return clMyFields;
+}
+
+// -------------------------------------------------------------------------------------------------------
+bool LazyCompositeField::IsFieldDecoded(const BaseField& field_) const { return vMyDecoded[FindOp(field_)] != 0; }
+
+// -------------------------------------------------------------------------------------------------------
+const CompositeField& LazyCompositeField::GetCompositeField() const
+{
+    for (size_t i = 0; i < vMyDecoded.size(); ++i)
+    {
+        if (vMyDecoded[i] == 0) { pclMyDecoder->DecodeLazyField(*this, i); }
+    }
+    return clMyFields;
+}
@@ -0,0 +1,318 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file binary_db_unit_test.cpp
+// ===============================================================================
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "novatel_edie/decoders/common/binary_db.hpp"
+#include "novatel_edie/decoders/common/json_db_reader.hpp"
+
+using namespace novatel::edie;
+
+namespace {
+
+constexpr std::string_view BINARY_DB_TEST_JSON = R"({
+    "meta": {"subset": "test", "version": "1.2.3", "messageFamily": "TESTFAMILY"},
+    "enums": [
+        {"name": "Colour", "_id": "e1", "enumerators": [
+            {"name": "RED", "value": 1, "description": "Red"},
+            {"name": "BLUE", "value": 7, "description": null}
+        ]},
+        {"name": "Empty", "_id": "e2", "enumerators": []}
+    ],
+    "messages": [{
+        "_id": "m1", "messageID": 42, "name": "BINTEST", "description": "A test message", "latestMsgDefCrc": "17",
+        "fields": {
+            "17": [
+                {"name": "count", "description": "Count", "type": "SIMPLE", "dataType": {"name": "ULONG", "length": 4, "description": "u32"}, "conversionString": "%lu"},
+                {"name": "value", "description": null, "type": "SIMPLE", "dataType": {"name": "DOUBLE", "length": 8, "description": ""}, "conversionString": "%8.3lf"},
+                {"name": "colour", "description": "", "type": "ENUM", "dataType": {"name": "ENUM", "length": 4, "description": ""}, "conversionString": "%s", "enumID": "e1"},
+                {"name": "id", "description": "", "type": "FIXED_LENGTH_ARRAY", "dataType": {"name": "UCHAR", "length": 1, "description": ""}, "conversionString": "%Z", "arrayLength": 3},
+                {"name": "station", "description": "", "type": "STRING", "dataType": {"name": "CHAR", "length": 1, "description": ""}, "conversionString": "%s", "arrayLength": 32},
+                {"name": "samples", "description": "", "type": "VARIABLE_LENGTH_ARRAY", "dataType": {"name": "USHORT", "length": 2, "description": ""}, "conversionString": "%hu", "arrayLength": 8, "arrayLengthFieldSize": 2, "arrayLengthRef": "count"},
+                {"name": "obs", "description": "", "type": "FIELD_ARRAY", "dataType": {"name": "UNKNOWN", "length": 4, "description": ""}, "conversionString": null, "arrayLength": 4, "fields": [
+                    {"name": "prn", "description": "", "type": "SIMPLE", "dataType": {"name": "USHORT", "length": 2, "description": ""}, "conversionString": "%hu"},
+                    {"name": "cells", "description": "", "type": "FIELD_ARRAY", "dataType": {"name": "UNKNOWN", "length": 4, "description": ""}, "conversionString": null, "arrayLength": 2, "fields": [
+                        {"name": "cno", "description": "", "type": "SIMPLE", "dataType": {"name": "FLOAT", "length": 4, "description": ""}, "conversionString": "%.2f"}
+                    ]}
+                ]}
+            ],
+            "3": [
+                {"name": "count", "description": "Count", "type": "SIMPLE", "dataType": {"name": "ULONG", "length": 4, "description": "u32"}, "conversionString": "%lu"}
+            ]
+        }
+    }]
+})";
+
+// Compares the members that operator== skips as well
+void ExpectSameFields(const FieldInfo& stExpected_, const FieldInfo& stActual_)
+{
+    EXPECT_EQ(stExpected_.fixedFieldBytes, stActual_.fixedFieldBytes);
+    EXPECT_EQ(stExpected_.varFieldCount, stActual_.varFieldCount);
+    ASSERT_EQ(stExpected_.messageOrderedFields.size(), stActual_.messageOrderedFields.size());
+    for (size_t i = 0; i < stExpected_.messageOrderedFields.size(); ++i)
+    {
+        const auto& stExpected = *stExpected_.messageOrderedFields[i];
+        const auto& stActual = *stActual_.messageOrderedFields[i];
+        EXPECT_EQ(stExpected, stActual);
+        EXPECT_EQ(stExpected.index, stActual.index);
+        EXPECT_EQ(stExpected.conversionHash, stActual.conversionHash);
+        EXPECT_EQ(stExpected.width, stActual.width);
+        EXPECT_EQ(stExpected.precision, stActual.precision);
+        EXPECT_EQ(stExpected.isString, stActual.isString);
+        EXPECT_EQ(stExpected.isCsv, stActual.isCsv);
+        if (const auto* pstExpected = dynamic_cast<const FieldArrayField*>(&stExpected))
+        {
+            const auto& stActualArray = dynamic_cast<const FieldArrayField&>(stActual);
+            EXPECT_EQ(pstExpected->fieldSize, stActualArray.fieldSize);
+            ExpectSameFields(*pstExpected->fieldInfo, *stActualArray.fieldInfo);
+        }
+    }
+}
+
+void ExpectSameDb(const MessageDatabase& clExpected_, const MessageDatabase& clActual_)
+{
+    ASSERT_NE(clActual_.GetDbMetadata(), nullptr);
+    EXPECT_EQ(clExpected_.GetDbMetadata()->subset, clActual_.GetDbMetadata()->subset);
+    EXPECT_EQ(clExpected_.GetDbMetadata()->version, clActual_.GetDbMetadata()->version);
+    EXPECT_EQ(clExpected_.GetDbMetadata()->messageFamily, clActual_.GetDbMetadata()->messageFamily);
+
+    ASSERT_EQ(clExpected_.EnumDefinitions().size(), clActual_.EnumDefinitions().size());
+    for (size_t i = 0; i < clExpected_.EnumDefinitions().size(); ++i)
+    {
+        EXPECT_EQ(clExpected_.EnumDefinitions()[i]->_id, clActual_.EnumDefinitions()[i]->_id);
+        EXPECT_EQ(clExpected_.EnumDefinitions()[i]->name, clActual_.EnumDefinitions()[i]->name);
+        EXPECT_EQ(clExpected_.EnumDefinitions()[i]->enumerators, clActual_.EnumDefinitions()[i]->enumerators);
+    }
+
+    ASSERT_EQ(clExpected_.MessageDefinitions().size(), clActual_.MessageDefinitions().size());
+    for (size_t i = 0; i < clExpected_.MessageDefinitions().size(); ++i)
+    {
+        const auto& stExpected = *clExpected_.MessageDefinitions()[i];
+        const auto& stActual = *clActual_.MessageDefinitions()[i];
+        EXPECT_EQ(stExpected, stActual);
+        for (const auto& [uiCrc, pstFieldInfo] : stExpected.fieldInfo) { ExpectSameFields(*pstFieldInfo, *stActual.fieldInfo.at(uiCrc)); }
+    }
+}
+
+} // namespace
+
+class BinaryDbTest : public testing::Test
+{
+  protected:
+    void SetUp() override { pclMyJsonDb = ParseJsonDb(BINARY_DB_TEST_JSON); }
+
+    MessageDatabase::Ptr pclMyJsonDb;
+};
+
+// -------------------------------------------------------------------------------------------------------
+// Binary Database Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST_F(BinaryDbTest, RoundTrip)
+{
+    const auto vImage = SerializeBinaryDb(*pclMyJsonDb);
+    ASSERT_TRUE(IsBinaryDb(vImage.data(), vImage.size()));
+
+    const auto pclBinaryDb = ParseBinaryDb(vImage.data(), vImage.size());
+    ExpectSameDb(*pclMyJsonDb, *pclBinaryDb);
+    EXPECT_EQ(SerializeBinaryDb(*pclBinaryDb), vImage);
+
+    for (const auto& pstJsonDef : pclMyJsonDb->MessageDefinitions())
+    {
+        const auto pstLoadedDef = pclBinaryDb->GetMsgDef(pstJsonDef->name);
+        ASSERT_NE(pstLoadedDef, nullptr);
+        EXPECT_TRUE(*pstLoadedDef == *pstJsonDef) << pstJsonDef->name;
+    }
+}
+
+TEST_F(BinaryDbTest, LookupsAndEnumFieldsAreResolved)
+{
+    const auto vImage = SerializeBinaryDb(*pclMyJsonDb);
+    const auto pclBinaryDb = ParseBinaryDb(vImage.data(), vImage.size());
+
+    const auto pstMsgDef = pclBinaryDb->GetMsgDef("BINTEST");
+    ASSERT_NE(pstMsgDef, nullptr);
+    EXPECT_EQ(pclBinaryDb->GetMsgDef(42), pstMsgDef);
+    EXPECT_EQ(pstMsgDef->latestMessageCrc, 17U);
+    EXPECT_EQ(pstMsgDef->fieldInfo.size(), 2U);
+
+    const auto pstColourDef = pclBinaryDb->GetEnumDefName("Colour");
+    ASSERT_NE(pstColourDef, nullptr);
+    EXPECT_EQ(pstColourDef->nameValue.at("BLUE"), 7U);
+    EXPECT_EQ(pstColourDef->unknownValue, 8U);
+
+    const auto pstColourField = std::dynamic_pointer_cast<const EnumField>(pstMsgDef->GetMsgDefFromCrc(17).GetFieldDefByName("colour"));
+    ASSERT_NE(pstColourField, nullptr);
+    EXPECT_EQ(pstColourField->enumDef, pstColourDef);
+}
+
+TEST_F(BinaryDbTest, EmptyDatabase)
+{
+    const MessageDatabase clEmptyDb;
+    const auto vImage = SerializeBinaryDb(clEmptyDb);
+    const auto pclBinaryDb = ParseBinaryDb(vImage.data(), vImage.size());
+    EXPECT_EQ(pclBinaryDb->GetDbMetadata(), nullptr);
+    EXPECT_TRUE(pclBinaryDb->MessageDefinitions().empty());
+    EXPECT_TRUE(pclBinaryDb->EnumDefinitions().empty());
+}
+
+TEST_F(BinaryDbTest, RejectsInvalidImages)
+{
+    const auto vImage = SerializeBinaryDb(*pclMyJsonDb);
+
+    EXPECT_THROW(ParseBinaryDb(nullptr, 0), BinaryDbFailure);
+    EXPECT_THROW(ParseBinaryDb(vImage.data(), vImage.size() - 1), BinaryDbFailure);
+
+    auto vBadMagic = vImage;
+    vBadMagic[0] = 'X';
+    EXPECT_FALSE(IsBinaryDb(vBadMagic.data(), vBadMagic.size()));
+    EXPECT_THROW(ParseBinaryDb(vBadMagic.data(), vBadMagic.size()), BinaryDbFailure);
+
+    // Shrink the string table, which follows the metadata in the image header, so that the strings are out of bounds
+    auto vBadStrings = vImage;
+    constexpr size_t uiStringTableSizeOffset = 52;
+    std::fill_n(vBadStrings.begin() + uiStringTableSizeOffset, sizeof(uint32_t), 0);
+    EXPECT_THROW(ParseBinaryDb(vBadStrings.data(), vBadStrings.size()), BinaryDbFailure);
+
+    // The first field record is the SIMPLE "count" field, whose class byte sits at offset 81 of the record
+    uint32_t uiFieldTableOffset = 0;
+    constexpr size_t uiFieldTableRefOffset = 88;
+    std::copy_n(vImage.begin() + uiFieldTableRefOffset, sizeof(uint32_t), reinterpret_cast<unsigned char*>(&uiFieldTableOffset));
+    const size_t uiFieldClassOffset = uiFieldTableOffset + 81;
+
+    auto vUnknownClass = vImage;
+    vUnknownClass[uiFieldClassOffset] = 4;
+    EXPECT_THROW(ParseBinaryDb(vUnknownClass.data(), vUnknownClass.size()), BinaryDbFailure);
+
+    // A SIMPLE field stored with the FIELD_ARRAY class
+    auto vMismatchedClass = vImage;
+    vMismatchedClass[uiFieldClassOffset] = 3;
+    EXPECT_THROW(ParseBinaryDb(vMismatchedClass.data(), vMismatchedClass.size()), BinaryDbFailure);
+}
+
+TEST_F(BinaryDbTest, RejectsInvalidLayouts)
+{
+    const auto vImage = SerializeBinaryDb(*pclMyJsonDb);
+    const auto ReadTableOffset = [&](size_t uiTableRefOffset_) {
+        uint32_t uiOffset = 0;
+        std::copy_n(vImage.begin() + uiTableRefOffset_, sizeof(uint32_t), reinterpret_cast<unsigned char*>(&uiOffset));
+        return uiOffset;
+    };
+    const auto WriteU32 = [](std::vector<unsigned char>& vImage_, size_t uiOffset_, uint32_t uiValue_) {
+        std::copy_n(reinterpret_cast<const unsigned char*>(&uiValue_), sizeof(uint32_t), vImage_.begin() + uiOffset_);
+    };
+
+    // The first field info record holds the definition with CRC 3, whose only field is the 4-byte SIMPLE "count"
+    // field. Its fixed field bytes follow the CRC, and the index of the field sits at offset 48 of its record.
+    constexpr size_t uiFieldInfoTableRefOffset = 80;
+    constexpr size_t uiFieldTableRefOffset = 88;
+    const size_t uiFixedFieldBytesOffset = ReadTableOffset(uiFieldInfoTableRefOffset) + 4;
+    const size_t uiVarFieldCountOffset = uiFixedFieldBytesOffset + 4;
+    const size_t uiFieldIndexOffset = ReadTableOffset(uiFieldTableRefOffset) + 48;
+
+    auto vBadIndex = vImage;
+    WriteU32(vBadIndex, uiFieldIndexOffset, 0x1000);
+    EXPECT_THROW(ParseBinaryDb(vBadIndex.data(), vBadIndex.size()), BinaryDbFailure);
+
+    auto vBadFixedFieldBytes = vImage;
+    WriteU32(vBadFixedFieldBytes, uiFixedFieldBytesOffset, 3);
+    EXPECT_THROW(ParseBinaryDb(vBadFixedFieldBytes.data(), vBadFixedFieldBytes.size()), BinaryDbFailure);
+
+    auto vBadVarFieldCount = vImage;
+    WriteU32(vBadVarFieldCount, uiVarFieldCountOffset, 1);
+    EXPECT_THROW(ParseBinaryDb(vBadVarFieldCount.data(), vBadVarFieldCount.size()), BinaryDbFailure);
+}
+
+TEST_F(BinaryDbTest, RejectsDeeplyNestedFieldArrays)
+{
+    // A chain of field arrays, each holding only the next one
+    FieldInfo::ConstPtr pstFieldInfo = BuildFieldInfo({std::make_shared<BaseField>("leaf", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT)});
+    const auto MakeDb = [](const FieldInfo::ConstPtr& pstFieldInfo_) {
+        auto pstMsgDef = std::make_shared<MessageDefinition>();
+        pstMsgDef->name = "NESTED";
+        pstMsgDef->fieldInfo[1] = pstFieldInfo_;
+        pstMsgDef->latestMessageCrc = 1;
+        return MessageDatabase({pstMsgDef}, {});
+    };
+    for (int i = 0; i < 100; ++i)
+    {
+        if (i == 8)
+        {
+            const auto vImage = SerializeBinaryDb(MakeDb(pstFieldInfo));
+            EXPECT_NO_THROW((void)ParseBinaryDb(vImage.data(), vImage.size()));
+        }
+        auto pstFieldArray =
+            std::make_shared<FieldArrayField>("nested", FIELD_TYPE::FIELD_ARRAY, "", DATA_TYPE::UNKNOWN, 1, std::move(pstFieldInfo));
+        pstFieldInfo = BuildFieldInfo({pstFieldArray});
+    }
+
+    const auto vImage = SerializeBinaryDb(MakeDb(pstFieldInfo));
+    EXPECT_THROW(ParseBinaryDb(vImage.data(), vImage.size()), BinaryDbFailure);
+}
+
+TEST_F(BinaryDbTest, RejectsInvalidFieldDefinitions)
+{
+    auto pstMsgDef = std::make_shared<MessageDefinition>(*pclMyJsonDb->GetMsgDef("BINTEST"));
+    auto pstFieldInfo = std::make_shared<FieldInfo>(*pstMsgDef->fieldInfo.at(3));
+    pstMsgDef->fieldInfo[3] = pstFieldInfo;
+    const MessageDatabase clDb({pstMsgDef}, {});
+
+    pstFieldInfo->messageOrderedFields.push_back(nullptr);
+    EXPECT_THROW(SerializeBinaryDb(clDb), BinaryDbFailure);
+
+    // A FIELD_ARRAY type needs a FieldArrayField definition
+    auto pstField = std::make_shared<BaseField>();
+    pstField->name = "obs";
+    pstField->type = FIELD_TYPE::FIELD_ARRAY;
+    pstFieldInfo->messageOrderedFields.back() = pstField;
+    EXPECT_THROW(SerializeBinaryDb(clDb), BinaryDbFailure);
+}
+
+TEST_F(BinaryDbTest, LoadFiles)
+{
+    const auto clTempDir = std::filesystem::temp_directory_path();
+    const auto clBinaryPath = clTempDir / "edie_binary_db_test.bin";
+    const auto clJsonPath = clTempDir / "edie_binary_db_test.json";
+
+    WriteBinaryDbFile(*pclMyJsonDb, clBinaryPath);
+    std::ofstream(clJsonPath) << BINARY_DB_TEST_JSON;
+
+    const auto pclMappedDb = LoadBinaryDbFile(clBinaryPath);
+    ExpectSameDb(*pclMyJsonDb, *pclMappedDb);
+    EXPECT_EQ(SerializeBinaryDb(*pclMappedDb), SerializeBinaryDb(*pclMyJsonDb));
+
+    // LoadDbFile() accepts either format
+    ExpectSameDb(*pclMyJsonDb, *LoadDbFile(clBinaryPath));
+    ExpectSameDb(*pclMyJsonDb, *LoadDbFile(clJsonPath));
+
+    EXPECT_THROW(LoadBinaryDbFile(clJsonPath), BinaryDbFailure);
+    EXPECT_THROW(LoadBinaryDbFile(clTempDir / "edie_binary_db_test_missing.bin"), BinaryDbFailure);
+
+    std::filesystem::remove(clBinaryPath);
+    std::filesystem::remove(clJsonPath);
+}
@@ -0,0 +1,149 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file composite_field_arena_unit_test.cpp
+// ===============================================================================
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "decoder_test_utils.hpp"
+#include "novatel_edie/decoders/common/message_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::test;
+
+// -------------------------------------------------------------------------------------------------------
+// CompositeFieldArena Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class CompositeFieldArenaTest : public ::testing::Test
+{
+  protected:
+    BaseField::Ptr pclU32 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    ArrayField::Ptr pclValues = MakeVariableArray("values", "%hu", DATA_TYPE::USHORT, 8);
+    BaseField::Ptr pclSubU32 = std::make_shared<BaseField>("sub_u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    ArrayField::Ptr pclSubValues = MakeVariableArray("sub_values", "%hu", DATA_TYPE::USHORT, 8);
+    FieldArrayField::Ptr pclArray = MakeFieldArray("array", 4, {pclSubU32, pclSubValues});
+    FieldInfo::ConstPtr pclFieldInfo = BuildFieldInfo({pclU32, pclValues, pclArray});
+
+    const TestMessage stMessage{778U, "ARENAMSG", 0x55667788U, pclFieldInfo};
+
+    // A message with uiValues_ values and uiRecords_ records of one value each
+    [[nodiscard]] static std::vector<unsigned char> CreateBinaryMessage(uint32_t uiValues_, uint32_t uiRecords_)
+    {
+        std::vector<unsigned char> vMessage;
+        Append<uint32_t>(vMessage, uiValues_ + uiRecords_);
+        Append<uint32_t>(vMessage, uiValues_);
+        for (uint32_t i = 0; i < uiValues_; ++i) { Append<uint16_t>(vMessage, static_cast<uint16_t>(i)); }
+        Append<uint32_t>(vMessage, uiRecords_);
+        for (uint32_t i = 0; i < uiRecords_; ++i)
+        {
+            Append<uint32_t>(vMessage, 100 + i);
+            Append<uint32_t>(vMessage, 1);
+            Append<uint16_t>(vMessage, static_cast<uint16_t>(200 + i));
+        }
+        return vMessage;
+    }
+};
+
+TEST_F(CompositeFieldArenaTest, RESET_REUSES_PAYLOADS)
+{
+    CompositeField clMessage(pclFieldInfo);
+    auto& vValues = clMessage.EmplaceVarField<std::vector<uint16_t>>(pclValues->index);
+    vValues.assign({1, 2, 3, 4});
+    const uint16_t* pusValues = vValues.data();
+
+    clMessage.Reset();
+    EXPECT_TRUE(clMessage.GetVarFields().empty());
+    EXPECT_EQ(clMessage.GetFixedFields().size(), 0U);
+
+    // The payload released by Reset() is handed out again, empty but with its storage
+    clMessage.SetFieldInfo(pclFieldInfo);
+    auto& vReused = clMessage.EmplaceVarField<std::vector<uint16_t>>(pclValues->index);
+    EXPECT_TRUE(vReused.empty());
+    EXPECT_GE(vReused.capacity(), 4U);
+    EXPECT_EQ(vReused.data(), pusValues);
+
+    EXPECT_THROW(clMessage.EmplaceVarField<std::string>(pclFieldInfo->varFieldCount), std::runtime_error);
+}
+
+TEST_F(CompositeFieldArenaTest, RESET_REUSES_RECORDS)
+{
+    CompositeField clMessage(pclFieldInfo);
+    clMessage.Reset();
+    clMessage.SetFieldInfo(pclFieldInfo);
+
+    auto& vRecords = clMessage.EmplaceVarField<CompositeFieldArray>(pclArray->index);
+    CompositeField& clRecord = clMessage.EmplaceRecord(vRecords, pclArray->fieldInfo);
+    EXPECT_EQ(clRecord.GetFieldInfo(), pclArray->fieldInfo);
+    clRecord.SetFieldValue<false>(pclSubValues->index, std::vector<uint16_t>{5, 6});
+    const uint16_t* pusSubValues = std::get<std::vector<uint16_t>>(clRecord.GetVarFields()[pclSubValues->index]).data();
+
+    // The record's own payloads are recycled along with it
+    clMessage.Reset();
+    clMessage.SetFieldInfo(pclFieldInfo);
+    auto& vReusedRecords = clMessage.EmplaceVarField<CompositeFieldArray>(pclArray->index);
+    EXPECT_TRUE(vReusedRecords.empty());
+    CompositeField& clReusedRecord = clMessage.EmplaceRecord(vReusedRecords, pclArray->fieldInfo);
+    EXPECT_EQ(clReusedRecord.GetFixedFields().size(), pclArray->fieldInfo->fixedFieldBytes);
+    EXPECT_EQ(clReusedRecord.EmplaceVarField<std::vector<uint16_t>>(pclSubValues->index).data(), pusSubValues);
+}
+
+TEST_F(CompositeFieldArenaTest, COPY_IS_INDEPENDENT)
+{
+    CompositeField clMessage(pclFieldInfo);
+    clMessage.Reset();
+    clMessage.SetFieldInfo(pclFieldInfo);
+    clMessage.EmplaceVarField<std::vector<uint16_t>>(pclValues->index).assign({1, 2});
+
+    const CompositeField clCopy = clMessage;
+    clMessage.Reset();
+    EXPECT_EQ(clCopy.GetFieldValue<std::vector<uint16_t>>(*pclValues), (std::vector<uint16_t>{1, 2}));
+}
+
+TEST_F(CompositeFieldArenaTest, DECODE_INTO_REUSED_MESSAGE)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase({stMessage}));
+
+    CompositeField clReused;
+    ASSERT_EQ(DecodeBinary(clDecoder, stMessage, CreateBinaryMessage(6, 3), clReused), STATUS::SUCCESS);
+    const uint16_t* pusValues = std::get<std::vector<uint16_t>>(clReused.GetVarFields()[pclValues->index]).data();
+    ASSERT_EQ(DecodeBinary(clDecoder, stMessage, CreateBinaryMessage(2, 1), clReused), STATUS::SUCCESS);
+
+    // Nothing from the previous, larger message is left behind
+    CompositeField clFresh;
+    ASSERT_EQ(DecodeBinary(clDecoder, stMessage, CreateBinaryMessage(2, 1), clFresh), STATUS::SUCCESS);
+    EXPECT_EQ(clReused.GetFixedFields().size(), clFresh.GetFixedFields().size());
+    EXPECT_EQ(std::memcmp(clReused.GetFixedFields().data(), clFresh.GetFixedFields().data(), clFresh.GetFixedFields().size()), 0);
+    EXPECT_EQ(clReused.GetFieldValue<std::vector<uint16_t>>(*pclValues), (std::vector<uint16_t>{0, 1}));
+    const auto& vRecords = std::get<CompositeFieldArray>(clReused.GetVarFields()[pclArray->index]);
+    ASSERT_EQ(vRecords.size(), 1U);
+    EXPECT_EQ(vRecords[0].GetFieldValue<uint32_t>(*pclSubU32), 100U);
+    EXPECT_EQ(vRecords[0].GetFieldValue<std::vector<uint16_t>>(*pclSubValues), (std::vector<uint16_t>{200}));
+
+    // The storage of the first message is reused
+    EXPECT_EQ(std::get<std::vector<uint16_t>>(clReused.GetVarFields()[pclValues->index]).data(), pusValues);
+}
@@ -0,0 +1,292 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file decode_plan_unit_test.cpp
+// ===============================================================================
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "decoder_test_utils.hpp"
+#include "novatel_edie/decoders/common/decode_plan.hpp"
+#include "novatel_edie/decoders/common/message_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::test;
+
+// -------------------------------------------------------------------------------------------------------
+// DecodePlan Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class DecodePlanTest : public ::testing::Test
+{
+  protected:
+    BaseField::Ptr pclU32 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    BaseField::Ptr pclI16 = std::make_shared<BaseField>("i16", FIELD_TYPE::SIMPLE, "%hd", DATA_TYPE::SHORT);
+    ArrayField::Ptr pclBytes = std::make_shared<ArrayField>("bytes", FIELD_TYPE::FIXED_LENGTH_ARRAY, "%Z", DATA_TYPE::UCHAR, 3);
+    ArrayField::Ptr pclValues = MakeVariableArray("values", "%hu", DATA_TYPE::USHORT, 4);
+    BaseField::Ptr pclDouble = std::make_shared<BaseField>("double", FIELD_TYPE::SIMPLE, "%lf", DATA_TYPE::DOUBLE);
+    BaseField::Ptr pclSubU32 = std::make_shared<BaseField>("sub_u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    FieldArrayField::Ptr pclArray = MakeFieldArray("array", 2, {pclSubU32});
+    FieldInfo::ConstPtr pclFieldInfo = BuildFieldInfo({pclU32, pclI16, pclBytes, pclValues, pclDouble, pclArray});
+
+    const TestMessage stMessage{777U, "TESTMSG", 0x11223344U, pclFieldInfo};
+
+    [[nodiscard]] MessageDatabase::Ptr CreateDatabase() const { return test::CreateDatabase({stMessage}); }
+
+    [[nodiscard]] static std::vector<unsigned char> CreateBinaryMessage()
+    {
+        std::vector<unsigned char> vMessage;
+        Append<uint32_t>(vMessage, 0xDEADBEEF);
+        Append<int16_t>(vMessage, -5);
+        vMessage.insert(vMessage.end(), {1, 2, 3});
+        Append<uint32_t>(vMessage, 2);
+        Append<uint16_t>(vMessage, 7);
+        Append<uint16_t>(vMessage, 8);
+        Append<double>(vMessage, 2.5);
+        Append<uint32_t>(vMessage, 1);
+        Append<uint32_t>(vMessage, 42);
+        return vMessage;
+    }
+};
+
+TEST_F(DecodePlanTest, COMPILE)
+{
+    const DecodePlan& stPlan = pclFieldInfo->GetDecodePlan();
+    ASSERT_EQ(stPlan.ops.size(), 6U);
+
+    // The contiguous fixed fields before the variable length array form one run
+    EXPECT_EQ(stPlan.ops[0].runOps, 3U);
+    EXPECT_EQ(stPlan.ops[0].runBytes, 9U);
+    EXPECT_EQ(stPlan.ops[1].runOps, 2U);
+    EXPECT_EQ(stPlan.ops[2].copyBytes, 3U);
+    EXPECT_TRUE(stPlan.ops[2].zConversion);
+
+    EXPECT_EQ(stPlan.ops[3].copyBytes, 0U);
+    EXPECT_EQ(stPlan.ops[3].arrayField, pclValues.get());
+    EXPECT_EQ(stPlan.ops[3].arrayLength, 4U);
+    EXPECT_EQ(stPlan.ops[4].runOps, 1U);
+
+    EXPECT_EQ(stPlan.ops[5].fieldArrayField, pclArray.get());
+    EXPECT_EQ(stPlan.ops[5].subPlan.get(), &pclArray->fieldInfo->GetDecodePlan());
+    EXPECT_TRUE(stPlan.ops[5].flatArray);
+
+    // The plan is compiled once
+    EXPECT_EQ(&pclFieldInfo->GetDecodePlan(), &stPlan);
+}
+
+TEST_F(DecodePlanTest, RECOMPILE)
+{
+    const DecodePlan::ConstPtr pclPlan = pclFieldInfo->GetDecodePlanPtr();
+    const DecodePlan::ConstPtr pclSubPlan = pclPlan->ops[5].subPlan;
+
+    // A copy whose fields are replaced compiles its own plan once its caches are invalidated
+    FieldInfo stCopy = *pclFieldInfo;
+    EXPECT_EQ(&stCopy.GetDecodePlan(), pclPlan.get());
+    stCopy.messageOrderedFields.pop_back();
+    stCopy.InvalidateCaches();
+    const DecodePlan& stCopyPlan = stCopy.GetDecodePlan();
+    EXPECT_NE(&stCopyPlan, pclPlan.get());
+    ASSERT_EQ(stCopyPlan.ops.size(), 5U);
+    EXPECT_EQ(stCopyPlan.ops[0].field, pclU32.get());
+
+    // A plan keeps the plan of its field array elements when their caches are invalidated
+    std::const_pointer_cast<FieldInfo>(pclArray->fieldInfo)->InvalidateCaches();
+    EXPECT_NE(&pclArray->fieldInfo->GetDecodePlan(), pclSubPlan.get());
+    EXPECT_EQ(pclPlan->ops[5].subPlan, pclSubPlan);
+    EXPECT_EQ(&pclFieldInfo->GetDecodePlan(), pclPlan.get());
+}
+
+TEST_F(DecodePlanTest, DECODE_BINARY)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase());
+    const std::vector<unsigned char> vMessage = CreateBinaryMessage();
+    MetaDataBase stMetaData = CreateMetaData(stMessage, HEADER_FORMAT::BINARY, static_cast<uint32_t>(vMessage.size()));
+
+    CompositeField clMessage;
+    ASSERT_EQ(clDecoder.Decode(vMessage.data(), clMessage, stMetaData), STATUS::SUCCESS);
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*pclU32), 0xDEADBEEF);
+    EXPECT_EQ(clMessage.GetFieldValue<int16_t>(*pclI16), -5);
+    EXPECT_EQ(std::get<std::vector<uint16_t>>(clMessage.GetFieldValueVariant(*pclValues)), (std::vector<uint16_t>{7, 8}));
+    EXPECT_EQ(clMessage.GetFieldValue<double>(*pclDouble), 2.5);
+    const auto clArray = clMessage.GetFieldValue<FieldArray>(*pclArray);
+    ASSERT_EQ(clArray.size(), 1U);
+    EXPECT_EQ(clArray.GetFieldValue<uint32_t>(*pclSubU32, 0), 42U);
+}
+
+TEST_F(DecodePlanTest, DECODE_BINARY_SHORT_MESSAGE)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase());
+    const std::vector<unsigned char> vMessage = CreateBinaryMessage();
+
+    // A message that ends within a run stops after the field that reaches its end, as if it was decoded field by field
+    MetaDataBase stMetaData = CreateMetaData(stMessage, HEADER_FORMAT::BINARY, 5);
+    CompositeField clMessage;
+    ASSERT_EQ(clDecoder.Decode(vMessage.data(), clMessage, stMetaData), STATUS::SUCCESS);
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*pclU32), 0xDEADBEEF);
+    EXPECT_EQ(clMessage.GetFieldValue<int16_t>(*pclI16), -5);
+    EXPECT_EQ(clMessage.GetFieldValue<double>(*pclDouble), 0.0);
+}
+
+TEST_F(DecodePlanTest, DECODE_BINARY_ALIGNED)
+{
+    const auto fAlign = [](const size_t size_, const uintptr_t start_, const uintptr_t ptr_) -> size_t {
+        const size_t alignment = std::min(size_t{4}, size_);
+        const size_t offset = (ptr_ - start_) % alignment;
+        return offset == 0 ? 0 : alignment - offset;
+    };
+    MessageDatabase::RegisterAlignmentFunction("DECODE_PLAN_TEST", fAlign);
+
+    auto pclU8 = std::make_shared<BaseField>("u8", FIELD_TYPE::SIMPLE, "%uc", DATA_TYPE::UCHAR);
+    pclFieldInfo = BuildFieldInfo({pclU8, pclU32, pclI16, pclI16->clone(), pclValues}, "DECODE_PLAN_TEST");
+    const TestMessage stAligned{stMessage.usLogId, stMessage.sName, stMessage.uiCrc, pclFieldInfo};
+
+    // Padding in the fixed fields splits the runs
+    const DecodePlan& stPlan = pclFieldInfo->GetDecodePlan();
+    EXPECT_EQ(stPlan.ops[0].runOps, 1U);
+    EXPECT_EQ(stPlan.ops[1].runOps, 3U);
+    EXPECT_EQ(stPlan.ops[1].runBytes, 8U);
+
+    std::vector<unsigned char> vMessage{9, 0, 0, 0};
+    Append<uint32_t>(vMessage, 0xDEADBEEF);
+    Append<int16_t>(vMessage, -5);
+    Append<int16_t>(vMessage, 6);
+    Append<uint32_t>(vMessage, 1);
+    Append<uint16_t>(vMessage, 7);
+
+    MessageDecoderBase clDecoder("", test::CreateDatabase({stAligned}), fAlign);
+    MetaDataBase stMetaData = CreateMetaData(stAligned, HEADER_FORMAT::BINARY, static_cast<uint32_t>(vMessage.size()));
+    CompositeField clMessage;
+    ASSERT_EQ(clDecoder.Decode(vMessage.data(), clMessage, stMetaData), STATUS::SUCCESS);
+    EXPECT_EQ(clMessage.GetFieldValue<uint8_t>(*pclU8), 9U);
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*pclU32), 0xDEADBEEF);
+    EXPECT_EQ(clMessage.GetFieldValue<int16_t>(*pclI16), -5);
+    EXPECT_EQ(clMessage.GetFieldValue<int16_t>(*pclFieldInfo->messageOrderedFields[3]), 6);
+    EXPECT_EQ(std::get<std::vector<uint16_t>>(clMessage.GetFieldValueVariant(*pclValues)), (std::vector<uint16_t>{7}));
+}
+
+TEST_F(DecodePlanTest, BIND_CONVERTERS)
+{
+    class BindTester : public MessageDecoderBase
+    {
+      public:
+        using MessageDecoderBase::MessageDecoderBase;
+
+        [[nodiscard]] DecodePlan::ConstPtr TestGetBoundPlan(const FieldInfo& fieldInfo_) const { return GetBoundPlan(fieldInfo_); }
+    };
+
+    // Compiled plans have no converters
+    const DecodePlan& stPlan = pclFieldInfo->GetDecodePlan();
+    EXPECT_EQ(stPlan.ops[0].asciiConverter, nullptr);
+    EXPECT_EQ(stPlan.ops[0].jsonConverter, nullptr);
+
+    // The plans of the database are bound once, including the plans of their field array elements
+    const BindTester clDecoder("", CreateDatabase());
+    const DecodePlan::ConstPtr pclBoundPlan = clDecoder.TestGetBoundPlan(*pclFieldInfo);
+    EXPECT_EQ(clDecoder.TestGetBoundPlan(*pclFieldInfo), pclBoundPlan);
+    ASSERT_EQ(pclBoundPlan->ops.size(), stPlan.ops.size());
+    for (const size_t uiOp : {0, 1, 3, 4})
+    {
+        EXPECT_NE(pclBoundPlan->ops[uiOp].asciiConverter, nullptr) << pclBoundPlan->ops[uiOp].field->name;
+        EXPECT_NE(pclBoundPlan->ops[uiOp].jsonConverter, nullptr) << pclBoundPlan->ops[uiOp].field->name;
+    }
+    // Field arrays are decoded through the plan of their elements
+    EXPECT_EQ(pclBoundPlan->ops[5].asciiConverter, nullptr);
+    EXPECT_NE(pclBoundPlan->ops[5].subPlan->ops[0].asciiConverter, nullptr);
+    EXPECT_EQ(pclBoundPlan->ops[0].asciiConverter, pclBoundPlan->ops[5].subPlan->ops[0].asciiConverter);
+
+    // A field info outside the database is bound once, on first use
+    const auto pclOtherFieldInfo = BuildFieldInfo({pclU32});
+    const DecodePlan::ConstPtr pclOtherPlan = clDecoder.TestGetBoundPlan(*pclOtherFieldInfo);
+    EXPECT_NE(pclOtherPlan->ops[0].asciiConverter, nullptr);
+    EXPECT_EQ(clDecoder.TestGetBoundPlan(*pclOtherFieldInfo), pclOtherPlan);
+
+    // and again once its caches are invalidated
+    std::const_pointer_cast<FieldInfo>(pclOtherFieldInfo)->InvalidateCaches();
+    const DecodePlan::ConstPtr pclReboundPlan = clDecoder.TestGetBoundPlan(*pclOtherFieldInfo);
+    EXPECT_NE(pclReboundPlan, pclOtherPlan);
+    EXPECT_EQ(clDecoder.TestGetBoundPlan(*pclOtherFieldInfo), pclReboundPlan);
+}
+
+TEST_F(DecodePlanTest, BIND_APPENDED_MESSAGE)
+{
+    class BindTester : public MessageDecoderBase
+    {
+      public:
+        using MessageDecoderBase::MessageDecoderBase;
+
+        [[nodiscard]] DecodePlan::ConstPtr TestGetBoundPlan(const FieldInfo& fieldInfo_) const { return GetBoundPlan(fieldInfo_); }
+    };
+
+    // The message is added to the database after the decoder bound its plans
+    const auto pclDatabase = std::make_shared<MessageDatabase>();
+    const BindTester clDecoder("", pclDatabase);
+    pclDatabase->AppendMessages(CreateDatabase()->MessageDefinitions());
+    const FieldInfo& stAppended = *pclDatabase->GetMsgDef("TESTMSG")->fieldInfo.at(stMessage.uiCrc);
+
+    const DecodePlan::ConstPtr pclBoundPlan = clDecoder.TestGetBoundPlan(stAppended);
+    EXPECT_NE(pclBoundPlan->ops[0].asciiConverter, nullptr);
+
+    // Decoding it uses the plan bound on first use instead of binding it again
+    const std::vector<unsigned char> vMessage = CreateBinaryMessage();
+    for (int i = 0; i < 2; ++i)
+    {
+        MetaDataBase stMetaData = CreateMetaData(stMessage, HEADER_FORMAT::BINARY, static_cast<uint32_t>(vMessage.size()));
+        CompositeField clMessage;
+        ASSERT_EQ(clDecoder.Decode(vMessage.data(), clMessage, stMetaData), STATUS::SUCCESS);
+        EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*stAppended.messageOrderedFields[0]), 0xDEADBEEF);
+        EXPECT_EQ(clDecoder.TestGetBoundPlan(stAppended), pclBoundPlan);
+    }
+}
+
+TEST_F(DecodePlanTest, DECODE_ASCII_CONVERTERS)
+{
+    class ConverterTester : public MessageDecoderBase
+    {
+      public:
+        explicit ConverterTester(MessageDatabase::Ptr pclMessageDb_)
+            : MessageDecoderBase(DeferBinding{}, "", std::move(pclMessageDb_), MessageDatabase::NoAlign)
+        {
+            // Converters added by a derived decoder replace those of the base
+            asciiFieldMap[CalculateBlockCrc32("hd")] = [](CompositeField& clCompField_, const BaseField& field_, const char**, size_t, size_t, bool,
+                                                          MessageDatabase&) { clCompField_.SetFieldValue<true>(field_.index, int16_t{99}); };
+            BindFieldConverters();
+        }
+
+        STATUS TestDecodeAscii(const FieldInfo& fieldInfo_, const char** ppcLogBuf_, CompositeField& clCompField_) const
+        {
+            return DecodeAscii<false>(fieldInfo_, ppcLogBuf_, clCompField_);
+        }
+    };
+
+    const auto pclAsciiFieldInfo = BuildFieldInfo({pclU32, pclI16});
+    static_cast<void>(pclAsciiFieldInfo->GetDecodePlan());
+    const ConverterTester clDecoder(CreateDatabase());
+    const char* pcInput = "12,-5\r\n";
+    CompositeField clMessage(pclAsciiFieldInfo->fixedFieldBytes, pclAsciiFieldInfo->varFieldCount);
+    ASSERT_EQ(clDecoder.TestDecodeAscii(*pclAsciiFieldInfo, &pcInput, clMessage), STATUS::SUCCESS);
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*pclU32), 12U);
+    EXPECT_EQ(clMessage.GetFieldValue<int16_t>(*pclI16), 99);
+}
@@ -0,0 +1,112 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file decoder_test_utils.hpp
+// ===============================================================================
+
+#pragma once
+
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "novatel_edie/decoders/common/message_decoder.hpp"
+
+// Definitions and message bodies shared by the unit tests of the message decoder
+namespace novatel::edie::test {
+
+//! A message definition with a single definition CRC.
+struct TestMessage
+{
+    uint16_t usLogId;
+    std::string sName;
+    uint32_t uiCrc;
+    FieldInfo::ConstPtr pclFieldInfo;
+};
+
+//! Create a database holding the messages.
+[[nodiscard]] inline MessageDatabase::Ptr CreateDatabase(std::initializer_list<TestMessage> lMessages_)
+{
+    std::vector<MessageDefinition::ConstPtr> vMsgDefs;
+    for (const TestMessage& stMessage : lMessages_)
+    {
+        auto pclMsgDef = std::make_shared<MessageDefinition>();
+        pclMsgDef->logID = stMessage.usLogId;
+        pclMsgDef->name = stMessage.sName;
+        pclMsgDef->fieldInfo.emplace(stMessage.uiCrc, stMessage.pclFieldInfo);
+        pclMsgDef->latestMessageCrc = stMessage.uiCrc;
+        vMsgDefs.push_back(std::move(pclMsgDef));
+    }
+    return std::make_shared<MessageDatabase>(std::move(vMsgDefs), std::vector<EnumDefinition::ConstPtr>{});
+}
+
+//! Create the metadata the header decoder would give a body of the message.
+//! \param[in] uiBinaryLength_ The length of a binary body.
+[[nodiscard]] inline MetaDataBase CreateMetaData(const TestMessage& stMessage_, HEADER_FORMAT eFormat_ = HEADER_FORMAT::BINARY,
+                                                 uint32_t uiBinaryLength_ = 0)
+{
+    MetaDataBase stMetaData;
+    stMetaData.eFormat = eFormat_;
+    stMetaData.usMessageId = stMessage_.usLogId;
+    stMetaData.uiMessageCrc = stMessage_.uiCrc;
+    stMetaData.uiBinaryMsgLength = uiBinaryLength_;
+    stMetaData.messageName = stMessage_.sName;
+    return stMetaData;
+}
+
+//! Decode a binary body of the message.
+[[nodiscard]] inline STATUS DecodeBinary(const MessageDecoderBase& clDecoder_, const TestMessage& stMessage_, const std::vector<unsigned char>& vBody_,
+                                         CompositeField& clMessage_)
+{
+    MetaDataBase stMetaData = CreateMetaData(stMessage_, HEADER_FORMAT::BINARY, static_cast<uint32_t>(vBody_.size()));
+    return clDecoder_.Decode(vBody_.data(), clMessage_, stMetaData);
+}
+
+//! Create a variable length array whose length precedes it as 4 bytes in binary bodies.
+[[nodiscard]] inline ArrayField::Ptr MakeVariableArray(std::string sName_, std::string sConversion_, DATA_TYPE eDataType_, uint32_t uiMaxLength_)
+{
+    auto pclField = std::make_shared<ArrayField>(std::move(sName_), FIELD_TYPE::VARIABLE_LENGTH_ARRAY, std::move(sConversion_), eDataType_, uiMaxLength_);
+    pclField->arrayLengthFieldSize = 4;
+    return pclField;
+}
+
+//! Create a field array whose length precedes it as 4 bytes in binary bodies.
+[[nodiscard]] inline FieldArrayField::Ptr MakeFieldArray(std::string sName_, uint32_t uiMaxLength_, std::vector<BaseField::Ptr> vFields_)
+{
+    auto pclField = std::make_shared<FieldArrayField>(std::move(sName_), FIELD_TYPE::FIELD_ARRAY, "", DATA_TYPE::UNKNOWN, uiMaxLength_,
+                                                      BuildFieldInfo(std::move(vFields_)));
+    pclField->arrayLengthFieldSize = 4;
+    return pclField;
+}
+
+//! Append the bytes of a value to a binary body.
+template <typename T> void Append(std::vector<unsigned char>& vBody_, T value_)
+{
+    const size_t uiOffset = vBody_.size();
+    vBody_.resize(uiOffset + sizeof(T));
+    std::memcpy(vBody_.data() + uiOffset, &value_, sizeof(T));
+}
+
+} // namespace novatel::edie::test
@@ -0,0 +1,95 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file json_message_parser_unit_test.cpp
+// ===============================================================================
+
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "novatel_edie/decoders/common/json_message_parser.hpp"
+
+using namespace novatel::edie;
+
+// -------------------------------------------------------------------------------------------------------
+// JsonMessageParser Unit Tests
+// -------------------------------------------------------------------------------------------------------
+TEST(JsonMessageParserTest, PARSE)
+{
+    JsonMessageParser clParser;
+    simdjson::dom::element clRoot;
+
+    ASSERT_EQ(clParser.Parse(R"({"header": {"id": 42}, "body": {"value": 1.5}})", clRoot), simdjson::SUCCESS);
+    int64_t llId;
+    ASSERT_EQ(clRoot["header"]["id"].get(llId), simdjson::SUCCESS);
+    ASSERT_EQ(llId, 42);
+
+    // Larger messages grow the reused buffers
+    std::string sLarge = R"({"body": [)";
+    for (int i = 0; i < 10000; ++i) { sLarge += std::to_string(i) + ","; }
+    sLarge += "0]}";
+    ASSERT_EQ(clParser.Parse(sLarge, clRoot), simdjson::SUCCESS);
+    simdjson::dom::array clArray;
+    ASSERT_EQ(clRoot["body"].get(clArray), simdjson::SUCCESS);
+    ASSERT_EQ(clArray.size(), 10001U);
+
+    // The parse only covers the given length
+    const std::string_view svTruncated = R"({"body": 1}garbage)";
+    ASSERT_EQ(clParser.Parse(svTruncated.substr(0, 11), clRoot), simdjson::SUCCESS);
+    ASSERT_NE(clParser.Parse(R"({"body": )", clRoot), simdjson::SUCCESS);
+}
+
+TEST(JsonMessageParserTest, TAKE_SHARED)
+{
+    JsonMessageParser clParser;
+    simdjson::dom::element clRoot;
+    const std::string sMessage = R"({"header": {"id": 42}, "body": {"value": 1.5}})";
+
+    // Nothing is shared unless requested
+    ASSERT_EQ(clParser.Parse(sMessage, clRoot), simdjson::SUCCESS);
+    ASSERT_FALSE(clParser.TakeShared(sMessage, clRoot));
+
+    // A shared document can only be taken once, and only for the same message
+    ASSERT_EQ(clParser.Parse(sMessage, clRoot, true), simdjson::SUCCESS);
+    const std::string sCopy = sMessage;
+    ASSERT_FALSE(clParser.TakeShared(sCopy, clRoot));
+    ASSERT_FALSE(clParser.TakeShared(std::string_view(sMessage).substr(0, 10), clRoot));
+    simdjson::dom::element clShared;
+    ASSERT_TRUE(clParser.TakeShared(sMessage, clShared));
+    double dValue;
+    ASSERT_EQ(clShared["body"]["value"].get(dValue), simdjson::SUCCESS);
+    ASSERT_DOUBLE_EQ(dValue, 1.5);
+    ASSERT_FALSE(clParser.TakeShared(sMessage, clShared));
+
+    // Any later parse replaces the shared document
+    ASSERT_EQ(clParser.Parse(sMessage, clRoot, true), simdjson::SUCCESS);
+    ASSERT_EQ(clParser.Parse(R"({"body": 2})", clRoot), simdjson::SUCCESS);
+    ASSERT_FALSE(clParser.TakeShared(sMessage, clShared));
+
+    // Failed parses are never shared
+    const std::string sMalformed = R"({"body": )";
+    ASSERT_NE(clParser.Parse(sMalformed, clRoot, true), simdjson::SUCCESS);
+    ASSERT_FALSE(clParser.TakeShared(sMalformed, clShared));
+}
@@ -0,0 +1,168 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file lazy_decode_unit_test.cpp
+// ===============================================================================
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "decoder_test_utils.hpp"
+#include "novatel_edie/decoders/common/message_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::test;
+
+// -------------------------------------------------------------------------------------------------------
+// Lazy Decoding Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class LazyDecodeTest : public ::testing::Test
+{
+  protected:
+    BaseField::Ptr pclU32 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    BaseField::Ptr pclDouble = std::make_shared<BaseField>("d", FIELD_TYPE::SIMPLE, "%lf", DATA_TYPE::DOUBLE);
+    ArrayField::Ptr pclString = std::make_shared<ArrayField>("str", FIELD_TYPE::STRING, "%s", DATA_TYPE::CHAR, 32);
+    ArrayField::Ptr pclValues = std::make_shared<ArrayField>("values", FIELD_TYPE::VARIABLE_LENGTH_ARRAY, "%hu", DATA_TYPE::USHORT, 8);
+    BaseField::Ptr pclSubU32 = std::make_shared<BaseField>("sub_u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    BaseField::Ptr pclSubDouble = std::make_shared<BaseField>("sub_d", FIELD_TYPE::SIMPLE, "%lf", DATA_TYPE::DOUBLE);
+    FieldArrayField::Ptr pclRecords = std::make_shared<FieldArrayField>("records", FIELD_TYPE::FIELD_ARRAY, "", DATA_TYPE::UNKNOWN, 4,
+                                                                        BuildFieldInfo({pclSubU32, pclSubDouble}));
+    BaseField::Ptr pclTail = std::make_shared<BaseField>("tail", FIELD_TYPE::SIMPLE, "%d", DATA_TYPE::INT);
+    FieldInfo::ConstPtr pclFieldInfo = BuildFieldInfo({pclU32, pclDouble, pclString, pclValues, pclRecords, pclTail});
+
+    const TestMessage stMessage{903U, "LAZYMSG", 0x0BADF00DU, pclFieldInfo};
+    MessageDecoderBase clDecoder{"", CreateDatabase({stMessage})};
+
+    //! Expect the values of the message bodies below, through the accessors of T.
+    template <typename T> void ExpectMessageValues(const T& clMessage_, bool bValues_ = true) const
+    {
+        EXPECT_EQ(clMessage_.template GetFieldValue<uint32_t>(*pclU32), 7U);
+        EXPECT_EQ(clMessage_.template GetFieldValue<double>(*pclDouble), 1.5);
+        EXPECT_EQ(clMessage_.template GetFieldValue<std::string>(*pclString), "a,b");
+        if (bValues_) { EXPECT_EQ(clMessage_.template GetFieldValue<std::vector<uint16_t>>(*pclValues), (std::vector<uint16_t>{10, 11, 12})); }
+        const auto clRecords = clMessage_.template GetFieldValue<FieldArray>(*pclRecords);
+        ASSERT_EQ(clRecords.size(), 2U);
+        EXPECT_EQ(clRecords.template GetFieldValue<uint32_t>(*pclSubU32, 1), 2U);
+        EXPECT_EQ(clRecords.template GetFieldValue<double>(*pclSubDouble, 1), 0.25);
+        EXPECT_EQ(clMessage_.template GetFieldValue<int32_t>(*pclTail), -9);
+    }
+};
+
+TEST_F(LazyDecodeTest, ASCII_FIELDS_DECODED_ON_ACCESS)
+{
+    const std::string sBody = "7,1.5,\"a,b\",3,10,11,12,2,1,0.5,2,0.25,-9*12345678\r\n";
+    MetaDataBase stMetaData = CreateMetaData(stMessage, HEADER_FORMAT::ASCII);
+    LazyCompositeField clMessage;
+    ASSERT_EQ(clDecoder.DecodeLazy(reinterpret_cast<const unsigned char*>(sBody.c_str()), clMessage, stMetaData), STATUS::SUCCESS);
+
+    for (const auto& pclField : pclFieldInfo->messageOrderedFields) { EXPECT_FALSE(clMessage.IsFieldDecoded(*pclField)) << pclField->name; }
+
+    EXPECT_EQ(clMessage.GetFieldValue<int32_t>(*pclTail), -9);
+    EXPECT_TRUE(clMessage.IsFieldDecoded(*pclTail));
+    EXPECT_FALSE(clMessage.IsFieldDecoded(*pclDouble));
+    EXPECT_EQ(clMessage.GetFieldValueByName<uint32_t>("u32"), 7U);
+    EXPECT_FALSE(clMessage.IsFieldDecoded(*pclRecords));
+
+    ExpectMessageValues(clMessage);
+    ExpectMessageValues(clMessage.GetCompositeField());
+}
+
+TEST_F(LazyDecodeTest, MATCHES_FULL_DECODE)
+{
+    const std::string sAscii = "7,1.5,\"a,b\",3,10,11,12,2,1,0.5,2,0.25,-9*12345678\r\n";
+    const std::string sAbbAscii = "7 1.5 \"a,b\" 3 10 11 12 2 1 0.5 2 0.25 -9\r\n";
+    const std::string sJson = R"({"header": {}, "body": {"u32": 7, "d": 1.5, "str": "a,b", "records": [{"sub_u32": 1, "sub_d": 0.5}, )"
+                              R"({"sub_u32": 2, "sub_d": 0.25}], "tail": -9}})";
+
+    for (const auto& [eFormat, sBody] : {std::pair{HEADER_FORMAT::ASCII, sAscii}, std::pair{HEADER_FORMAT::ABB_ASCII, sAbbAscii},
+                                         std::pair{HEADER_FORMAT::JSON, sJson}})
+    {
+        const auto* pucBody = reinterpret_cast<const unsigned char*>(sBody.c_str());
+        const bool bValues = eFormat != HEADER_FORMAT::JSON;
+
+        MetaDataBase stMetaData = CreateMetaData(stMessage, eFormat);
+        CompositeField clOwned;
+        ASSERT_EQ(clDecoder.Decode(pucBody, clOwned, stMetaData), STATUS::SUCCESS);
+        ExpectMessageValues(clOwned, bValues);
+
+        stMetaData = CreateMetaData(stMessage, eFormat);
+        LazyCompositeField clLazy;
+        ASSERT_EQ(clDecoder.DecodeLazy(pucBody, clLazy, stMetaData), STATUS::SUCCESS);
+        ExpectMessageValues(clLazy, bValues);
+
+        const CompositeField& clDecoded = clLazy.GetCompositeField();
+        ASSERT_EQ(clDecoded.GetFixedFields().size(), clOwned.GetFixedFields().size());
+        EXPECT_EQ(std::memcmp(clDecoded.GetFixedFields().data(), clOwned.GetFixedFields().data(), clOwned.GetFixedFields().size()), 0);
+    }
+}
+
+TEST_F(LazyDecodeTest, JSON_BODY_KEEPS_ITS_DOCUMENT)
+{
+    const std::string sFirst = R"({"header": {}, "body": {"u32": 7, "d": 1.5, "str": "a,b", "records": [], "tail": -9}})";
+    const std::string sSecond = R"({"header": {}, "body": {"u32": 8, "d": 2.5, "str": "c", "records": [], "tail": -10}})";
+
+    // Without a JSON parser set on the decoder, each message keeps the document of its own body
+    MetaDataBase stMetaData = CreateMetaData(stMessage, HEADER_FORMAT::JSON);
+    LazyCompositeField clFirst;
+    ASSERT_EQ(clDecoder.DecodeLazy(reinterpret_cast<const unsigned char*>(sFirst.c_str()), clFirst, stMetaData), STATUS::SUCCESS);
+    LazyCompositeField clCopy = clFirst;
+
+    stMetaData = CreateMetaData(stMessage, HEADER_FORMAT::JSON);
+    LazyCompositeField clSecond;
+    ASSERT_EQ(clDecoder.DecodeLazy(reinterpret_cast<const unsigned char*>(sSecond.c_str()), clSecond, stMetaData), STATUS::SUCCESS);
+    stMetaData = CreateMetaData(stMessage, HEADER_FORMAT::JSON);
+    ASSERT_EQ(clDecoder.DecodeLazy(reinterpret_cast<const unsigned char*>(sSecond.c_str()), clFirst, stMetaData), STATUS::SUCCESS);
+
+    EXPECT_EQ(clCopy.GetFieldValue<uint32_t>(*pclU32), 7U);
+    EXPECT_EQ(clCopy.GetFieldValue<int32_t>(*pclTail), -9);
+    EXPECT_EQ(clFirst.GetFieldValue<uint32_t>(*pclU32), 8U);
+    EXPECT_EQ(clSecond.GetFieldValue<double>(*pclDouble), 2.5);
+}
+
+TEST_F(LazyDecodeTest, MALFORMED_TOKEN_THROWS_ON_ACCESS)
+{
+    const std::string sBody = "7,x1.5,\"a,b\",3,10,11,12,2,1,0.5,2,0.25,-9*12345678\r\n";
+    MetaDataBase stMetaData = CreateMetaData(stMessage, HEADER_FORMAT::ASCII);
+    CompositeField clOwned;
+    EXPECT_EQ(clDecoder.Decode(reinterpret_cast<const unsigned char*>(sBody.c_str()), clOwned, stMetaData), STATUS::MALFORMED_INPUT);
+
+    LazyCompositeField clMessage;
+    ASSERT_EQ(clDecoder.DecodeLazy(reinterpret_cast<const unsigned char*>(sBody.c_str()), clMessage, stMetaData), STATUS::SUCCESS);
+    EXPECT_EQ(clMessage.GetFieldValue<int32_t>(*pclTail), -9);
+    EXPECT_THROW(static_cast<void>(clMessage.GetFieldValue<double>(*pclDouble)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(clMessage.GetFieldValue<uint32_t>(*pclSubU32)), std::runtime_error);
+}
+
+TEST_F(LazyDecodeTest, EARLY_END_OF_MESSAGE)
+{
+    const std::string sBody = "7,1.5*12345678\r\n";
+    MetaDataBase stMetaData = CreateMetaData(stMessage, HEADER_FORMAT::ASCII);
+    LazyCompositeField clMessage;
+    ASSERT_EQ(clDecoder.DecodeLazy(reinterpret_cast<const unsigned char*>(sBody.c_str()), clMessage, stMetaData), STATUS::SUCCESS);
+    EXPECT_EQ(clMessage.GetFieldValue<double>(*pclDouble), 1.5);
+    EXPECT_EQ(clMessage.GetFieldValue<int32_t>(*pclTail), 0);
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*pclU32), 7U);
+}
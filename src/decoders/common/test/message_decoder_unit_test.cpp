@@ -317,6 +317,30 @@ TEST_F(MessageDecoderTypesTest, ASCII_STRING_VALID)
     }
 }
 
+TEST_F(MessageDecoderTypesTest, ASCII_QUOTED_STRING_WITH_DELIMITERS)
+{
+    // Field delimiters inside a quoted string must neither split it nor hide the end of the message after it
+    MsgDefFields.emplace_back(std::make_shared<BaseField>("MESSAGE", FIELD_TYPE::STRING, "%s", DATA_TYPE::UNKNOWN));
+    MsgDefFields.emplace_back(std::make_shared<BaseField>("VALUE", FIELD_TYPE::SIMPLE, "%lu", DATA_TYPE::ULONG));
+
+    FieldInfo fieldInfo;
+    std::vector<BaseField::ConstPtr> constFields(MsgDefFields.begin(), MsgDefFields.end());
+    fieldInfo.messageOrderedFields = constFields;
+    fieldInfo.varFieldCount = 1;
+
+    CompositeField vIntermediateFormat(4, 1);
+    const auto* testInput = "\"x,y z\",42*12345678\r\n";
+    ASSERT_EQ(pclMyDecoderTester->TestDecodeAscii(fieldInfo, &testInput, vIntermediateFormat), STATUS::SUCCESS);
+    ASSERT_EQ(std::get<std::string>(vIntermediateFormat.GetVarFields()[0]), "x,y z");
+    ASSERT_EQ(std::get<uint32_t>(vIntermediateFormat.GetFieldValueVariant(*MsgDefFields[1])), 42U);
+
+    CompositeField vEarlyEndFormat(4, 1);
+    testInput = "\"x,y z\"*12345678\r\n";
+    ASSERT_EQ(pclMyDecoderTester->TestDecodeAscii(fieldInfo, &testInput, vEarlyEndFormat), STATUS::SUCCESS);
+    ASSERT_EQ(std::get<std::string>(vEarlyEndFormat.GetVarFields()[0]), "x,y z");
+    ASSERT_EQ(std::get<uint32_t>(vEarlyEndFormat.GetFieldValueVariant(*MsgDefFields[1])), 0U);
+}
+
 TEST_F(MessageDecoderTypesTest, ASCII_TYPE_INVALID)
 {
     MsgDefFields.emplace_back(std::make_shared<BaseField>("", FIELD_TYPE::UNKNOWN, "%d", DATA_TYPE::UNKNOWN));
@@ -598,11 +622,11 @@ TEST(MessageDecoderContainerTypesTest, MessageBodyIteratorTraversesFieldValuesIn
     ++it;
     fieldValue = *it;
     EXPECT_EQ(fieldValue.first, f1);
-    EXPECT_EQ(std::get<std::string>(fieldValue.second), "ok");
+    EXPECT_EQ(std::get<std::string_view>(fieldValue.second), "ok");
     ++it;
     fieldValue = *it;
     EXPECT_EQ(fieldValue.first, f2);
-    const auto nestedArray = std::get<CompositeFieldArray>(fieldValue.second);
+    const auto nestedArray = std::get<FieldArray>(fieldValue.second);
     EXPECT_EQ(nestedArray.size(), 1U);
     const auto& nestedBodyValue = nestedArray[0];
     EXPECT_EQ(nestedBodyValue.GetFieldValue<uint32_t>(*f0Copy), 5678U);
@@ -652,15 +676,15 @@ TEST(MessageDecoderContainerTypesTest, DecodeFromMessageDatabaseAndIterateMessag
     ++it;
     fieldValue = *it;
     EXPECT_EQ(fieldValue.first, f1);
-    EXPECT_EQ(std::get<std::string>(fieldValue.second), "ok");
+    EXPECT_EQ(std::get<std::string_view>(fieldValue.second), "ok");
     ++it;
 
     fieldValue = *it;
     EXPECT_EQ(fieldValue.first, f2);
-    const auto nestedArray = std::get<CompositeFieldArray>(fieldValue.second);
+    const auto nestedArray = std::get<FieldArray>(fieldValue.second);
     ASSERT_EQ(nestedArray.size(), 1U);
 
-    const CompositeField& nestedBody = nestedArray.front();
+    const FieldArrayRecordView nestedBody = nestedArray[0];
     auto nestedIt = nestedBody.begin();
     auto nestedFieldValue = *nestedIt;
     EXPECT_EQ(nestedFieldValue.first->name, f0Nested->name);
@@ -668,7 +692,7 @@ TEST(MessageDecoderContainerTypesTest, DecodeFromMessageDatabaseAndIterateMessag
     ++nestedIt;
     nestedFieldValue = *nestedIt;
     EXPECT_EQ(nestedFieldValue.first->name, f1Nested->name);
-    EXPECT_EQ(std::get<std::string>(nestedFieldValue.second), "nested");
+    EXPECT_EQ(std::get<std::string_view>(nestedFieldValue.second), "nested");
     ++nestedIt;
     EXPECT_EQ(nestedIt, nestedBody.end());
 
@@ -676,6 +700,53 @@ TEST(MessageDecoderContainerTypesTest, DecodeFromMessageDatabaseAndIterateMessag
     EXPECT_EQ(it, decoded.end());
 }
 
+TEST(MessageDecoderContainerTypesTest, GetFieldValueViewDoesNotCopy)
+{
+    auto f0 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    auto f1 = std::make_shared<ArrayField>("fixed", FIELD_TYPE::FIXED_LENGTH_ARRAY, "%hd", DATA_TYPE::SHORT, 2);
+    auto f2 = std::make_shared<ArrayField>("var", FIELD_TYPE::VARIABLE_LENGTH_ARRAY, "%lf", DATA_TYPE::DOUBLE, 4);
+    auto f3 = std::make_shared<BaseField>("str", FIELD_TYPE::STRING, "%s", DATA_TYPE::UNKNOWN);
+    auto nestedU32 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    auto nestedFixed = std::make_shared<ArrayField>("fixed", FIELD_TYPE::FIXED_LENGTH_ARRAY, "%hd", DATA_TYPE::SHORT, 2);
+    const auto nestedFieldInfo = BuildFieldInfo({nestedU32, nestedFixed});
+    auto f4 = std::make_shared<FieldArrayField>("fa", FIELD_TYPE::FIELD_ARRAY, "", DATA_TYPE::UNKNOWN, 2, nestedFieldInfo);
+    const auto fieldInfo = BuildFieldInfo({f0, f1, f2, f3, f4});
+
+    CompositeField body(fieldInfo);
+    const int16_t fixedValues[2] = {-1, 2};
+    body.SetFieldValue(*f0, 7U);
+    body.SetFieldValue<true>(f1->index, fixedValues, 2);
+    body.SetFieldValue(*f2, std::vector<double>{0.5, 1.5, 2.5});
+    body.SetFieldValue(*f3, std::string("station"));
+    FlatFieldArray records(2, nestedFieldInfo.get());
+    records.SetFieldValue<uint32_t>(1, *nestedU32, 22U);
+    records.SetFieldValue(1, *nestedFixed, std::vector<int16_t>{3, -4});
+    body.SetFieldValue(*f4, records);
+
+    EXPECT_EQ(std::get<uint32_t>(body.GetFieldValueView(*f0)), 7U);
+    const auto fixedView = std::get<TypedBuffer<int16_t>>(body.GetFieldValueView(*f1));
+    ASSERT_EQ(fixedView.size(), 2U);
+    EXPECT_EQ(fixedView[0], -1);
+
+    // The views refer to the storage of the message
+    const auto varView = std::get<TypedBuffer<double>>(body.GetFieldValueView(*f2));
+    ASSERT_EQ(varView.size(), 3U);
+    EXPECT_EQ(varView[2], 2.5);
+    const auto strView = std::get<std::string_view>(body.GetFieldValueView(*f3));
+    EXPECT_EQ(strView, "station");
+    EXPECT_EQ(strView.data(), std::get<std::string>(body.GetVarFields()[f3->index]).data());
+    EXPECT_EQ(reinterpret_cast<const double*>(varView.data()), std::get<std::vector<double>>(body.GetVarFields()[f2->index]).data());
+
+    const auto fieldArray = std::get<FieldArray>(body.GetFieldValueView(*f4));
+    ASSERT_EQ(fieldArray.size(), 2U);
+    EXPECT_EQ(fieldArray.GetFieldInfo(), nestedFieldInfo.get());
+    std::vector<std::string> names;
+    for (const auto& [field, value] : fieldArray[1]) { names.push_back(field->name); }
+    EXPECT_EQ(names, (std::vector<std::string>{"u32", "fixed"}));
+    EXPECT_EQ(std::get<uint32_t>(fieldArray[1].GetFieldValueView(*nestedU32)), 22U);
+    EXPECT_EQ(std::get<TypedBuffer<int16_t>>(fieldArray[1].GetFieldValueView(*nestedFixed))[1], -4);
+}
+
 TEST(MessageDecoderContainerTypesTest, MessageBodyIteratorRequiresFieldInfo)
 {
     CompositeField body;
@@ -720,3 +791,139 @@ TEST(MessageDecoderContainerTypesTest, FlatFieldArrayRecordViewGetFieldValueByNa
     const auto arr2 = ffa[1].GetFieldValueByName<TypedBuffer<uint8_t>>("arr");
     for (size_t i = 0; i < twentyStr.size(); i++) { EXPECT_EQ(arr2[i], static_cast<uint8_t>(twentyStr[i])); }
 }
+
+TEST(MessageDecoderContainerTypesTest, FieldInfoGetFieldDefByNameAfterFieldsReplaced)
+{
+    auto f0 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    auto f1 = std::make_shared<BaseField>("i16", FIELD_TYPE::SIMPLE, "%hd", DATA_TYPE::SHORT);
+
+    FieldInfo fieldInfo;
+    fieldInfo.messageOrderedFields = {f0};
+    EXPECT_EQ(fieldInfo.GetFieldDefByName("u32"), f0);
+    EXPECT_EQ(fieldInfo.GetFieldDefByName("i16"), nullptr);
+
+    // The cached index is stale until InvalidateCaches(), but lookups must not use it blindly
+    fieldInfo.messageOrderedFields = {f1, f0};
+    EXPECT_EQ(fieldInfo.GetFieldDefByName("u32"), f0);
+    EXPECT_EQ(fieldInfo.GetFieldDefByName("i16"), f1);
+    EXPECT_FALSE(fieldInfo.GetFieldHandle("error"));
+
+    fieldInfo.messageOrderedFields = {f1};
+    EXPECT_EQ(fieldInfo.GetFieldDefByName("u32"), nullptr);
+    EXPECT_EQ(fieldInfo.GetFieldDefByName("i16"), f1);
+
+    fieldInfo.messageOrderedFields = {f0, f1};
+    fieldInfo.InvalidateCaches();
+    EXPECT_EQ(fieldInfo.GetFieldDefByName("u32"), f0);
+    EXPECT_EQ(fieldInfo.GetFieldDefByName("i16"), f1);
+}
+
+TEST(MessageDecoderContainerTypesTest, CompositeFieldGetFieldValueByHandle)
+{
+    auto f0 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    auto f1 = std::make_shared<ArrayField>("arr", FIELD_TYPE::FIXED_LENGTH_ARRAY, "%hd", DATA_TYPE::SHORT, 3);
+    auto f2 = std::make_shared<BaseField>("str", FIELD_TYPE::STRING, "%s", DATA_TYPE::UNKNOWN);
+    const auto fieldInfo = BuildFieldInfo({f0, f1, f2});
+
+    const FieldHandle u32Handle = fieldInfo->GetFieldHandle("u32");
+    const FieldHandle arrHandle = fieldInfo->GetFieldHandle("arr");
+    const FieldHandle strHandle = fieldInfo->GetFieldHandle("str");
+    ASSERT_TRUE(u32Handle && arrHandle && strHandle);
+    EXPECT_TRUE(arrHandle.IsFixed());
+    EXPECT_EQ(arrHandle.arrayLength, 3U);
+    EXPECT_FALSE(strHandle.IsFixed());
+
+    CompositeField stMessage(fieldInfo);
+    const int16_t values[3] = {-1, 2, -3};
+    stMessage.SetFieldValue(*f0, uint32_t{10});
+    stMessage.SetFieldValue<true>(f1->index, values, 3);
+    stMessage.SetFieldValue(*f2, std::string("ten"));
+
+    EXPECT_EQ(stMessage.GetFieldValue<uint32_t>(u32Handle), 10U);
+    EXPECT_EQ(stMessage.GetFieldValue<int16_t>(arrHandle, 2), -3);
+    EXPECT_EQ(stMessage.GetFieldValue<std::string>(strHandle), "ten");
+    EXPECT_THROW((void)stMessage.GetFieldValue<int16_t>(arrHandle, 3), std::runtime_error);
+    EXPECT_THROW((void)stMessage.GetFieldValue<uint32_t>(u32Handle, 1), std::runtime_error);
+    EXPECT_THROW((void)stMessage.GetFieldValue<uint32_t>(FieldHandle{}), std::runtime_error);
+}
+
+TEST(MessageDecoderContainerTypesTest, FieldArrayGetFieldValueByHandle)
+{
+    auto nestedU32 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    auto nestedI16 = std::make_shared<BaseField>("i16", FIELD_TYPE::SIMPLE, "%hd", DATA_TYPE::SHORT);
+    const auto nestedFieldInfo = BuildFieldInfo({nestedU32, nestedI16});
+
+    auto fieldArrayField = std::make_shared<FieldArrayField>("fa", FIELD_TYPE::FIELD_ARRAY, "", DATA_TYPE::UNKNOWN, 2, nestedFieldInfo);
+    const auto rootFieldInfo = BuildFieldInfo({fieldArrayField});
+
+    FlatFieldArray stored(2, nestedFieldInfo.get());
+    stored.SetFieldValue<uint32_t>(0, *nestedU32, 11U);
+    stored.SetFieldValue<int16_t>(0, *nestedI16, static_cast<int16_t>(-7));
+    stored.SetFieldValue<uint32_t>(1, *nestedU32, 22U);
+    stored.SetFieldValue<int16_t>(1, *nestedI16, static_cast<int16_t>(9));
+
+    const FieldHandle u32Handle = nestedFieldInfo->GetFieldHandle("u32");
+    const FieldHandle i16Handle = nestedFieldInfo->GetFieldHandle("i16");
+    EXPECT_EQ(stored.GetFieldValue<uint32_t>(u32Handle, 1), 22U);
+    EXPECT_EQ(stored.GetFieldValue<int16_t>(i16Handle, 0), static_cast<int16_t>(-7));
+
+    CompositeField body(rootFieldInfo);
+    body.SetFieldValue(*fieldArrayField, stored);
+
+    const auto wrapped = body.GetFieldValue<FieldArray>(*fieldArrayField);
+    EXPECT_EQ(wrapped.GetFieldValue<uint32_t>(u32Handle, 0), 11U);
+    EXPECT_EQ(wrapped[1].GetFieldValue<int16_t>(i16Handle), static_cast<int16_t>(9));
+
+    CompositeField row(nestedFieldInfo);
+    row.SetFieldValue(*nestedU32, 33U);
+    row.SetFieldValue(*nestedI16, static_cast<int16_t>(-3));
+    body.SetFieldValue(*fieldArrayField, CompositeFieldArray{row});
+
+    const auto composite = body.GetFieldValue<FieldArray>(*fieldArrayField);
+    EXPECT_EQ(composite.GetFieldValue<uint32_t>(u32Handle, 0), 33U);
+    EXPECT_EQ(composite[0].GetFieldValue<int16_t>(i16Handle), static_cast<int16_t>(-3));
+}
+
+TEST(MessageDecoderJsonTest, SharedParse)
+{
+    const auto pclDb = ParseJsonDb(R"({
+        "enums": [
+            {"name": "Responses", "_id": "0", "enumerators": []},
+            {"name": "Commands", "_id": "0", "enumerators": []},
+            {"name": "PortAddress", "_id": "0", "enumerators": []},
+            {"name": "GPSTimeStatus", "_id": "0", "enumerators": []}
+        ],
+        "messages": [{
+            "_id": "0", "messageID": 42, "name": "JSONTEST", "description": "", "latestMsgDefCrc": "0",
+            "fields": {"0": [
+                {"name": "value", "description": "", "type": "SIMPLE", "dataType": {"name": "DOUBLE", "length": 8, "description": ""}, "conversionString": "%lf"},
+                {"name": "count", "description": "", "type": "SIMPLE", "dataType": {"name": "ULONG", "length": 4, "description": ""}, "conversionString": "%lu"}
+            ]}
+        }]
+    })");
+    MessageDecoderBase clDecoder("OEM", pclDb);
+    constexpr char szMessage[] = R"({"header": {"id": 42}, "body": {"value": 1.5, "count": 7}})";
+    const auto* pucMessage = reinterpret_cast<const unsigned char*>(szMessage);
+
+    MetaDataBase stMetaData;
+    stMetaData.eFormat = HEADER_FORMAT::JSON;
+    stMetaData.usMessageId = 42;
+
+    // Without a parser set the decoder parses each message with a parser of its own
+    ASSERT_EQ(clDecoder.GetJsonParser(), nullptr);
+    CompositeField stMessage;
+    ASSERT_EQ(clDecoder.Decode(pucMessage, stMessage, stMetaData), STATUS::SUCCESS);
+    ASSERT_DOUBLE_EQ(stMessage.GetFieldValueByName<double>("value"), 1.5);
+    ASSERT_EQ(stMessage.GetFieldValueByName<uint32_t>("count"), 7U);
+
+    // A document shared by a header decoder is decoded without parsing the message again, and only once
+    clDecoder.SetJsonParser(std::make_shared<JsonMessageParser>());
+    ASSERT_EQ(clDecoder.Decode(pucMessage, stMessage, stMetaData), STATUS::SUCCESS);
+    simdjson::dom::element clRoot;
+    ASSERT_EQ(clDecoder.GetJsonParser()->Parse(szMessage, clRoot, true), simdjson::SUCCESS);
+    CompositeField stSharedMessage;
+    ASSERT_EQ(clDecoder.Decode(pucMessage, stSharedMessage, stMetaData), STATUS::SUCCESS);
+    ASSERT_DOUBLE_EQ(stSharedMessage.GetFieldValueByName<double>("value"), 1.5);
+    ASSERT_EQ(stSharedMessage.GetFieldValueByName<uint32_t>("count"), 7U);
+    ASSERT_FALSE(clDecoder.GetJsonParser()->TakeShared(szMessage, clRoot));
+}
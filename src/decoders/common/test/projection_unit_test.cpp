@@ -0,0 +1,217 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file projection_unit_test.cpp
+// ===============================================================================
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "decoder_test_utils.hpp"
+#include "novatel_edie/decoders/common/message_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::test;
+
+// -------------------------------------------------------------------------------------------------------
+// Projection Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class ProjectionTest : public ::testing::Test
+{
+  protected:
+    BaseField::Ptr pclU32 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    BaseField::Ptr pclDouble = std::make_shared<BaseField>("d", FIELD_TYPE::SIMPLE, "%lf", DATA_TYPE::DOUBLE);
+    ArrayField::Ptr pclValues = MakeVariableArray("values", "%hu", DATA_TYPE::USHORT, 8);
+    BaseField::Ptr pclSubU32 = std::make_shared<BaseField>("sub_u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    ArrayField::Ptr pclSubValues = MakeVariableArray("sub_values", "%hu", DATA_TYPE::USHORT, 8);
+    FieldArrayField::Ptr pclRecords = MakeFieldArray("records", 4, {pclSubU32, pclSubValues});
+    BaseField::Ptr pclTail = std::make_shared<BaseField>("tail", FIELD_TYPE::SIMPLE, "%d", DATA_TYPE::INT);
+    FieldInfo::ConstPtr pclFieldInfo = BuildFieldInfo({pclU32, pclDouble, pclValues, pclRecords, pclTail});
+
+    const TestMessage stMessage{904U, "PROJMSG", 0x12345678U, pclFieldInfo};
+
+    //! Create a database holding PROJMSG with the given fields.
+    [[nodiscard]] MessageDatabase::Ptr CreateDatabase(const FieldInfo::ConstPtr& pclFieldInfo_) const
+    {
+        return test::CreateDatabase({{stMessage.usLogId, stMessage.sName, stMessage.uiCrc, pclFieldInfo_}});
+    }
+
+    // A PROJMSG with three values and two records holding one and two values
+    [[nodiscard]] static std::vector<unsigned char> CreateBinaryMessage()
+    {
+        std::vector<unsigned char> vMessage;
+        Append<uint32_t>(vMessage, 7);
+        Append<double>(vMessage, 1.5);
+        Append<uint32_t>(vMessage, 3);
+        for (uint16_t usValue : {10, 11, 12}) { Append<uint16_t>(vMessage, usValue); }
+        Append<uint32_t>(vMessage, 2);
+        Append<uint32_t>(vMessage, 1);
+        Append<uint32_t>(vMessage, 1);
+        Append<uint16_t>(vMessage, 20);
+        Append<uint32_t>(vMessage, 2);
+        Append<uint32_t>(vMessage, 2);
+        for (uint16_t usValue : {21, 22}) { Append<uint16_t>(vMessage, usValue); }
+        Append<int32_t>(vMessage, -9);
+        return vMessage;
+    }
+
+    [[nodiscard]] STATUS Decode(const MessageDecoderBase& clDecoder_, HEADER_FORMAT eFormat_, const unsigned char* pucMessage_,
+                                uint32_t uiLength_, CompositeField& clMessage_) const
+    {
+        MetaDataBase stMetaData = CreateMetaData(stMessage, eFormat_, uiLength_);
+        return clDecoder_.Decode(pucMessage_, clMessage_, stMetaData);
+    }
+
+    [[nodiscard]] STATUS Decode(const MessageDecoderBase& clDecoder_, const std::vector<unsigned char>& vMessage_, CompositeField& clMessage_) const
+    {
+        return DecodeBinary(clDecoder_, stMessage, vMessage_, clMessage_);
+    }
+
+    [[nodiscard]] STATUS Decode(const MessageDecoderBase& clDecoder_, HEADER_FORMAT eFormat_, const std::string& sMessage_,
+                                CompositeField& clMessage_) const
+    {
+        return Decode(clDecoder_, eFormat_, reinterpret_cast<const unsigned char*>(sMessage_.c_str()), 0, clMessage_);
+    }
+
+    //! Expect the projection of {"d", "tail"} of the message bodies below.
+    void ExpectProjectedValues(const CompositeField& clMessage_) const
+    {
+        EXPECT_TRUE(clMessage_.IsFieldPresent(*pclDouble));
+        EXPECT_TRUE(clMessage_.IsFieldPresent(*pclTail));
+        EXPECT_FALSE(clMessage_.IsFieldPresent(*pclU32));
+        EXPECT_FALSE(clMessage_.IsFieldPresent(*pclValues));
+        EXPECT_FALSE(clMessage_.IsFieldPresent(*pclRecords));
+
+        EXPECT_EQ(clMessage_.GetFieldValue<double>(*pclDouble), 1.5);
+        EXPECT_EQ(clMessage_.GetFieldValue<int32_t>(*pclTail), -9);
+        EXPECT_EQ(clMessage_.GetFieldValue<uint32_t>(*pclU32), 0U);
+        EXPECT_EQ(clMessage_.GetFieldSize(*pclValues), 0U);
+        EXPECT_EQ(clMessage_.GetFieldValue<FieldArray>(*pclRecords).size(), 0U);
+    }
+};
+
+TEST_F(ProjectionTest, BINARY_SKIPS_UNPROJECTED_FIELDS)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase(pclFieldInfo));
+    const std::vector<unsigned char> vMessage = CreateBinaryMessage();
+
+    CompositeField clMessage;
+    ASSERT_EQ(Decode(clDecoder, vMessage, clMessage), STATUS::SUCCESS);
+    for (const auto& pclField : pclFieldInfo->messageOrderedFields) { EXPECT_TRUE(clMessage.IsFieldPresent(*pclField)) << pclField->name; }
+
+    clDecoder.SetProjection("PROJMSG", {"d", "tail"});
+    ASSERT_EQ(Decode(clDecoder, vMessage, clMessage), STATUS::SUCCESS);
+    ExpectProjectedValues(clMessage);
+
+    // A projection of the records walks past them to the fields that follow
+    clDecoder.SetProjection("PROJMSG", {"records"});
+    ASSERT_EQ(Decode(clDecoder, vMessage, clMessage), STATUS::SUCCESS);
+    const auto clRecords = clMessage.GetFieldValue<FieldArray>(*pclRecords);
+    ASSERT_EQ(clRecords.size(), 2U);
+    EXPECT_EQ(clRecords[1].GetFieldValue<std::vector<uint16_t>>(*pclSubValues), (std::vector<uint16_t>{21, 22}));
+    EXPECT_FALSE(clMessage.IsFieldPresent(*pclTail));
+
+    clDecoder.ClearProjections();
+    ASSERT_EQ(Decode(clDecoder, vMessage, clMessage), STATUS::SUCCESS);
+    EXPECT_TRUE(clMessage.IsFieldPresent(*pclValues));
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*pclU32), 7U);
+    EXPECT_EQ(clMessage.GetFieldValue<int32_t>(*pclTail), -9);
+}
+
+TEST_F(ProjectionTest, TEXT_FORMATS_SKIP_UNPROJECTED_TOKENS)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase(pclFieldInfo));
+    clDecoder.SetProjection("PROJMSG", {"d", "tail"});
+
+    // The unprojected values are not valid numbers, so the message decodes only if they are skipped unparsed
+    const std::string sAscii = "x7,1.5,3,10,x11,12,2,1,1,20,2,2,21,x22,-9*12345678\r\n";
+    const std::string sAbbAscii = "x7 1.5 3 10 x11 12 2 1 1 20 2 2 21 x22 -9\r\n";
+    const std::string sJson = R"({"header": {}, "body": {"u32": "x7", "d": 1.5, "records": "x", "tail": -9}})";
+
+    for (const auto& [eFormat, sMessage] : {std::pair{HEADER_FORMAT::ASCII, sAscii}, std::pair{HEADER_FORMAT::ABB_ASCII, sAbbAscii},
+                                            std::pair{HEADER_FORMAT::JSON, sJson}})
+    {
+        CompositeField clMessage;
+        ASSERT_EQ(Decode(clDecoder, eFormat, sMessage, clMessage), STATUS::SUCCESS);
+        ExpectProjectedValues(clMessage);
+
+        clDecoder.ClearProjections();
+        EXPECT_EQ(Decode(clDecoder, eFormat, sMessage, clMessage), STATUS::MALFORMED_INPUT);
+        clDecoder.SetProjection("PROJMSG", {"d", "tail"});
+    }
+}
+
+TEST_F(ProjectionTest, ARRAY_LENGTH_REFERENCE_KEPT)
+{
+    BaseField::Ptr pclCount = std::make_shared<BaseField>("count", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    ArrayField::Ptr pclRefValues = std::make_shared<ArrayField>("ref_values", FIELD_TYPE::VARIABLE_LENGTH_ARRAY, "%hu", DATA_TYPE::USHORT, 8);
+    pclRefValues->arrayLengthRef = "count";
+    BaseField::Ptr pclLast = std::make_shared<BaseField>("last", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    const FieldInfo::ConstPtr pclRefFieldInfo = BuildFieldInfo({pclCount, pclRefValues, pclLast});
+
+    MessageDecoderBase clDecoder("", CreateDatabase(pclRefFieldInfo));
+    clDecoder.SetProjection("PROJMSG", {"last"});
+
+    std::vector<unsigned char> vMessage;
+    Append<uint32_t>(vMessage, 2);
+    for (uint16_t usValue : {30, 31}) { Append<uint16_t>(vMessage, usValue); }
+    Append<uint32_t>(vMessage, 32);
+
+    CompositeField clMessage;
+    ASSERT_EQ(Decode(clDecoder, vMessage, clMessage), STATUS::SUCCESS);
+    EXPECT_TRUE(clMessage.IsFieldPresent(*pclCount));
+    EXPECT_FALSE(clMessage.IsFieldPresent(*pclRefValues));
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*pclLast), 32U);
+}
+
+TEST_F(ProjectionTest, MESSAGE_ADDED_AFTER_PROJECTION)
+{
+    // The projected message is added to the database after the decoder bound its plans
+    const auto pclDatabase = std::make_shared<MessageDatabase>();
+    MessageDecoderBase clDecoder("", pclDatabase);
+    clDecoder.SetProjection("PROJMSG", {"d", "tail"});
+    pclDatabase->AppendMessages(CreateDatabase(pclFieldInfo)->MessageDefinitions());
+    const FieldInfo& stAppended = *pclDatabase->GetMsgDef("PROJMSG")->fieldInfo.at(stMessage.uiCrc);
+
+    const std::vector<unsigned char> vMessage = CreateBinaryMessage();
+    CompositeField clMessage;
+    ASSERT_EQ(Decode(clDecoder, vMessage, clMessage), STATUS::SUCCESS);
+    EXPECT_TRUE(clMessage.IsFieldPresent(*stAppended.GetFieldDefByName("d")));
+    EXPECT_TRUE(clMessage.IsFieldPresent(*stAppended.GetFieldDefByName("tail")));
+    EXPECT_FALSE(clMessage.IsFieldPresent(*stAppended.GetFieldDefByName("u32")));
+    EXPECT_FALSE(clMessage.IsFieldPresent(*stAppended.GetFieldDefByName("values")));
+    EXPECT_EQ(clMessage.GetFieldValue<double>(*stAppended.GetFieldDefByName("d")), 1.5);
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*stAppended.GetFieldDefByName("u32")), 0U);
+
+    clDecoder.ClearProjections();
+    ASSERT_EQ(Decode(clDecoder, vMessage, clMessage), STATUS::SUCCESS);
+    EXPECT_TRUE(clMessage.IsFieldPresent(*stAppended.GetFieldDefByName("u32")));
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*stAppended.GetFieldDefByName("u32")), 7U);
+
+    // and once the projection is set again
+    clDecoder.SetProjection("PROJMSG", {"u32"});
+    ASSERT_EQ(Decode(clDecoder, vMessage, clMessage), STATUS::SUCCESS);
+    EXPECT_TRUE(clMessage.IsFieldPresent(*stAppended.GetFieldDefByName("u32")));
+    EXPECT_FALSE(clMessage.IsFieldPresent(*stAppended.GetFieldDefByName("tail")));
+}
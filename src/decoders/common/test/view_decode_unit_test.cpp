@@ -0,0 +1,209 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file view_decode_unit_test.cpp
+// ===============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "decoder_test_utils.hpp"
+#include "novatel_edie/decoders/common/message_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::test;
+
+// -------------------------------------------------------------------------------------------------------
+// View Decoding Unit Tests
+// -------------------------------------------------------------------------------------------------------
+class ViewDecodeTest : public ::testing::Test
+{
+  protected:
+    BaseField::Ptr pclU32 = std::make_shared<BaseField>("u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    ArrayField::Ptr pclValues = MakeVariableArray("values", "%hu", DATA_TYPE::USHORT, 8);
+    BaseField::Ptr pclRowA = std::make_shared<BaseField>("row_a", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    BaseField::Ptr pclRowB = std::make_shared<BaseField>("row_b", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    FieldArrayField::Ptr pclFlat = MakeFieldArray("flat", 4, {pclRowA, pclRowB});
+    BaseField::Ptr pclSubU32 = std::make_shared<BaseField>("sub_u32", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    ArrayField::Ptr pclSubValues = MakeVariableArray("sub_values", "%hu", DATA_TYPE::USHORT, 8);
+    FieldArrayField::Ptr pclRecords = MakeFieldArray("records", 4, {pclSubU32, pclSubValues});
+    FieldInfo::ConstPtr pclFieldInfo = BuildFieldInfo({pclU32, pclValues, pclFlat, pclRecords});
+
+    BaseField::Ptr pclFixedA = std::make_shared<BaseField>("a", FIELD_TYPE::SIMPLE, "%u", DATA_TYPE::UINT);
+    BaseField::Ptr pclFixedB = std::make_shared<BaseField>("b", FIELD_TYPE::SIMPLE, "%lf", DATA_TYPE::DOUBLE);
+    FieldInfo::ConstPtr pclFixedFieldInfo = BuildFieldInfo({pclFixedA, pclFixedB});
+
+    const TestMessage stMessage{901U, "VIEWMSG", 0x11223344U, pclFieldInfo};
+    const TestMessage stFixedMessage{902U, "VIEWFIXED", 0x55667788U, pclFixedFieldInfo};
+
+    [[nodiscard]] MessageDatabase::Ptr CreateDatabase() const { return test::CreateDatabase({stMessage, stFixedMessage}); }
+
+    // A VIEWMSG with three values, two flat rows and one record holding two values
+    [[nodiscard]] static std::vector<unsigned char> CreateMessage()
+    {
+        std::vector<unsigned char> vMessage;
+        Append<uint32_t>(vMessage, 7);
+        Append<uint32_t>(vMessage, 3);
+        for (uint16_t usValue : {10, 11, 12}) { Append<uint16_t>(vMessage, usValue); }
+        Append<uint32_t>(vMessage, 2);
+        for (uint32_t uiValue : {20, 21, 22, 23}) { Append<uint32_t>(vMessage, uiValue); }
+        Append<uint32_t>(vMessage, 1);
+        Append<uint32_t>(vMessage, 30);
+        Append<uint32_t>(vMessage, 2);
+        for (uint16_t usValue : {31, 32}) { Append<uint16_t>(vMessage, usValue); }
+        return vMessage;
+    }
+
+    [[nodiscard]] static std::vector<unsigned char> CreateFixedMessage()
+    {
+        std::vector<unsigned char> vMessage;
+        Append<uint32_t>(vMessage, 40);
+        Append<double>(vMessage, 4.5);
+        return vMessage;
+    }
+
+    //! Expect the decoded VIEWMSG to hold the values of CreateMessage(), however it is stored.
+    void ExpectMessageValues(const CompositeField& clMessage_) const
+    {
+        EXPECT_EQ(clMessage_.GetFieldValue<uint32_t>(*pclU32), 7U);
+        EXPECT_EQ(clMessage_.GetFieldSize(*pclValues), 3U);
+        EXPECT_EQ(clMessage_.GetFieldValue<uint16_t>(*pclValues, 2), 12U);
+        EXPECT_EQ(clMessage_.GetFieldValue<std::vector<uint16_t>>(*pclValues), (std::vector<uint16_t>{10, 11, 12}));
+
+        const auto& clFlat = std::get<FlatFieldArray>(clMessage_.GetVarFields()[pclFlat->index]);
+        ASSERT_EQ(clFlat.size(), 2U);
+        EXPECT_EQ(clFlat.GetFieldValue<uint32_t>(*pclRowB, 1), 23U);
+
+        const auto& vRecords = std::get<CompositeFieldArray>(clMessage_.GetVarFields()[pclRecords->index]);
+        ASSERT_EQ(vRecords.size(), 1U);
+        EXPECT_EQ(vRecords[0].GetFieldValue<uint32_t>(*pclSubU32), 30U);
+        EXPECT_EQ(vRecords[0].GetFieldValue<std::vector<uint16_t>>(*pclSubValues), (std::vector<uint16_t>{31, 32}));
+    }
+};
+
+TEST_F(ViewDecodeTest, OWNED_BY_DEFAULT)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase());
+    EXPECT_FALSE(clDecoder.GetViewDecoding());
+
+    const std::vector<unsigned char> vMessage = CreateMessage();
+    CompositeField clMessage;
+    ASSERT_EQ(DecodeBinary(clDecoder, stMessage, vMessage, clMessage), STATUS::SUCCESS);
+    EXPECT_FALSE(clMessage.IsView());
+    EXPECT_TRUE(std::holds_alternative<std::vector<uint16_t>>(clMessage.GetVarFields()[pclValues->index]));
+    ExpectMessageValues(clMessage);
+}
+
+TEST_F(ViewDecodeTest, FIXED_FIELDS_BORROWED)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase());
+    clDecoder.SetViewDecoding(true);
+
+    const std::vector<unsigned char> vMessage = CreateFixedMessage();
+    CompositeField clMessage;
+    ASSERT_EQ(DecodeBinary(clDecoder, stFixedMessage, vMessage, clMessage), STATUS::SUCCESS);
+    EXPECT_TRUE(clMessage.IsView());
+    EXPECT_EQ(clMessage.GetFixedFields().data(), reinterpret_cast<const std::byte*>(vMessage.data()));
+    EXPECT_EQ(clMessage.GetFieldValue<uint32_t>(*pclFixedA), 40U);
+    EXPECT_EQ(clMessage.GetFieldValue<double>(*pclFixedB), 4.5);
+}
+
+TEST_F(ViewDecodeTest, ARRAYS_BORROWED)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase());
+    clDecoder.SetViewDecoding(true);
+
+    const std::vector<unsigned char> vMessage = CreateMessage();
+    const auto* pucMessage = reinterpret_cast<const std::byte*>(vMessage.data());
+    CompositeField clMessage;
+    ASSERT_EQ(DecodeBinary(clDecoder, stMessage, vMessage, clMessage), STATUS::SUCCESS);
+    EXPECT_TRUE(clMessage.IsView());
+    ExpectMessageValues(clMessage);
+
+    // Arrays point into the message rather than holding copies
+    const auto& clValues = std::get<TypedBuffer<uint16_t>>(clMessage.GetVarFields()[pclValues->index]);
+    EXPECT_EQ(clValues.data(), pucMessage + 8);
+    EXPECT_EQ(clMessage.GetFieldValue<TypedBuffer<uint16_t>>(*pclValues).data(), pucMessage + 8);
+    const auto& clFlat = std::get<FlatFieldArray>(clMessage.GetVarFields()[pclFlat->index]);
+    EXPECT_TRUE(clFlat.IsView());
+    EXPECT_EQ(clFlat.data(), pucMessage + 18);
+    const auto& vRecords = std::get<CompositeFieldArray>(clMessage.GetVarFields()[pclRecords->index]);
+    EXPECT_EQ(std::get<TypedBuffer<uint16_t>>(vRecords[0].GetVarFields()[pclSubValues->index]).data(), pucMessage + 46);
+
+    // Sizes agree with an owned decode, so the message encodes the same either way
+    CompositeField clOwned;
+    clDecoder.SetViewDecoding(false);
+    ASSERT_EQ(DecodeBinary(clDecoder, stMessage, vMessage, clOwned), STATUS::SUCCESS);
+    for (const auto& pclField : pclFieldInfo->messageOrderedFields)
+    {
+        EXPECT_EQ(clMessage.GetFieldByteSize(*pclField), clOwned.GetFieldByteSize(*pclField)) << pclField->name;
+    }
+}
+
+TEST_F(ViewDecodeTest, TAKE_OWNERSHIP_COPIES)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase());
+    clDecoder.SetViewDecoding(true);
+
+    std::vector<unsigned char> vMessage = CreateMessage();
+    CompositeField clMessage;
+    ASSERT_EQ(DecodeBinary(clDecoder, stMessage, vMessage, clMessage), STATUS::SUCCESS);
+
+    std::vector<unsigned char> vFixedMessage = CreateFixedMessage();
+    CompositeField clFixedMessage;
+    ASSERT_EQ(DecodeBinary(clDecoder, stFixedMessage, vFixedMessage, clFixedMessage), STATUS::SUCCESS);
+
+    clMessage.TakeOwnership();
+    clFixedMessage.TakeOwnership();
+    EXPECT_FALSE(clMessage.IsView());
+    EXPECT_FALSE(clFixedMessage.IsView());
+    EXPECT_TRUE(std::holds_alternative<std::vector<uint16_t>>(clMessage.GetVarFields()[pclValues->index]));
+
+    // The messages no longer depend on their buffers
+    std::fill(vMessage.begin(), vMessage.end(), static_cast<unsigned char>(0xFF));
+    std::fill(vFixedMessage.begin(), vFixedMessage.end(), static_cast<unsigned char>(0xFF));
+    ExpectMessageValues(clMessage);
+    EXPECT_EQ(clFixedMessage.GetFieldValue<uint32_t>(*pclFixedA), 40U);
+}
+
+TEST_F(ViewDecodeTest, REUSED_MESSAGE_SWITCHES_MODES)
+{
+    MessageDecoderBase clDecoder("", CreateDatabase());
+    const std::vector<unsigned char> vMessage = CreateMessage();
+    const std::vector<unsigned char> vFixedMessage = CreateFixedMessage();
+
+    CompositeField clMessage;
+    for (const bool bView : {true, false, true, false})
+    {
+        clDecoder.SetViewDecoding(bView);
+        ASSERT_EQ(DecodeBinary(clDecoder, stFixedMessage, vFixedMessage, clMessage), STATUS::SUCCESS);
+        EXPECT_EQ(clMessage.IsView(), bView);
+        EXPECT_EQ(clMessage.GetFieldValue<double>(*pclFixedB), 4.5);
+
+        ASSERT_EQ(DecodeBinary(clDecoder, stMessage, vMessage, clMessage), STATUS::SUCCESS);
+        EXPECT_EQ(clMessage.IsView(), bView);
+        ExpectMessageValues(clMessage);
+    }
+}
@@ -0,0 +1,421 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file columnar_batch_decoder.cpp
+// ===============================================================================
+
+#include "novatel_edie/decoders/oem/columnar_batch_decoder.hpp"
+
+#include <algorithm>
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+namespace {
+
+//! Check if a field is stored as the same column type in two message definitions.
+bool IsSameColumnType(const BaseField& clField_, const BaseField& clColumnField_)
+{
+    if (clField_.type != clColumnField_.type || clField_.dataType.name != clColumnField_.dataType.name ||
+        clField_.dataType.length != clColumnField_.dataType.length)
+    {
+        return false;
+    }
+    if (clField_.type != FIELD_TYPE::FIXED_LENGTH_ARRAY) { return true; }
+    return dynamic_cast<const ArrayField&>(clField_).arrayLength == dynamic_cast<const ArrayField&>(clColumnField_).arrayLength;
+}
+
+} // namespace
+
+// -------------------------------------------------------------------------------------------------------
+Column::Column(std::string strName_, BaseField::ConstPtr pclField_) : strMyName(std::move(strName_)), pclMyField(std::move(pclField_))
+{
+    switch (pclMyField->type)
+    {
+    case FIELD_TYPE::STRING: vMyValues = std::vector<std::string>(); return;
+    case FIELD_TYPE::FIXED_LENGTH_ARRAY: uiMyWidth = dynamic_cast<const ArrayField&>(*pclMyField).arrayLength; break;
+    case FIELD_TYPE::VARIABLE_LENGTH_ARRAY:
+        uiMyWidth = 0;
+        vMyOffsets.push_back(0);
+        break;
+    case FIELD_TYPE::SIMPLE: [[fallthrough]];
+    case FIELD_TYPE::ENUM: break;
+    default: throw std::runtime_error("Column(): unsupported type of field " + strMyName);
+    }
+
+    SimpleTypeVisitor(*pclMyField, [&](auto&& arg) {
+        // Decoded BOOLs are one byte
+        using T = std::conditional_t<std::is_same_v<std::decay_t<decltype(arg)>, bool>, uint8_t, std::decay_t<decltype(arg)>>;
+        vMyValues = std::vector<T>();
+        uiMyElementSize = sizeof(T);
+        pfMyAppend = &AppendRows<T>;
+    });
+}
+
+// -------------------------------------------------------------------------------------------------------
+void Column::clear()
+{
+    std::visit([](auto& vValues_) { vValues_.clear(); }, vMyValues);
+    if (!vMyOffsets.empty()) { vMyOffsets.resize(1); }
+}
+
+// -------------------------------------------------------------------------------------------------------
+void Column::reserve(size_t uiRows_)
+{
+    std::visit([&](auto& vValues_) { vValues_.reserve(uiRows_ * std::max<size_t>(uiMyWidth, 1)); }, vMyValues);
+    if (!vMyOffsets.empty()) { vMyOffsets.reserve(uiRows_ + 1); }
+}
+
+// -------------------------------------------------------------------------------------------------------
+void Column::truncate(size_t uiRows_)
+{
+    size_t uiValues = uiRows_ * uiMyWidth;
+    if (!vMyOffsets.empty())
+    {
+        vMyOffsets.resize(std::min(vMyOffsets.size(), uiRows_ + 1));
+        uiValues = vMyOffsets.back();
+    }
+    std::visit([&](auto& vValues_) { vValues_.resize(std::min(vValues_.size(), uiValues)); }, vMyValues);
+}
+
+// -------------------------------------------------------------------------------------------------------
+const Column& ColumnarTable::GetColumn(std::string_view strName_) const
+{
+    const auto it = std::find_if(vMyColumns.begin(), vMyColumns.end(), [&](const Column& clColumn_) { return clColumn_.GetName() == strName_; });
+    if (it == vMyColumns.end())
+    {
+        throw std::runtime_error("ColumnarTable::GetColumn(): no column " + std::string(strName_) + " in table " + strMyName);
+    }
+    return *it;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void ColumnarTable::clear()
+{
+    uiMyRows = 0;
+    for (Column& clColumn : vMyColumns) { clColumn.clear(); }
+    vMyWeeks.clear();
+    vMyMilliseconds.clear();
+    vMyParentIndex.clear();
+}
+
+// -------------------------------------------------------------------------------------------------------
+void ColumnarTable::reserve(size_t uiRows_)
+{
+    for (Column& clColumn : vMyColumns) { clColumn.reserve(uiRows_); }
+}
+
+// -------------------------------------------------------------------------------------------------------
+void ColumnarTable::truncate(size_t uiRows_)
+{
+    uiMyRows = std::min(uiMyRows, uiRows_);
+    for (Column& clColumn : vMyColumns) { clColumn.truncate(uiMyRows); }
+    vMyWeeks.resize(std::min(vMyWeeks.size(), uiMyRows));
+    vMyMilliseconds.resize(std::min(vMyMilliseconds.size(), uiMyRows));
+    vMyParentIndex.resize(std::min(vMyParentIndex.size(), uiMyRows));
+}
+
+// -------------------------------------------------------------------------------------------------------
+size_t ColumnarTable::AddColumn(const std::string& strName_, const BaseField::ConstPtr& pclField_)
+{
+    const auto it = std::find_if(vMyColumns.begin(), vMyColumns.end(), [&](const Column& clColumn_) { return clColumn_.GetName() == strName_; });
+    if (it != vMyColumns.end()) { return static_cast<size_t>(it - vMyColumns.begin()); }
+    vMyColumns.emplace_back(strName_, pclField_);
+    return vMyColumns.size() - 1;
+}
+
+// -------------------------------------------------------------------------------------------------------
+ColumnarBatchDecoder::ColumnarBatchDecoder(const MessageDatabase::Ptr& pclMessageDb_, const std::string& strMessageName_,
+                                           const std::vector<std::string>& vFieldNames_)
+    : clMyHeaderDecoder(pclMessageDb_), clMyMessageDecoder(pclMessageDb_)
+{
+    if (pclMessageDb_ == nullptr) { throw std::runtime_error("ColumnarBatchDecoder(): no message database"); }
+    pclMyMessageDef = pclMessageDb_->GetMsgDef(strMessageName_);
+    if (pclMyMessageDef == nullptr) { throw std::runtime_error("ColumnarBatchDecoder(): no definition for message " + strMessageName_); }
+
+    const FieldInfo& clFieldInfo = pclMyMessageDef->GetMsgDefFromCrc(pclMyMessageDef->latestMessageCrc);
+    clMyTable.strMyName = pclMyMessageDef->name;
+
+    std::vector<std::string> vFieldNames = vFieldNames_;
+    if (vFieldNames.empty())
+    {
+        for (const auto& pclField : clFieldInfo.messageOrderedFields) { vFieldNames.push_back(pclField->name); }
+    }
+
+    std::vector<std::string> vTopLevelNames;
+    for (const std::string& strName : vFieldNames)
+    {
+        const size_t uiDot = strName.find('.');
+        const std::string strTopLevelName = strName.substr(0, uiDot);
+        const BaseField::ConstPtr pclField = clFieldInfo.GetFieldDefByName(strTopLevelName);
+        if (pclField == nullptr)
+        {
+            throw std::runtime_error("ColumnarBatchDecoder(): no field " + strTopLevelName + " in message " + strMessageName_);
+        }
+        if (std::find(vTopLevelNames.begin(), vTopLevelNames.end(), strTopLevelName) == vTopLevelNames.end())
+        {
+            vTopLevelNames.push_back(strTopLevelName);
+        }
+
+        if (pclField->type != FIELD_TYPE::FIELD_ARRAY)
+        {
+            if (uiDot != std::string::npos) { throw std::runtime_error("ColumnarBatchDecoder(): " + strTopLevelName + " is not a field array"); }
+            clMyTable.AddColumn(strName, pclField);
+            continue;
+        }
+
+        const auto pclArrayField = std::dynamic_pointer_cast<const FieldArrayField>(pclField);
+        if (pclArrayField == nullptr) { throw std::runtime_error("ColumnarBatchDecoder(): missing field array metadata for " + strTopLevelName); }
+
+        auto itTable = std::find_if(vMyChildTables.begin(), vMyChildTables.end(),
+                                    [&](const ColumnarTable& clTable_) { return clTable_.GetName() == strTopLevelName; });
+        if (itTable == vMyChildTables.end())
+        {
+            itTable = vMyChildTables.emplace(vMyChildTables.end());
+            itTable->strMyName = strTopLevelName;
+        }
+
+        const FieldInfo& clArrayFieldInfo = *pclArrayField->fieldInfo;
+        if (uiDot == std::string::npos)
+        {
+            for (const auto& pclRecordField : clArrayFieldInfo.messageOrderedFields) { itTable->AddColumn(pclRecordField->name, pclRecordField); }
+            continue;
+        }
+
+        const std::string strRecordFieldName = strName.substr(uiDot + 1);
+        const BaseField::ConstPtr pclRecordField = clArrayFieldInfo.GetFieldDefByName(strRecordFieldName);
+        if (pclRecordField == nullptr)
+        {
+            throw std::runtime_error("ColumnarBatchDecoder(): no field " + strRecordFieldName + " in " + strTopLevelName);
+        }
+        itTable->AddColumn(strRecordFieldName, pclRecordField);
+    }
+
+    clMyMessageDecoder.SetProjection(pclMyMessageDef->name, std::move(vTopLevelNames));
+    clMyMessageDecoder.SetViewDecoding(true);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS ColumnarBatchDecoder::Bind(const FieldInfo::ConstPtr& pclFieldInfo_)
+{
+    const auto Resolve = [&](const FieldInfo& clFieldInfo_, const Column& clColumn_) -> const BaseField* {
+        const BaseField::ConstPtr pclField = clFieldInfo_.GetFieldDefByName(clColumn_.GetName());
+        if (pclField != nullptr && IsSameColumnType(*pclField, clColumn_.GetFieldDef())) { return pclField.get(); }
+        pclMyLogger->error("Field {} of {} is missing or has another type in the message definition", clColumn_.GetName(), pclMyMessageDef->name);
+        return nullptr;
+    };
+
+    std::vector<FieldSource> vFieldSources;
+    for (size_t i = 0; i < clMyTable.vMyColumns.size(); ++i)
+    {
+        const BaseField* pclField = Resolve(*pclFieldInfo_, clMyTable.vMyColumns[i]);
+        if (pclField == nullptr) { return STATUS::FAILURE; }
+        vFieldSources.push_back({i, pclField});
+    }
+
+    std::vector<FieldArraySource> vFieldArraySources;
+    for (size_t i = 0; i < vMyChildTables.size(); ++i)
+    {
+        const ColumnarTable& clTable = vMyChildTables[i];
+        const BaseField::ConstPtr pclField = pclFieldInfo_->GetFieldDefByName(clTable.GetName());
+        const auto* pclArrayField = dynamic_cast<const FieldArrayField*>(pclField.get());
+        if (pclArrayField == nullptr)
+        {
+            pclMyLogger->error("Field array {} of {} is missing in the message definition", clTable.GetName(), pclMyMessageDef->name);
+            return STATUS::FAILURE;
+        }
+
+        FieldArraySource stSource{i, pclArrayField, {}};
+        for (size_t j = 0; j < clTable.vMyColumns.size(); ++j)
+        {
+            const BaseField* pclRecordField = Resolve(*pclArrayField->fieldInfo, clTable.vMyColumns[j]);
+            if (pclRecordField == nullptr) { return STATUS::FAILURE; }
+            stSource.fields.push_back({j, pclRecordField});
+        }
+        vFieldArraySources.push_back(std::move(stSource));
+    }
+
+    pclMyBoundFieldInfo = pclFieldInfo_;
+    vMyFieldSources = std::move(vFieldSources);
+    vMyFieldArraySources = std::move(vFieldArraySources);
+    return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void ColumnarBatchDecoder::AppendFields(ColumnarTable& clTable_, const std::vector<FieldSource>& vSources_, const CompositeField& stMessage_)
+{
+    for (const FieldSource& stSource : vSources_)
+    {
+        Column& clColumn = clTable_.vMyColumns[stSource.column];
+        const BaseField& clField = *stSource.field;
+
+        switch (clField.type)
+        {
+        case FIELD_TYPE::STRING: clColumn.AppendString(stMessage_.GetFieldValue<std::string>(clField)); break;
+        case FIELD_TYPE::VARIABLE_LENGTH_ARRAY:
+            std::visit(
+                [&](const auto& value_) {
+                    using T = std::decay_t<decltype(value_)>;
+                    if constexpr (std::is_same_v<T, std::string>)
+                    {
+                        clColumn.AppendArray(reinterpret_cast<const std::byte*>(value_.data()), value_.size());
+                    }
+                    else if constexpr (is_specialization_of_v<T, TypedBuffer>)
+                    {
+                        clColumn.AppendArray(value_.data(), value_.size() * sizeof(decltype(value_[0])) / clColumn.uiMyElementSize);
+                    }
+                    else if constexpr (std::is_same_v<T, CompositeFieldArray> || !is_specialization_of_v<T, std::vector>)
+                    {
+                        throw std::runtime_error("ColumnarBatchDecoder: unexpected value of array " + clField.name);
+                    }
+                    else
+                    {
+                        clColumn.AppendArray(reinterpret_cast<const std::byte*>(value_.data()),
+                                             value_.size() * sizeof(typename T::value_type) / clColumn.uiMyElementSize);
+                    }
+                },
+                stMessage_.GetVarFields()[clField.index]);
+            break;
+        default: clColumn.AppendFixed(stMessage_.GetFixedFields().data() + clField.index, 1, 0); break;
+        }
+    }
+    ++clTable_.uiMyRows;
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS ColumnarBatchDecoder::Append(const unsigned char* pucFrame_, MetaDataStruct& stMetaData_)
+{
+    if (pucFrame_ == nullptr) { return STATUS::NULL_PROVIDED; }
+
+    STATUS eStatus = clMyHeaderDecoder.Decode(pucFrame_, stMyHeader, stMetaData_);
+    if (eStatus != STATUS::SUCCESS) { return eStatus; }
+    // Skip other messages before decoding their bodies
+    if (stMetaData_.bResponse || stMetaData_.usMessageId != pclMyMessageDef->logID) { return STATUS::UNSUPPORTED; }
+
+    eStatus = clMyMessageDecoder.Decode(pucFrame_ + stMetaData_.uiHeaderLength, stMyMessage, stMetaData_);
+    if (eStatus != STATUS::SUCCESS) { return eStatus; }
+    return Append(stMyMessage, stMetaData_);
+}
+
+// -------------------------------------------------------------------------------------------------------
+STATUS ColumnarBatchDecoder::Append(const CompositeField& stMessage_, const MetaDataStruct& stMetaData_)
+{
+    if (stMetaData_.bResponse || stMetaData_.usMessageId != pclMyMessageDef->logID) { return STATUS::UNSUPPORTED; }
+
+    const FieldInfo::ConstPtr& pclFieldInfo = stMessage_.GetFieldInfo();
+    if (pclFieldInfo == nullptr) { return STATUS::NULL_PROVIDED; }
+    if (pclFieldInfo != pclMyBoundFieldInfo && Bind(pclFieldInfo) != STATUS::SUCCESS) { return STATUS::FAILURE; }
+    if (stMessage_.GetFixedFields().size() < pclFieldInfo->fixedFieldBytes) { return STATUS::FAILURE; }
+
+    // Check every field before appending any, so the columns stay the same length
+    const auto IsMissing = [&](const BaseField& clField_) {
+        if (stMessage_.IsFieldPresent(clField_)) { return false; }
+        pclMyLogger->error("Field {} of {} was not decoded", clField_.name, pclMyMessageDef->name);
+        return true;
+    };
+    for (const FieldSource& stSource : vMyFieldSources)
+    {
+        if (IsMissing(*stSource.field)) { return STATUS::FAILURE; }
+    }
+    for (const FieldArraySource& stSource : vMyFieldArraySources)
+    {
+        if (IsMissing(*stSource.field)) { return STATUS::FAILURE; }
+    }
+
+    // Remember the sizes of the tables, so that a value that cannot be appended leaves no partial rows behind
+    const size_t uiParentRow = clMyTable.uiMyRows;
+    vMyChildRows.resize(vMyChildTables.size());
+    for (size_t i = 0; i < vMyChildTables.size(); ++i) { vMyChildRows[i] = vMyChildTables[i].uiMyRows; }
+
+    try
+    {
+        for (const FieldArraySource& stSource : vMyFieldArraySources)
+        {
+            ColumnarTable& clTable = vMyChildTables[stSource.table];
+            const FieldValueVariant& stValue = stMessage_.GetVarFields()[stSource.field->index];
+
+            if (const auto* pclRecords = std::get_if<FlatFieldArray>(&stValue))
+            {
+                // Gather each field of the records with one strided copy
+                const size_t uiRecords = pclRecords->size();
+                const size_t uiStride = stSource.field->fieldInfo->fixedFieldBytes;
+                for (const FieldSource& stField : stSource.fields)
+                {
+                    clTable.vMyColumns[stField.column].AppendFixed(pclRecords->data() + stField.field->index, uiRecords, uiStride);
+                }
+                clTable.uiMyRows += uiRecords;
+                clTable.vMyParentIndex.insert(clTable.vMyParentIndex.end(), uiRecords, uiParentRow);
+            }
+            else
+            {
+                for (const CompositeField& stRecord : std::get<CompositeFieldArray>(stValue))
+                {
+                    AppendFields(clTable, stSource.fields, stRecord);
+                    clTable.vMyParentIndex.push_back(uiParentRow);
+                }
+            }
+        }
+
+        AppendFields(clMyTable, vMyFieldSources, stMessage_);
+        clMyTable.vMyWeeks.push_back(stMetaData_.usWeek);
+        clMyTable.vMyMilliseconds.push_back(stMetaData_.dMilliseconds);
+    }
+    catch (...)
+    {
+        clMyTable.truncate(uiParentRow);
+        for (size_t i = 0; i < vMyChildTables.size(); ++i) { vMyChildTables[i].truncate(vMyChildRows[i]); }
+        throw;
+    }
+    return STATUS::SUCCESS;
+}
+
+// -------------------------------------------------------------------------------------------------------
+const ColumnarTable& ColumnarBatchDecoder::GetChildTable(std::string_view strFieldArrayName_) const
+{
+    const auto it = std::find_if(vMyChildTables.begin(), vMyChildTables.end(),
+                                 [&](const ColumnarTable& clTable_) { return clTable_.GetName() == strFieldArrayName_; });
+    if (it == vMyChildTables.end())
+    {
+        throw std::runtime_error("ColumnarBatchDecoder::GetChildTable(): field array " + std::string(strFieldArrayName_) + " was not requested");
+    }
+    return *it;
+}
+
+// -------------------------------------------------------------------------------------------------------
+void ColumnarBatchDecoder::Clear()
+{
+    clMyTable.clear();
+    for (ColumnarTable& clTable : vMyChildTables) { clTable.clear(); }
+}
+
+// -------------------------------------------------------------------------------------------------------
+void ColumnarBatchDecoder::Reserve(size_t uiMessages_, size_t uiRecordsPerMessage_)
+{
+    clMyTable.reserve(uiMessages_);
+    clMyTable.vMyWeeks.reserve(uiMessages_);
+    clMyTable.vMyMilliseconds.reserve(uiMessages_);
+    for (ColumnarTable& clTable : vMyChildTables)
+    {
+        clTable.reserve(uiMessages_ * uiRecordsPerMessage_);
+        clTable.vMyParentIndex.reserve(uiMessages_ * uiRecordsPerMessage_);
+    }
+}
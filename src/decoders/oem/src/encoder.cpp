@@ -36,24 +36,24 @@ using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
 // -------------------------------------------------------------------------------------------------------
-void AppendSiblingId(std::string& sMsgName_, const IntermediateHeader& stInterHeader_)
+// Write the message name, an optional format suffix ('A' or 'R') and the sibling ID suffix (e.g. "_1") to the
+// caller's buffer, so that no string is allocated per message. An empty view is returned if it does not fit.
+template <size_t N>
+std::string_view FormatMsgName(std::array<char, N>& buffer_, std::string_view sMsgName_, const IntermediateHeader& stInterHeader_,
+                               char cFormatSuffix_ = '\0')
 {
     const uint32_t ucSiblingId = stInterHeader_.ucMessageType & static_cast<uint32_t>(MESSAGE_TYPE_MASK::MEASSRC);
+    constexpr size_t maxSuffixSize = 5; // Format suffix, "_" and up to 3 digits (max for uint8_t)
+    if (sMsgName_.size() + maxSuffixSize > N) { return {}; }
 
+    char* pcEnd = std::copy(sMsgName_.begin(), sMsgName_.end(), buffer_.data());
+    if (cFormatSuffix_ != '\0') { *pcEnd++ = cFormatSuffix_; }
     if (ucSiblingId != 0U)
     {
-        // Reserve space for the suffix: "_" + up to 3 digits (max for uint8_t)
-        constexpr size_t maxSuffixSize = 4; // "_" + up to 3 digits
-        sMsgName_.reserve(sMsgName_.size() + maxSuffixSize);
-
-        // Append the underscore
-        sMsgName_.push_back('_');
-
-        // Convert the sibling ID to a string and append it
-        std::array<char, maxSuffixSize> buffer; // Enough space for a uint8_t (up to 3 digits) + null terminator
-        auto [ptr, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), ucSiblingId, 10);
-        if (ec == std::errc()) { sMsgName_.append(buffer.data(), ptr); }
+        *pcEnd++ = '_';
+        pcEnd = std::to_chars(pcEnd, buffer_.data() + N, ucSiblingId, 10).ptr;
     }
+    return {buffer_.data(), static_cast<size_t>(pcEnd - buffer_.data())};
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -296,14 +296,14 @@ bool Encoder::EncodeAsciiHeader(const IntermediateHeader& stInterHeader_, char**
 {
     if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, OEM4_ASCII_SYNC)) { return false; }
 
-    MessageDefinition::ConstPtr pclMessageDef = pclMyMsgDb->GetMsgDef(stInterHeader_.usMessageId);
-    std::string sMsgName(pclMessageDef != nullptr ? pclMessageDef->name : GetEnumString(vMyCommandDefinitions, stInterHeader_.usMessageId));
     const uint32_t uiResponse = (stInterHeader_.ucMessageType & static_cast<uint32_t>(MESSAGE_TYPE_MASK::RESPONSE)) >> 7;
-    sMsgName.push_back(uiResponse != 0U ? 'R' : 'A'); // Append 'A' for ascii, or 'R' for ascii response
-    AppendSiblingId(sMsgName, stInterHeader_);
+    MsgNameBuffer acMsgName;
+    // Append 'A' for ascii, or 'R' for ascii response
+    const std::string_view sMsgName = FormatMsgName(acMsgName, GetMsgName(stInterHeader_), stInterHeader_, uiResponse != 0U ? 'R' : 'A');
+    if (sMsgName.empty()) { return false; }
 
     return CopyAllToBufferSeparated(ppcOutBuf_, uiBytesLeft_, OEM4_ASCII_FIELD_SEPARATOR,
-                                    std::string_view(sMsgName),                                                                             //
+                                    sMsgName,                                                                                               //
                                     GetEnumString(vMyPortAddressDefinitions, stInterHeader_.uiPortAddress),                                 //
                                     stInterHeader_.usSequence,                                                                              //
                                     FloatValue<float>{static_cast<float>(stInterHeader_.ucIdleTime) * 0.500F, std::chars_format::fixed, 1}, //
@@ -322,12 +322,12 @@ bool Encoder::EncodeAbbrevAsciiHeader(const IntermediateHeader& stInterHeader_,
 {
     if (!bIsEmbedded_ && !CopyToBuffer(ppcOutBuf_, uiBytesLeft_, OEM4_ABBREV_ASCII_SYNC)) { return false; }
 
-    MessageDefinition::ConstPtr pclMessageDef = pclMyMsgDb->GetMsgDef(stInterHeader_.usMessageId);
-    std::string sMsgName(pclMessageDef != nullptr ? pclMessageDef->name : GetEnumString(vMyCommandDefinitions, stInterHeader_.usMessageId));
-    AppendSiblingId(sMsgName, stInterHeader_);
+    MsgNameBuffer acMsgName;
+    const std::string_view sMsgName = FormatMsgName(acMsgName, GetMsgName(stInterHeader_), stInterHeader_);
+    if (sMsgName.empty()) { return false; }
 
     return CopyAllToBufferSeparated(ppcOutBuf_, uiBytesLeft_, OEM4_ABBREV_ASCII_SEPARATOR,
-                                    std::string_view(sMsgName),                                                                             //
+                                    sMsgName,                                                                                               //
                                     GetEnumString(vMyPortAddressDefinitions, stInterHeader_.uiPortAddress),                                 //
                                     stInterHeader_.usSequence,                                                                              //
                                     FloatValue<float>{static_cast<float>(stInterHeader_.ucIdleTime) * 0.500F, std::chars_format::fixed, 1}, //
@@ -346,13 +346,15 @@ bool Encoder::EncodeAsciiShortHeader(const IntermediateHeader& stInterHeader_, c
 {
     if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, OEM4_SHORT_ASCII_SYNC)) { return false; }
 
-    std::string sMsgName(pclMyMsgDb->GetMsgDef(stInterHeader_.usMessageId)->name);
     const uint32_t uiResponse = (stInterHeader_.ucMessageType & static_cast<uint32_t>(MESSAGE_TYPE_MASK::RESPONSE)) >> 7;
-    sMsgName.push_back(uiResponse != 0U ? 'R' : 'A'); // Append 'A' for ascii, or 'R' for ascii response
-    AppendSiblingId(sMsgName, stInterHeader_);
+    MsgNameBuffer acMsgName;
+    // Append 'A' for ascii, or 'R' for ascii response
+    const std::string_view sMsgName =
+        FormatMsgName(acMsgName, pclMyMsgDb->GetMsgDef(stInterHeader_.usMessageId)->name, stInterHeader_, uiResponse != 0U ? 'R' : 'A');
+    if (sMsgName.empty()) { return false; }
 
     return CopyAllToBufferSeparated(ppcOutBuf_, uiBytesLeft_, OEM4_ASCII_FIELD_SEPARATOR,                                  //
-                                    std::string_view(sMsgName),                                                            //
+                                    sMsgName,                                                                              //
                                     stInterHeader_.usWeek,                                                                 //
                                     FloatValue<double>{stInterHeader_.dMilliseconds / 1000.0, std::chars_format::fixed, 3} //
                                     ) &&
@@ -364,11 +366,12 @@ bool Encoder::EncodeAbbrevAsciiShortHeader(const IntermediateHeader& stInterHead
 {
     if (!CopyToBuffer(ppcOutBuf_, uiBytesLeft_, OEM4_ABBREV_ASCII_SYNC)) { return false; }
 
-    std::string sMsgName(pclMyMsgDb->GetMsgDef(stInterHeader_.usMessageId)->name);
-    AppendSiblingId(sMsgName, stInterHeader_);
+    MsgNameBuffer acMsgName;
+    const std::string_view sMsgName = FormatMsgName(acMsgName, pclMyMsgDb->GetMsgDef(stInterHeader_.usMessageId)->name, stInterHeader_);
+    if (sMsgName.empty()) { return false; }
 
     return CopyAllToBufferSeparated(ppcOutBuf_, uiBytesLeft_, OEM4_ABBREV_ASCII_SEPARATOR,                                 //
-                                    std::string_view(sMsgName),                                                            //
+                                    sMsgName,                                                                              //
                                     stInterHeader_.usWeek,                                                                 //
                                     FloatValue<double>{stInterHeader_.dMilliseconds / 1000.0, std::chars_format::fixed, 3} //
                                     ) &&
@@ -376,20 +379,21 @@ bool Encoder::EncodeAbbrevAsciiShortHeader(const IntermediateHeader& stInterHead
 }
 
 // -------------------------------------------------------------------------------------------------------
-std::string Encoder::JsonHeaderToMsgName(const IntermediateHeader& stInterHeader_) const
+std::string_view Encoder::GetMsgName(const IntermediateHeader& stInterHeader_) const
 {
     MessageDefinition::ConstPtr pclMessageDef = pclMyMsgDb->GetMsgDef(stInterHeader_.usMessageId);
-    std::string sMsgName(pclMessageDef != nullptr ? pclMessageDef->name : GetEnumString(vMyCommandDefinitions, stInterHeader_.usMessageId));
-    AppendSiblingId(sMsgName, stInterHeader_);
-
-    return sMsgName;
+    return pclMessageDef != nullptr ? std::string_view(pclMessageDef->name) : GetEnumString(vMyCommandDefinitions, stInterHeader_.usMessageId);
 }
 
 // -------------------------------------------------------------------------------------------------------
 bool Encoder::EncodeJsonHeader(const IntermediateHeader& stInterHeader_, char** ppcOutBuf_, uint32_t& uiBytesLeft_) const
 {
+    MsgNameBuffer acMsgName;
+    const std::string_view sMsgName = FormatMsgName(acMsgName, GetMsgName(stInterHeader_), stInterHeader_);
+    if (sMsgName.empty()) { return false; }
+
     return CopyAllToBuffer(ppcOutBuf_, uiBytesLeft_,                                                                //
-                           R"({"message": ")", JsonHeaderToMsgName(stInterHeader_).c_str(),                         //
+                           R"({"message": ")", sMsgName,                                                             //
                            R"(","id": )", stInterHeader_.usMessageId,                                               //
                            R"(,"port": ")", GetEnumString(vMyPortAddressDefinitions, stInterHeader_.uiPortAddress), //
                            R"(","sequence_num": )", stInterHeader_.usSequence,                                      //
@@ -406,8 +410,12 @@ bool Encoder::EncodeJsonHeader(const IntermediateHeader& stInterHeader_, char**
 // -------------------------------------------------------------------------------------------------------
 bool Encoder::EncodeJsonShortHeader(const IntermediateHeader& stInterHeader_, char** ppcOutBuf_, uint32_t& uiBytesLeft_) const
 {
+    MsgNameBuffer acMsgName;
+    const std::string_view sMsgName = FormatMsgName(acMsgName, GetMsgName(stInterHeader_), stInterHeader_);
+    if (sMsgName.empty()) { return false; }
+
     return CopyAllToBuffer(ppcOutBuf_, uiBytesLeft_,                                                                                    //
-                           R"({"message": ")", JsonHeaderToMsgName(stInterHeader_).c_str(),                                             //
+                           R"({"message": ")", sMsgName,                                                                                 //
                            R"(","id": )", stInterHeader_.usMessageId,                                                                   //
                            R"(,"week": )", stInterHeader_.usWeek,                                                                       //
                            R"(,"seconds": )", FloatValue<double>{(stInterHeader_.dMilliseconds / 1000.0), std::chars_format::fixed, 3}, //
@@ -440,7 +448,7 @@ Encoder::Encode(unsigned char* const* ppucBuffer_, uint32_t uiBufferSize_, const
         stMessageData_.uiMessageHeaderLength = 1;
 
         if (fieldDefinitions.size() <= 1) { return STATUS::MALFORMED_INPUT; }
-        auto sResponse = stMessage_.GetFieldValue<std::string>(*fieldDefinitions.at(1));
+        const auto& sResponse = std::get<std::string>(stMessage_.GetVarFields()[fieldDefinitions.at(1)->index]);
         if (!CopyToBuffer(&pucTempEncodeBuffer, uiBufferSize_, sResponse.c_str())) { return STATUS::BUFFER_FULL; }
         if (!CopyToBuffer(&pucTempEncodeBuffer, uiBufferSize_, "\r\n")) { return STATUS::BUFFER_FULL; }
         stMessageData_.pucMessage = *ppucBuffer_;
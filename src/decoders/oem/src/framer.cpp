@@ -27,7 +27,9 @@
 #include "novatel_edie/decoders/oem/framer.hpp"
 
 #include <charconv>
+#include <cstring>
 
+#include "novatel_edie/common/byte_scanner.hpp"
 #include "novatel_edie/decoders/common/framer_registration.hpp"
 #include "novatel_edie/decoders/oem/crc.hpp"
 
@@ -35,11 +37,18 @@ using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
 // Register the OEM framer with the framer factory
-REGISTER_FRAMER(OEM, oem::Framer, MetaDataStruct)
+REGISTER_FRAMER(OEM, oem::Framer, MetaDataStruct, OEM4_BINARY_SYNC1, OEM4_ASCII_SYNC, OEM4_SHORT_ASCII_SYNC, OEM4_ABBREV_ASCII_SYNC, NMEA_SYNC, '{')
+
+// The first byte of every format the OEM framer recognizes, with and without JSON framing enabled
+static constexpr ByteScanner clSyncScanner{OEM4_BINARY_SYNC1, OEM4_ASCII_SYNC, OEM4_SHORT_ASCII_SYNC, OEM4_ABBREV_ASCII_SYNC, NMEA_SYNC};
+static constexpr ByteScanner clJsonSyncScanner{OEM4_BINARY_SYNC1, OEM4_ASCII_SYNC, OEM4_SHORT_ASCII_SYNC, OEM4_ABBREV_ASCII_SYNC, NMEA_SYNC, '{'};
 
 // -------------------------------------------------------------------------------------------------------
 Framer::Framer() : FramerBase("novatel_framer") {}
 
+// -------------------------------------------------------------------------------------------------------
+Framer::Framer(const FIXED_BUFFER_BACKEND eBufferBackend_) : FramerBase("novatel_framer", RECOMMENDED_FRAME_BUFFER_SIZE, eBufferBackend_) {}
+
 // -------------------------------------------------------------------------------------------------------
 Framer::Framer(std::shared_ptr<UCharFixedBuffer> buffer) : FramerBase("novatel_framer", buffer) { pclMyLogger->info("Framer initialized"); }
 
@@ -56,6 +65,19 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, Me
     while (eMyFrameState != NovAtelFrameState::COMPLETE_MESSAGE)
     {
         stMetaData_.bResponse = false;
+
+        // Skip straight to the next candidate sync byte rather than stepping through unknown data one byte at a time.
+        // The search stops at the frame buffer size so oversized unknown data is still returned in the same chunks.
+        if (eMyFrameState == NovAtelFrameState::WAITING_FOR_SYNC && uiMyByteCount < uiFrameBufferSize_)
+        {
+            const size_t uiSearchEnd = std::min(clInternalFrameBuffer.size(), static_cast<size_t>(uiFrameBufferSize_));
+            if (uiMyByteCount < uiSearchEnd)
+            {
+                const ByteScanner& clScanner = bMyFrameJson ? clJsonSyncScanner : clSyncScanner;
+                uiMyByteCount += static_cast<uint32_t>(clScanner.Find(clInternalFrameBuffer.data() + uiMyByteCount, uiSearchEnd - uiMyByteCount));
+            }
+        }
+
         // Read data from buffer until we reach the end or we didn't find a complete frame in current data buffer
         if (clInternalFrameBuffer.size() == uiMyByteCount)
         {
@@ -98,7 +120,6 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, Me
             switch (ucDataByte)
             {
             case OEM4_BINARY_SYNC1:
-                CalculateCharacterCrc32(uiMyCalculatedCrc32, ucDataByte);
                 eMyFrameState = NovAtelFrameState::WAITING_FOR_BINARY_SYNC2;
                 break;
             case OEM4_ASCII_SYNC:
@@ -151,7 +172,6 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, Me
             {
             case OEM4_PROPRIETARY_BINARY_SYNC2: stMetaData_.eFormat = HEADER_FORMAT::PROPRIETARY_BINARY; [[fallthrough]];
             case OEM4_BINARY_SYNC2:
-                CalculateCharacterCrc32(uiMyCalculatedCrc32, ucDataByte);
                 eMyFrameState = NovAtelFrameState::WAITING_FOR_BINARY_SYNC3;
                 break;
             default:
@@ -165,12 +185,10 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, Me
             switch (ucDataByte)
             {
             case OEM4_BINARY_SYNC3:
-                CalculateCharacterCrc32(uiMyCalculatedCrc32, ucDataByte);
                 if (stMetaData_.eFormat != HEADER_FORMAT::PROPRIETARY_BINARY) { stMetaData_.eFormat = HEADER_FORMAT::BINARY; }
                 eMyFrameState = NovAtelFrameState::WAITING_FOR_BINARY_HEADER;
                 break;
             case OEM4_SHORT_BINARY_SYNC3:
-                CalculateCharacterCrc32(uiMyCalculatedCrc32, ucDataByte);
                 stMetaData_.eFormat = HEADER_FORMAT::SHORT_BINARY;
                 eMyFrameState = NovAtelFrameState::WAITING_FOR_SHORT_BINARY_HEADER;
                 break;
@@ -196,7 +214,10 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, Me
             break;
 
         case NovAtelFrameState::WAITING_FOR_BINARY_HEADER: {
-            CalculateCharacterCrc32(uiMyCalculatedCrc32, ucDataByte);
+            // Jump over as much of the header as is buffered
+            uiMyByteCount =
+                std::max(uiMyByteCount, static_cast<uint32_t>(std::min<size_t>(clInternalFrameBuffer.size(), OEM4_BINARY_HEADER_LENGTH)));
+            stMetaData_.uiLength = uiMyByteCount;
 
             if (uiMyByteCount == OEM4_BINARY_HEADER_LENGTH)
             {
@@ -237,7 +258,10 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, Me
             break;
         }
         case NovAtelFrameState::WAITING_FOR_SHORT_BINARY_HEADER: {
-            CalculateCharacterCrc32(uiMyCalculatedCrc32, ucDataByte);
+            // Jump over as much of the header as is buffered
+            uiMyByteCount =
+                std::max(uiMyByteCount, static_cast<uint32_t>(std::min<size_t>(clInternalFrameBuffer.size(), OEM4_SHORT_BINARY_HEADER_LENGTH)));
+            stMetaData_.uiLength = uiMyByteCount;
 
             if (uiMyByteCount == OEM4_SHORT_BINARY_HEADER_LENGTH)
             {
@@ -278,10 +302,13 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, Me
             break;
         }
         case NovAtelFrameState::WAITING_FOR_BINARY_BODY_AND_CRC:
-            CalculateCharacterCrc32(uiMyCalculatedCrc32, ucDataByte);
+            // Wait until the whole message is buffered, then check the CRC over it in a single pass
+            uiMyByteCount = static_cast<uint32_t>(std::min<size_t>(clInternalFrameBuffer.size(), uiMyExpectedMessageLength));
+            stMetaData_.uiLength = uiMyByteCount;
 
             if (uiMyByteCount == uiMyExpectedMessageLength)
             {
+                uiMyCalculatedCrc32 = oem::CalculateBlockCrc32(clInternalFrameBuffer.data(), uiMyExpectedMessageLength);
                 if (uiMyCalculatedCrc32 == 0)
                 {
                     if (bMyPayloadOnly)
@@ -333,13 +360,15 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, Me
                 //                                            internal CRC  |<--------->|
 
                 // Check for a second CRC delimiter which indicates this is RXCONFIG
-                if (clInternalFrameBuffer[uiMyByteCount + OEM4_ASCII_CRC_LENGTH] == OEM4_ASCII_CRC_DELIMITER
+                if (clInternalFrameBuffer[uiMyByteCount + OEM4_ASCII_CRC_LENGTH] != OEM4_ASCII_CRC_DELIMITER
                     // Look ahead for the CRLF to ensure this is a CRC delimiter and not a '*' in a log payload
-                    || !IsAsciiCrc(uiMyByteCount))
+                    && IsAsciiCrc(uiMyByteCount))
                 {
-                    CalculateCharacterCrc32(uiMyCalculatedCrc32, ucDataByte);
+                    // The CRC covers everything between the sync character and the delimiter, so calculate it in a single pass
+                    uiMyCalculatedCrc32 = oem::CalculateBlockCrc32(clInternalFrameBuffer.data() + OEM4_ASCII_SYNC_LENGTH,
+                                                                   uiMyByteCount - 1 - OEM4_ASCII_SYNC_LENGTH);
+                    eMyFrameState = NovAtelFrameState::WAITING_FOR_ASCII_CRC;
                 }
-                else { eMyFrameState = NovAtelFrameState::WAITING_FOR_ASCII_CRC; }
             }
             else if (uiMyByteCount >= MAX_ASCII_MESSAGE_LENGTH)
             {
@@ -347,7 +376,31 @@ Framer::GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, Me
                 uiMyExpectedPayloadLength = 0;
                 ResetState();
             }
-            else { CalculateCharacterCrc32(uiMyCalculatedCrc32, ucDataByte); }
+            else
+            {
+                // Skip ahead to the next candidate delimiter. Non-ASCII bytes and the length limit are left for the checks above.
+                const size_t uiSearchEnd = std::min<size_t>(clInternalFrameBuffer.size(), MAX_ASCII_MESSAGE_LENGTH - 1);
+                const unsigned char* pucData = clInternalFrameBuffer.data();
+
+                // Test eight bytes at a time for a '*' (a zero byte after XOR) or a set high bit
+                constexpr uint64_t ullOnes = 0x0101010101010101ULL;
+                constexpr uint64_t ullHighBits = 0x8080808080808080ULL;
+                constexpr uint64_t ullDelimiters = ullOnes * static_cast<unsigned char>(OEM4_ASCII_CRC_DELIMITER);
+                while (uiMyByteCount + sizeof(uint64_t) <= uiSearchEnd)
+                {
+                    uint64_t ullWord;
+                    std::memcpy(&ullWord, pucData + uiMyByteCount, sizeof(ullWord));
+                    const uint64_t ullXored = ullWord ^ ullDelimiters;
+                    if ((((ullXored - ullOnes) & ~ullXored) | ullWord) & ullHighBits) { break; }
+                    uiMyByteCount += sizeof(uint64_t);
+                }
+
+                while (uiMyByteCount < uiSearchEnd && pucData[uiMyByteCount] != OEM4_ASCII_CRC_DELIMITER && pucData[uiMyByteCount] <= 127)
+                {
+                    uiMyByteCount++;
+                }
+                stMetaData_.uiLength = uiMyByteCount;
+            }
             break;
 
         case NovAtelFrameState::WAITING_FOR_ABB_ASCII_HEADER:
@@ -34,7 +34,7 @@ using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
 // Register the OEM abb ASCII framer with the framer factory
-REGISTER_FRAMER(OEM_ABB_ASCII, oem::FramerAbbAscii, MetaDataStruct)
+REGISTER_FRAMER(OEM_ABB_ASCII, oem::FramerAbbAscii, MetaDataStruct, OEM4_ABBREV_ASCII_SYNC)
 
 // -------------------------------------------------------------------------------------------------------
 FramerAbbAscii::FramerAbbAscii() : FramerBase("novatel_framer_abb_ascii") {}
@@ -85,10 +85,13 @@ FramerAbbAscii::FramerAbbAscii(std::shared_ptr<UCharFixedBuffer> buffer) : Frame
     }
 
     // Step 3: Parse body lines
-    size_t uiCrlfIndex = clFrameBuffer.search_chars(crlf, std::max(start, bodyStart), MAX_ASCII_MESSAGE_LENGTH);
+    // Only search within the longest possible frame so that junk without a terminator is rejected in bounded time
+    constexpr size_t uiMaxCrlfIndex = MAX_ASCII_MESSAGE_LENGTH - crlf.size();
+    auto searchCount = [](size_t uiIndex_) { return uiIndex_ <= uiMaxCrlfIndex ? uiMaxCrlfIndex + 1 - uiIndex_ : 0; };
+    size_t uiCrlfIndex = clFrameBuffer.search_chars(crlf, std::max(start, bodyStart), searchCount(std::max(start, bodyStart)));
     while (uiCrlfIndex != UCharFixedBuffer::npos && clFrameBuffer.size() > uiCrlfIndex + 3 && IsBodyLine(uiCrlfIndex + 2))
     {
-        uiCrlfIndex = clFrameBuffer.search_chars(crlf, uiCrlfIndex + 1, MAX_ASCII_MESSAGE_LENGTH);
+        uiCrlfIndex = clFrameBuffer.search_chars(crlf, uiCrlfIndex + 1, searchCount(uiCrlfIndex + 1));
     }
 
     if (uiCrlfIndex == UCharFixedBuffer::npos) { return midLineIncomplete(); }
@@ -32,7 +32,7 @@ using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
 // Register the OEM ASCII framer with the framer factory
-REGISTER_FRAMER(OEM_ASCII, oem::FramerAscii, MetaDataStruct)
+REGISTER_FRAMER(OEM_ASCII, oem::FramerAscii, MetaDataStruct, OEM4_ASCII_SYNC)
 
 // -------------------------------------------------------------------------------------------------------
 FramerAscii::FramerAscii() : FramerAsciiBase("novatel_framer_ascii") {}
@@ -32,7 +32,7 @@ using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
 // Register the OEM ASCII short framer with the framer factory
-REGISTER_FRAMER(OEM_ASCII_SHORT, oem::FramerAsciiShort, MetaDataStruct)
+REGISTER_FRAMER(OEM_ASCII_SHORT, oem::FramerAsciiShort, MetaDataStruct, OEM4_SHORT_ASCII_SYNC)
 
 // -------------------------------------------------------------------------------------------------------
 FramerAsciiShort::FramerAsciiShort() : FramerAsciiBase("novatel_framer_ascii_short") {}
@@ -32,7 +32,7 @@ using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
 // Register the OEM binary framer with the framer factory
-REGISTER_FRAMER(OEM_BINARY, FramerBinary, MetaDataStruct)
+REGISTER_FRAMER(OEM_BINARY, FramerBinary, MetaDataStruct, OEM4_BINARY_SYNC1)
 
 // -------------------------------------------------------------------------------------------------------
 FramerBinary::FramerBinary() : FramerBinaryBase("novatel_framer_binary") {}
@@ -32,7 +32,7 @@ using namespace novatel::edie;
 using namespace novatel::edie::oem;
 
 // Register the OEM binary short framer with the framer factory
-REGISTER_FRAMER(OEM_BINARY_SHORT, FramerBinaryShort, MetaDataStruct)
+REGISTER_FRAMER(OEM_BINARY_SHORT, FramerBinaryShort, MetaDataStruct, OEM4_BINARY_SYNC1)
 
 //----------------------------------------------------------------------------
 //! \brief A constructor for the FramerBinaryShort class.
@@ -98,7 +98,7 @@ bool HeaderDecoder::DecodeAsciiHeaderField(IntermediateHeader& stInterHeader_, c
         uint32_t ucSiblingId = NULL_SIBLING_ID;
         uint32_t uiMsgFormat = 0;
         uint32_t uiResponse = 0;
-        UnpackMsgId(pclMyMsgDb->MsgNameToMsgId(std::string(*ppcLogBuf_, ullTokenLength)), usLogId, ucSiblingId, uiMsgFormat, uiResponse);
+        UnpackMsgId(pclMyMsgDb->MsgNameToMsgId(std::string_view(*ppcLogBuf_, ullTokenLength)), usLogId, ucSiblingId, uiMsgFormat, uiResponse);
         stInterHeader_.usMessageId = usLogId;
         stInterHeader_.ucMessageType = PackMsgType(ucSiblingId, uiMsgFormat, uiResponse);
         break;
@@ -202,10 +202,10 @@ bool HeaderDecoder::DecodeAsciiHeaderFields(IntermediateHeader& stInterHeader_,
 // -------------------------------------------------------------------------------------------------------
 void HeaderDecoder::DecodeJsonHeader(std::string_view pcTempBuf_, IntermediateHeader& stInterHeader_) const
 {
-    simdjson::dom::parser parser;
     simdjson::dom::element doc;
-    // Parse the JSON
-    auto error = parser.parse(pcTempBuf_.data(), pcTempBuf_.size()).get(doc);
+    // Parse the whole message and share the document with the message decoder, or parse it on our own when no parser is set
+    JsonMessageParser clLocalParser;
+    auto error = pclMyJsonParser != nullptr ? pclMyJsonParser->Parse(pcTempBuf_, doc, true) : clLocalParser.Parse(pcTempBuf_, doc);
     if (error)
     {
         std::cerr << "JSON parsing error: " << error << '\n';
@@ -423,9 +423,10 @@ STATUS HeaderDecoder::Decode(const unsigned char* pucLogBuf_, IntermediateHeader
     stMetaData_.uiHeaderLength = static_cast<uint32_t>(pcTempBuf - reinterpret_cast<const char*>(pucLogBuf_));
     stMetaData_.uiBinaryMsgLength = static_cast<uint32_t>(stInterHeader_.usLength);
 
-    // Reconstruct a message name that won't have a suffix of any kind.
-    stMetaData_.messageName =
-        pclMyMsgDb->MsgIdToMsgName(CreateMsgId(stInterHeader_.usMessageId, 0, static_cast<uint32_t>(MESSAGE_FORMAT::ABBREV), 0U));
+    // The message name without a suffix of any kind is just the definition name. Assign it in place so the
+    // string's existing capacity is reused from one message to the next.
+    const MessageDefinition::ConstPtr pclMsgDef = pclMyMsgDb->GetMsgDef(stInterHeader_.usMessageId);
+    stMetaData_.messageName.assign(pclMsgDef != nullptr ? std::string_view(pclMsgDef->name) : std::string_view("UNKNOWN"));
 
     if (stInterHeader_.usMessageId > 0) { clMyMessageCounts.Increment({stInterHeader_.usMessageId, stMetaData_.eFormat, stMetaData_.ucSiblingId}); }
 
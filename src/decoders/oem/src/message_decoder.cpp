@@ -46,9 +46,11 @@ const bool kRegisteredOemAlignment = [] {
 } // namespace
 
 // -------------------------------------------------------------------------------------------------------
-MessageDecoder::MessageDecoder(const MessageDatabase::Ptr& pclMessageDb_) : MessageDecoderBase("OEM", pclMessageDb_, OemAlignmentFunction)
+MessageDecoder::MessageDecoder(const MessageDatabase::Ptr& pclMessageDb_)
+    : MessageDecoderBase(DeferBinding{}, "OEM", pclMessageDb_, OemAlignmentFunction)
 {
     InitOemFieldMaps();
+    BindFieldConverters();
 }
 
 // -------------------------------------------------------------------------------------------------------
@@ -91,7 +93,7 @@ void MessageDecoder::InitOemFieldMaps()
     asciiFieldMap[CalculateBlockCrc32("m")] = [](CompositeField& clCompField_, const BaseField& pstMessageDataType_, const char** ppcToken_,
                                                  [[maybe_unused]] const size_t tokenLength_, const size_t elementIndex_, const bool fixed_,
                                                  [[maybe_unused]] MessageDatabase& pclMsgDb_) {
-        const uint32_t value = pclMsgDb_.MsgNameToMsgId(std::string(*ppcToken_, tokenLength_));
+        const uint32_t value = pclMsgDb_.MsgNameToMsgId(std::string_view(*ppcToken_, tokenLength_));
         if (fixed_) { clCompField_.SetArrayElement<true>(pstMessageDataType_, elementIndex_, value); }
         else { clCompField_.SetArrayElement<false>(pstMessageDataType_, elementIndex_, value); }
     };
@@ -161,7 +163,7 @@ void MessageDecoder::InitOemFieldMaps()
         {
             throw std::runtime_error("Failed to decode JSON field '" + pstMessageDataType_.name + "'");
         }
-        const auto value = pclMsgDb_.MsgNameToMsgId(std::string(sValue));
+        const auto value = pclMsgDb_.MsgNameToMsgId(sValue);
         if (fixed_) { clCompField_.SetArrayElement<true>(pstMessageDataType_, elementIndex_, value); }
         else { clCompField_.SetArrayElement<false>(pstMessageDataType_, elementIndex_, value); }
     };
@@ -279,8 +281,8 @@ novatel::edie::MessageDefinition::ConstPtr MessageDecoder::GetMessageDefinition(
         responseStrField->dataType = responseStrDataType;
         responseStrField->index = 0;
 
-        responseDefinition->fieldInfo[0] =
-            std::make_shared<FieldInfo>(FieldInfo{sizeof(uint32_t), 1, std::vector<BaseField::ConstPtr>{responseIdField, responseStrField}});
+        responseDefinition->fieldInfo[0] = std::make_shared<FieldInfo>(
+            FieldInfo{sizeof(uint32_t), 1, std::vector<BaseField::ConstPtr>{responseIdField, responseStrField}, nullptr, nullptr});
 
         pResponseDefinition = responseDefinition;
         return pResponseDefinition;
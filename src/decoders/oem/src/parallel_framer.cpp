@@ -0,0 +1,176 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file parallel_framer.cpp
+// ===============================================================================
+
+#include "novatel_edie/decoders/oem/parallel_framer.hpp"
+
+#include <array>
+#include <limits>
+#include <thread>
+
+#include "novatel_edie/decoders/oem/framer.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+// -------------------------------------------------------------------------------------------------------
+ParallelFramer::ParallelFramer(const size_t uiThreadCount_) : pclMyLogger(GetBaseLoggerManager()->RegisterLogger("novatel_parallel_framer"))
+{
+    SetThreadCount(uiThreadCount_);
+    pclMyLogger->debug("ParallelFramer initialized");
+}
+
+// -------------------------------------------------------------------------------------------------------
+void ParallelFramer::SetThreadCount(const size_t uiThreadCount_)
+{
+    uiMyThreadCount = uiThreadCount_ != 0 ? uiThreadCount_ : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+// -------------------------------------------------------------------------------------------------------
+void ParallelFramer::FrameRange(Framer& clFramer_, const unsigned char* pucData_, const uint64_t ullDataLength_, const uint64_t ullBegin_,
+                                const uint64_t ullEnd_, const size_t uiMaxFrames_, std::vector<FrameLocation>& vFrames_) const
+{
+    // The Framer frames the data in place, so a call that only needs a frame or two costs no more than framing them
+    clFramer_.Attach(pucData_ + ullBegin_);
+    clFramer_.SetFrameJson(bMyFrameJson);
+    clFramer_.SetReportUnknownBytes(false);
+
+    std::array<FrameDescriptor, 256> astFrames;
+    MetaDataStruct stMetaData;
+    const unsigned char* pucFrameData = nullptr;
+    const size_t uiFirstFrame = vFrames_.size();
+    uint64_t ullWritten = ullBegin_;
+    uint64_t ullBufferOffset = ullBegin_; // Offset of the first byte in the Framer's buffer
+
+    while (true)
+    {
+        const uint64_t ullWriteLength = std::min<uint64_t>(clFramer_.GetAvailableSpace(), ullDataLength_ - ullWritten);
+        ullWritten += clFramer_.Write(pucData_ + ullWritten, static_cast<size_t>(ullWriteLength));
+
+        // Every descriptor returned by GetFrames() is removed from the Framer's buffer, so none are requested past the frames left to find
+        while (const size_t uiFrameCount = clFramer_.GetFrames(
+                   astFrames.data(), std::min<size_t>(astFrames.size(), uiMaxFrames_ - (vFrames_.size() - uiFirstFrame)), pucFrameData, stMetaData))
+        {
+            for (size_t i = 0; i < uiFrameCount; ++i)
+            {
+                const FrameDescriptor& stFrame = astFrames[i];
+                const uint64_t ullOffset = ullBufferOffset + stFrame.uiOffset;
+                if (ullOffset >= ullEnd_) { return; }
+                if (stFrame.eStatus != STATUS::SUCCESS) { continue; }
+
+                vFrames_.push_back(FrameLocation{ullOffset, stFrame.uiLength, stFrame.eFormat});
+                if (vFrames_.size() - uiFirstFrame == uiMaxFrames_) { return; }
+            }
+            ullBufferOffset += astFrames[uiFrameCount - 1].uiOffset + astFrames[uiFrameCount - 1].uiLength;
+        }
+
+        // The rest of the data is an incomplete frame
+        if (ullWritten == ullDataLength_) { return; }
+
+        // The Framer cannot make progress without more room, which no frame of a supported length needs
+        if (clFramer_.GetAvailableSpace() == 0)
+        {
+            pclMyLogger->warn("Framing stalled at offset {}", ullBufferOffset);
+            return;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------------------------
+std::vector<FrameLocation> ParallelFramer::Frame(const unsigned char* pucData_, const uint64_t ullDataLength_) const
+{
+    constexpr uint64_t ullDataEnd = std::numeric_limits<uint64_t>::max();
+    constexpr size_t uiAllFrames = std::numeric_limits<size_t>::max();
+
+    std::vector<FrameLocation> vFrames;
+    if (pucData_ == nullptr || ullDataLength_ == 0) { return vFrames; }
+
+    const uint64_t ullChunkCount = std::clamp<uint64_t>(ullDataLength_ / ullMyMinChunkSize, 1, uiMyThreadCount);
+    const uint64_t ullChunkSize = (ullDataLength_ + ullChunkCount - 1) / ullChunkCount;
+    // The calling thread's Framer frames the first chunk and is then reused for every frame stitched in sequentially
+    Framer clFramer;
+    if (ullChunkCount == 1)
+    {
+        FrameRange(clFramer, pucData_, ullDataLength_, 0, ullDataEnd, uiAllFrames, vFrames);
+        return vFrames;
+    }
+
+    // Each chunk other than the first starts at an arbitrary byte, so its Framer resynchronizes by itself
+    std::vector<std::vector<FrameLocation>> vChunkFrames(ullChunkCount);
+    std::vector<std::thread> vThreads;
+    vThreads.reserve(ullChunkCount - 1);
+    for (uint64_t ullChunk = 1; ullChunk < ullChunkCount; ++ullChunk)
+    {
+        vThreads.emplace_back([&, ullChunk] {
+            const uint64_t ullBegin = ullChunk * ullChunkSize;
+            Framer clChunkFramer;
+            FrameRange(clChunkFramer, pucData_, ullDataLength_, ullBegin, std::min(ullBegin + ullChunkSize, ullDataLength_), uiAllFrames,
+                       vChunkFrames[ullChunk]);
+        });
+    }
+    FrameRange(clFramer, pucData_, ullDataLength_, 0, ullChunkSize, uiAllFrames, vChunkFrames[0]);
+    for (auto& clThread : vThreads) { clThread.join(); }
+
+    // The first chunk was framed from the start of the data, so its frames are final. Afterwards, the Framer state is
+    // reset at the end of every frame, so a chunk's frames after a frame end (or its start) are final as soon as the
+    // sequential frames also have a frame end there. Until then, the sequential frames are extended one at a time.
+    vFrames = std::move(vChunkFrames[0]);
+    uint64_t ullPosition = vFrames.empty() ? 0 : vFrames.back().End();
+
+    for (uint64_t ullChunk = 1; ullChunk < ullChunkCount; ++ullChunk)
+    {
+        const uint64_t ullChunkBegin = ullChunk * ullChunkSize;
+        const auto& vChunk = vChunkFrames[ullChunk];
+        const uint64_t ullLastReset = vChunk.empty() ? ullChunkBegin : vChunk.back().End();
+
+        while (ullPosition <= ullLastReset)
+        {
+            auto itNext = vChunk.begin();
+            bool bAligned = ullPosition == ullChunkBegin;
+            if (!bAligned)
+            {
+                itNext = std::lower_bound(vChunk.begin(), vChunk.end(), ullPosition,
+                                          [](const FrameLocation& stFrame_, const uint64_t ullEnd_) { return stFrame_.End() < ullEnd_; });
+                bAligned = itNext != vChunk.end() && itNext->End() == ullPosition;
+                if (bAligned) { ++itNext; }
+            }
+
+            if (bAligned)
+            {
+                vFrames.insert(vFrames.end(), itNext, vChunk.end());
+                ullPosition = ullLastReset;
+                break;
+            }
+
+            // Frame the next frame sequentially. If there is none, the rest of the data holds no frames at all.
+            const size_t uiFrameCount = vFrames.size();
+            FrameRange(clFramer, pucData_, ullDataLength_, ullPosition, ullDataEnd, 1, vFrames);
+            if (vFrames.size() == uiFrameCount) { return vFrames; }
+            ullPosition = vFrames.back().End();
+        }
+    }
+
+    return vFrames;
+}
@@ -26,7 +26,9 @@
 
 #include "novatel_edie/decoders/oem/parser.hpp"
 
-#include "novatel_edie/decoders/common/json_db_reader.hpp"
+#include <cstring>
+
+#include "novatel_edie/decoders/common/binary_db.hpp"
 
 using namespace novatel::edie;
 using namespace novatel::edie::oem;
@@ -34,7 +36,9 @@ using namespace novatel::edie::oem;
 // -------------------------------------------------------------------------------------------------------
 Parser::Parser(const std::filesystem::path& sDbPath_)
 {
-    auto pclMessageDb = LoadJsonDbFile(sDbPath_);
+    clMyHeaderDecoder.SetJsonParser(pclMyJsonParser);
+    clMyMessageDecoder.SetJsonParser(pclMyJsonParser);
+    auto pclMessageDb = LoadDbFile(sDbPath_);
     LoadJsonDb(pclMessageDb);
     pclMyLogger->debug("Parser initialized");
 }
@@ -42,6 +46,8 @@ Parser::Parser(const std::filesystem::path& sDbPath_)
 // -------------------------------------------------------------------------------------------------------
 Parser::Parser(MessageDatabase::Ptr pclMessageDb_)
 {
+    clMyHeaderDecoder.SetJsonParser(pclMyJsonParser);
+    clMyMessageDecoder.SetJsonParser(pclMyJsonParser);
     if (pclMessageDb_ != nullptr) { LoadJsonDb(pclMessageDb_); }
     pclMyLogger->debug("Parser initialized");
 }
@@ -99,8 +105,12 @@ Parser::ReadIntermediate(MessageDataStruct& stMessageData_, IntermediateHeader&
 {
     while (true)
     {
+        // Release the frame returned by the previous call before framing the next one
+        clMyFramer.Consume();
+
         pucMyFrameBufferPointer = pcMyFrameBuffer.get(); //!< Reset the buffer.
-        auto eStatus = clMyFramer.GetFrame(pucMyFrameBufferPointer, uiParserInternalBufferSize, stMetaData_);
+        FrameView stFrame;
+        auto eStatus = clMyFramer.GetFrameView(stFrame, stMetaData_, uiParserInternalBufferSize);
 
         // Datasets ending with an Abbreviated ASCII message will always return an incomplete framing status
         // as there is no delimiter marking the end of the log.
@@ -116,10 +126,18 @@ Parser::ReadIntermediate(MessageDataStruct& stMessageData_, IntermediateHeader&
             {
                 eStatus = STATUS::SUCCESS;
                 stMetaData_.uiLength = uiFlushSize;
+                stFrame = FrameView{pucMyFrameBufferPointer, uiFlushSize};
             }
         }
+        // JSON decoding relies on a null-terminated frame, so it cannot be done in place
+        else if (eStatus == STATUS::SUCCESS && stMetaData_.eFormat == HEADER_FORMAT::JSON)
+        {
+            std::memcpy(pucMyFrameBufferPointer, stFrame.data(), stFrame.size());
+            pucMyFrameBufferPointer[stFrame.size()] = '\0';
+            stFrame = FrameView{pucMyFrameBufferPointer, stFrame.size()};
+        }
 
-        stMessageData_.pucMessage = pucMyFrameBufferPointer;
+        stMessageData_.pucMessage = const_cast<unsigned char*>(stFrame.data());
         stMessageData_.uiMessageLength = stMetaData_.uiLength;
         if (eStatus == STATUS::UNKNOWN)
         {
@@ -138,7 +156,8 @@ Parser::ReadIntermediate(MessageDataStruct& stMessageData_, IntermediateHeader&
                 continue;
             }
 
-            eStatus = clMyHeaderDecoder.Decode(pucMyFrameBufferPointer, stHeader_, stMetaData_);
+            const unsigned char* pucFrame = stFrame.data();
+            eStatus = clMyHeaderDecoder.Decode(pucFrame, stHeader_, stMetaData_);
             if (eStatus == STATUS::SUCCESS)
             {
                 if ((pclMyUserFilter != nullptr) && (!pclMyUserFilter->DoFiltering(stMetaData_))) { continue; }
@@ -146,6 +165,14 @@ Parser::ReadIntermediate(MessageDataStruct& stMessageData_, IntermediateHeader&
                 // Should we decompress this?
                 if (clMyRangeCmpFilter.DoFiltering(stMetaData_) && bMyDecompressRangeCmp)
                 {
+                    // Decompression rewrites the frame in place, so it must work on a copy
+                    if (pucFrame != pucMyFrameBufferPointer)
+                    {
+                        std::memcpy(pucMyFrameBufferPointer, pucFrame, stFrame.size());
+                        pucFrame = pucMyFrameBufferPointer;
+                        stMessageData_.pucMessage = pucMyFrameBufferPointer;
+                    }
+
                     eStatus = clMyRangeDecompressor.Decompress(pucMyFrameBufferPointer, uiParserInternalBufferSize, stMetaData_);
                     if (eStatus == STATUS::SUCCESS) { stHeader_.usMessageId = stMetaData_.usMessageId; }
                     else
@@ -156,14 +183,14 @@ Parser::ReadIntermediate(MessageDataStruct& stMessageData_, IntermediateHeader&
                     // Continue if we succeeded.
                 }
 
-                pucMyFrameBufferPointer += stMetaData_.uiHeaderLength;
-                stMessageData_.pucMessageBody = pucMyFrameBufferPointer;
+                pucFrame += stMetaData_.uiHeaderLength;
+                stMessageData_.pucMessageBody = const_cast<unsigned char*>(pucFrame);
                 stMessageData_.uiMessageBodyLength = stMetaData_.uiLength - stMetaData_.uiHeaderLength;
                 if (RxConfigHandler::IsRxConfigTypeMsg(stHeader_.usMessageId))
                 {
-                    eStatus = clMyRxConfigHandler.Decode(pucMyFrameBufferPointer, stMessage_, stMetaData_);
+                    eStatus = clMyRxConfigHandler.Decode(pucFrame, stMessage_, stMetaData_);
                 }
-                else { eStatus = clMyMessageDecoder.Decode(pucMyFrameBufferPointer, stMessage_, stMetaData_); }
+                else { eStatus = clMyMessageDecoder.Decode(pucFrame, stMessage_, stMetaData_); }
 
                 if (eStatus == STATUS::SUCCESS || eStatus == STATUS::NO_DEFINITION) { return eStatus; }
 
@@ -199,22 +226,21 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
 {
     while (true)
     {
-        IntermediateHeader stHeader;
-        CompositeField stMessage;
-        STATUS eStatus = ReadIntermediate(stMessageData_, stHeader, stMessage, stMetaData_, bDecodeIncompleteAbbreviated_);
+        stMyHeader = {};
+        STATUS eStatus = ReadIntermediate(stMessageData_, stMyHeader, stMyMessage, stMetaData_, bDecodeIncompleteAbbreviated_);
         pucMyEncodeBufferPointer = pcMyEncodeBuffer.get(); //!< Reset the buffer.
 
         if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
         // Encode RxConfig messages
-        if (RxConfigHandler::IsRxConfigTypeMsg((stHeader.usMessageId)))
+        if (RxConfigHandler::IsRxConfigTypeMsg((stMyHeader.usMessageId)))
         {
-            eStatus = clMyRxConfigHandler.Encode(&pucMyEncodeBufferPointer, uiParserInternalBufferSize, stHeader, stMessage, stMessageData_,
+            eStatus = clMyRxConfigHandler.Encode(&pucMyEncodeBufferPointer, uiParserInternalBufferSize, stMyHeader, stMyMessage, stMessageData_,
                                                  eMyEncodeFormat);
         }
         else
         {
-            eStatus = clMyEncoder.Encode(&pucMyEncodeBufferPointer, uiParserInternalBufferSize, stHeader, stMessage, stMessageData_,
+            eStatus = clMyEncoder.Encode(&pucMyEncodeBufferPointer, uiParserInternalBufferSize, stMyHeader, stMyMessage, stMessageData_,
                                          stMetaData_.eFormat, eMyEncodeFormat);
         }
 
@@ -228,5 +254,6 @@ Parser::Read(MessageDataStruct& stMessageData_, MetaDataStruct& stMetaData_, boo
 uint32_t Parser::Flush(unsigned char* pucBuffer_, uint32_t uiBufferSize_)
 {
     clMyRangeDecompressor.Reset();
+    clMyFramer.Consume();
     return clMyFramer.Flush(pucBuffer_, uiBufferSize_);
 }
@@ -746,11 +746,10 @@ STATUS RangeDecompressor::Decompress(unsigned char* pucBuffer_, uint32_t uiBuffe
     if (pclMyMsgDB == nullptr) { return STATUS::NO_DATABASE; }
 
     MessageDataStruct stMessageData;
-    IntermediateHeader stHeader;
-    CompositeField stMessage;
+    stMyHeader = {};
 
     unsigned char* pucTempMessagePointer = pucBuffer_;
-    STATUS eStatus = clMyHeaderDecoder.Decode(pucTempMessagePointer, stHeader, stMetaData_);
+    STATUS eStatus = clMyHeaderDecoder.Decode(pucTempMessagePointer, stMyHeader, stMetaData_);
     if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
     if (!clMyRangeCmpFilter.DoFiltering(stMetaData_)) { return STATUS::UNSUPPORTED; }
@@ -760,11 +759,11 @@ STATUS RangeDecompressor::Decompress(unsigned char* pucBuffer_, uint32_t uiBuffe
     // If the message is not in binary format, we need to ensure that it is encoded to binary so that it can be decompressed.
     if (eFormat != HEADER_FORMAT::BINARY)
     {
-        eStatus = clMyMessageDecoder.Decode(pucTempMessagePointer, stMessage, stMetaData_);
+        eStatus = clMyMessageDecoder.Decode(pucTempMessagePointer, stMyMessage, stMetaData_);
         if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
-        eStatus =
-            clMyEncoder.Encode(&pucBuffer_, uiBufferSize_, stHeader, stMessage, stMessageData, stMetaData_.eFormat, ENCODE_FORMAT::FLATTENED_BINARY);
+        eStatus = clMyEncoder.Encode(&pucBuffer_, uiBufferSize_, stMyHeader, stMyMessage, stMessageData, stMetaData_.eFormat,
+                                     ENCODE_FORMAT::FLATTENED_BINARY);
         if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
         pucTempMessagePointer = stMessageData.pucMessageBody;
@@ -794,15 +793,14 @@ STATUS RangeDecompressor::Decompress(unsigned char* pucBuffer_, uint32_t uiBuffe
     }
 
     // Adjust metadata/header data
-    stHeader.usMessageId = RANGE_MSG_ID;
+    stMyHeader.usMessageId = RANGE_MSG_ID;
     stMetaData_.usMessageId = RANGE_MSG_ID;
     stMetaData_.uiMessageCrc = 0; // Use the first message definition
     stMetaData_.messageName = "RANGE";
 
     // The message should be returned in its original format.
     stMetaData_.eFormat = HEADER_FORMAT::BINARY;
-    stMessage = {};
-    eStatus = clMyMessageDecoder.Decode(pucTempMessagePointer, stMessage, stMetaData_);
+    eStatus = clMyMessageDecoder.Decode(pucTempMessagePointer, stMyMessage, stMetaData_);
     if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
     stMetaData_.eFormat = eFormat;
@@ -818,7 +816,7 @@ STATUS RangeDecompressor::Decompress(unsigned char* pucBuffer_, uint32_t uiBuffe
     }
 
     // Re-encode the data back into the range message buffer.
-    eStatus = clMyEncoder.Encode(&pucBuffer_, uiBufferSize_, stHeader, stMessage, stMessageData, stMetaData_.eFormat, eFormat_);
+    eStatus = clMyEncoder.Encode(&pucBuffer_, uiBufferSize_, stMyHeader, stMyMessage, stMessageData, stMetaData_.eFormat, eFormat_);
     if (eStatus != STATUS::SUCCESS) { return eStatus; }
 
     // Final adjustments to MetaData
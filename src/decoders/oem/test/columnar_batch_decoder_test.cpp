@@ -0,0 +1,284 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file columnar_batch_decoder_test.cpp
+// ===============================================================================
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "novatel_edie/decoders/common/json_db_reader.hpp"
+#include "novatel_edie/decoders/oem/columnar_batch_decoder.hpp"
+#include "novatel_edie/decoders/oem/encoder.hpp"
+#include "novatel_edie/decoders/oem/header_decoder.hpp"
+#include "novatel_edie/decoders/oem/message_decoder.hpp"
+#include "novatel_edie/decoders/oem/parser.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+namespace {
+
+//! Two VIEWTEST logs of the message view test database, with 2 and 3 observations.
+constexpr std::string_view szFirstLog = "#VIEWTESTA,COM1,0,50.0,FINESTEERING,2167,244820.000,02000000,1234,16248;"
+                                        "200,4000000000,-12,1.25,BLUE,0a0b0c,\"a station\",3,1,2,65535,TRUE,"
+                                        "2,1,-1,2,-2,2,5,\"first\",6,\"second\",-9,7,8*00000000\r\n";
+constexpr std::string_view szSecondLog = "#VIEWTESTA,COM1,0,50.0,FINESTEERING,2167,244821.000,02000000,1234,16248;"
+                                         "100,7,3,-0.5,RED,010203,\"b\",0,FALSE,"
+                                         "3,10,-10,11,-11,12,-12,1,9,\"third\",4,0,1*00000000\r\n";
+
+std::vector<unsigned char> ToFrame(std::string_view szLog_)
+{
+    std::vector<unsigned char> vFrame(szLog_.begin(), szLog_.end());
+    vFrame.push_back('\0');
+    return vFrame;
+}
+
+} // namespace
+
+// -------------------------------------------------------------------------------------------------------
+// Columnar Batch Decoder Tests
+// -------------------------------------------------------------------------------------------------------
+class ColumnarBatchDecoderTest : public ::testing::Test
+{
+  protected:
+    static void SetUpTestSuite()
+    {
+        pclMyMessageDb = LoadJsonDbFile(std::filesystem::path(std::getenv("TEST_RESOURCE_PATH")) / "message_view_db.json");
+    }
+
+    static void TearDownTestSuite() { pclMyMessageDb.reset(); }
+
+    // Re-encode an ASCII log as a binary frame, with a valid CRC
+    static std::vector<unsigned char> ToBinaryFrame(std::string_view szLog_)
+    {
+        HeaderDecoder clHeaderDecoder(pclMyMessageDb);
+        MessageDecoder clMessageDecoder(pclMyMessageDb);
+        Encoder clEncoder(pclMyMessageDb);
+        const std::vector<unsigned char> vLog = ToFrame(szLog_);
+        IntermediateHeader stHeader;
+        CompositeField stMessage;
+        MetaDataStruct stMetaData;
+        EXPECT_EQ(clHeaderDecoder.Decode(vLog.data(), stHeader, stMetaData), STATUS::SUCCESS);
+        EXPECT_EQ(clMessageDecoder.Decode(vLog.data() + stMetaData.uiHeaderLength, stMessage, stMetaData), STATUS::SUCCESS);
+
+        std::vector<unsigned char> vBuffer(MESSAGE_SIZE_MAX);
+        unsigned char* pucBuffer = vBuffer.data();
+        MessageDataStruct stMessageData;
+        EXPECT_EQ(clEncoder.Encode(&pucBuffer, static_cast<uint32_t>(vBuffer.size()), stHeader, stMessage, stMessageData, stMetaData.eFormat,
+                                   ENCODE_FORMAT::BINARY),
+                  STATUS::SUCCESS);
+        return {stMessageData.pucMessage, stMessageData.pucMessage + stMessageData.uiMessageLength};
+    }
+
+    static void ExpectTables(const ColumnarBatchDecoder& clDecoder_)
+    {
+        const ColumnarTable& clTable = clDecoder_.GetTable();
+        ASSERT_EQ(clTable.size(), 2U);
+        EXPECT_EQ(clTable.GetName(), "VIEWTEST");
+        EXPECT_EQ(clTable.GetValues<uint8_t>("u8"), (std::vector<uint8_t>{200, 100}));
+        EXPECT_EQ(clTable.GetValues<uint32_t>("u32"), (std::vector<uint32_t>{4000000000U, 7}));
+        EXPECT_EQ(clTable.GetValues<double>("value"), (std::vector<double>{1.25, -0.5}));
+        EXPECT_EQ(clTable.GetValues<int32_t>("color"), (std::vector<int32_t>{7, 1}));
+        EXPECT_EQ(clTable.GetColumn("bytes").GetWidth(), 3U);
+        EXPECT_EQ(clTable.GetValues<uint8_t>("bytes"), (std::vector<uint8_t>{0x0A, 0x0B, 0x0C, 0x01, 0x02, 0x03}));
+        EXPECT_EQ(clTable.GetValues<std::string>("station"), (std::vector<std::string>{"a station", "b"}));
+        EXPECT_EQ(clTable.GetValues<uint16_t>("sats"), (std::vector<uint16_t>{1, 2, 65535}));
+        EXPECT_EQ(clTable.GetColumn("sats").GetOffsets(), (std::vector<size_t>{0, 3, 3}));
+        EXPECT_EQ(clTable.GetValues<uint8_t>("valid"), (std::vector<uint8_t>{1, 0}));
+        EXPECT_EQ(clTable.GetWeeks(), (std::vector<uint16_t>{2167, 2167}));
+        EXPECT_EQ(clTable.GetMilliseconds(), (std::vector<double>{244820000.0, 244821000.0}));
+
+        const ColumnarTable& clObs = clDecoder_.GetChildTable("obs");
+        ASSERT_EQ(clObs.size(), 5U);
+        EXPECT_EQ(clObs.GetValues<uint32_t>("prn"), (std::vector<uint32_t>{1, 2, 10, 11, 12}));
+        EXPECT_EQ(clObs.GetValues<int16_t>("snr"), (std::vector<int16_t>{-1, -2, -10, -11, -12}));
+        EXPECT_EQ(clObs.GetParentIndex(), (std::vector<size_t>{0, 0, 1, 1, 1}));
+
+        const ColumnarTable& clStations = clDecoder_.GetChildTable("stations");
+        ASSERT_EQ(clStations.size(), 3U);
+        EXPECT_EQ(clStations.GetValues<std::string>("name"), (std::vector<std::string>{"first", "second", "third"}));
+        EXPECT_THROW(static_cast<void>(clStations.GetColumn("id")), std::runtime_error);
+        EXPECT_EQ(clStations.GetParentIndex(), (std::vector<size_t>{0, 0, 1}));
+    }
+
+    static MessageDatabase::Ptr pclMyMessageDb;
+
+    const std::vector<std::string> vMyFieldNames{"u8", "u32", "value", "color", "bytes", "station", "sats", "valid", "obs", "stations.name"};
+};
+
+MessageDatabase::Ptr ColumnarBatchDecoderTest::pclMyMessageDb = nullptr;
+
+TEST_F(ColumnarBatchDecoderTest, AsciiFrames)
+{
+    ColumnarBatchDecoder clDecoder(pclMyMessageDb, "VIEWTEST", vMyFieldNames);
+    for (std::string_view szLog : {szFirstLog, szSecondLog})
+    {
+        MetaDataStruct stMetaData;
+        ASSERT_EQ(clDecoder.Append(ToFrame(szLog).data(), stMetaData), STATUS::SUCCESS);
+    }
+    ExpectTables(clDecoder);
+}
+
+TEST_F(ColumnarBatchDecoderTest, BinaryFrames)
+{
+    ColumnarBatchDecoder clDecoder(pclMyMessageDb, "VIEWTEST", vMyFieldNames);
+    for (std::string_view szLog : {szFirstLog, szSecondLog})
+    {
+        MetaDataStruct stMetaData;
+        ASSERT_EQ(clDecoder.Append(ToBinaryFrame(szLog).data(), stMetaData), STATUS::SUCCESS);
+        EXPECT_EQ(stMetaData.eFormat, HEADER_FORMAT::BINARY);
+    }
+    ExpectTables(clDecoder);
+}
+
+TEST_F(ColumnarBatchDecoderTest, ReadIntermediateMessages)
+{
+    Parser clParser(pclMyMessageDb);
+    ColumnarBatchDecoder clDecoder(pclMyMessageDb, "VIEWTEST", vMyFieldNames);
+
+    MessageDataStruct stMessageData;
+    IntermediateHeader stHeader;
+    CompositeField stMessage;
+    MetaDataStruct stMetaData;
+    for (const auto& vLog : {ToBinaryFrame(szFirstLog), ToBinaryFrame(szSecondLog)})
+    {
+        ASSERT_EQ(clParser.Write(vLog.data(), static_cast<uint32_t>(vLog.size())), vLog.size());
+        ASSERT_EQ(clParser.ReadIntermediate(stMessageData, stHeader, stMessage, stMetaData), STATUS::SUCCESS);
+        ASSERT_EQ(clDecoder.Append(stMessage, stMetaData), STATUS::SUCCESS);
+    }
+    ExpectTables(clDecoder);
+}
+
+TEST_F(ColumnarBatchDecoderTest, AllFields)
+{
+    ColumnarBatchDecoder clDecoder(pclMyMessageDb, "VIEWTEST");
+    MetaDataStruct stMetaData;
+    ASSERT_EQ(clDecoder.Append(ToFrame(szFirstLog).data(), stMetaData), STATUS::SUCCESS);
+
+    const ColumnarTable& clTable = clDecoder.GetTable();
+    // The second field named "reserved" can't be told apart from the first by name
+    EXPECT_EQ(clTable.GetColumns().size(), 11U);
+    EXPECT_EQ(clTable.GetValues<int32_t>("switch"), (std::vector<int32_t>{-9}));
+    EXPECT_EQ(clTable.GetValues<uint8_t>("reserved"), (std::vector<uint8_t>{7}));
+    EXPECT_EQ(clDecoder.GetChildTable("stations").GetValues<uint32_t>("id"), (std::vector<uint32_t>{5, 6}));
+    EXPECT_THROW(static_cast<void>(clTable.GetValues<int32_t>("u32")), std::runtime_error);
+}
+
+TEST_F(ColumnarBatchDecoderTest, OtherMessages)
+{
+    ColumnarBatchDecoder clDecoder(pclMyMessageDb, "VIEWTEST", vMyFieldNames);
+    MetaDataStruct stMetaData;
+    ASSERT_EQ(clDecoder.Append(ToFrame(szFirstLog).data(), stMetaData), STATUS::SUCCESS);
+
+    CompositeField stMessage;
+    stMetaData.usMessageId = 42;
+    EXPECT_EQ(clDecoder.Append(stMessage, stMetaData), STATUS::UNSUPPORTED);
+    EXPECT_EQ(clDecoder.GetTable().size(), 1U);
+}
+
+TEST_F(ColumnarBatchDecoderTest, ProjectedOutField)
+{
+    HeaderDecoder clHeaderDecoder(pclMyMessageDb);
+    MessageDecoder clMessageDecoder(pclMyMessageDb);
+    clMessageDecoder.SetProjection("VIEWTEST", {"u8", "obs"});
+
+    const std::vector<unsigned char> vLog = ToFrame(szFirstLog);
+    IntermediateHeader stHeader;
+    CompositeField stMessage;
+    MetaDataStruct stMetaData;
+    ASSERT_EQ(clHeaderDecoder.Decode(vLog.data(), stHeader, stMetaData), STATUS::SUCCESS);
+    ASSERT_EQ(clMessageDecoder.Decode(vLog.data() + stMetaData.uiHeaderLength, stMessage, stMetaData), STATUS::SUCCESS);
+
+    ColumnarBatchDecoder clProjectedDecoder(pclMyMessageDb, "VIEWTEST", {"u8", "obs.prn"});
+    EXPECT_EQ(clProjectedDecoder.Append(stMessage, stMetaData), STATUS::SUCCESS);
+    EXPECT_EQ(clProjectedDecoder.GetChildTable("obs").GetValues<uint32_t>("prn"), (std::vector<uint32_t>{1, 2}));
+
+    // Nothing is appended if a field was left out
+    ColumnarBatchDecoder clDecoder(pclMyMessageDb, "VIEWTEST", vMyFieldNames);
+    EXPECT_EQ(clDecoder.Append(stMessage, stMetaData), STATUS::FAILURE);
+    EXPECT_TRUE(clDecoder.GetTable().empty());
+    EXPECT_TRUE(clDecoder.GetChildTable("obs").empty());
+}
+
+TEST_F(ColumnarBatchDecoderTest, FailedAppendLeavesTablesUnchanged)
+{
+    HeaderDecoder clHeaderDecoder(pclMyMessageDb);
+    MessageDecoder clMessageDecoder(pclMyMessageDb);
+    const std::vector<unsigned char> vLog = ToFrame(szSecondLog);
+    IntermediateHeader stHeader;
+    CompositeField stMessage;
+    MetaDataStruct stMetaData;
+    ASSERT_EQ(clHeaderDecoder.Decode(vLog.data(), stHeader, stMetaData), STATUS::SUCCESS);
+    ASSERT_EQ(clMessageDecoder.Decode(vLog.data() + stMetaData.uiHeaderLength, stMessage, stMetaData), STATUS::SUCCESS);
+
+    ColumnarBatchDecoder clDecoder(pclMyMessageDb, "VIEWTEST", vMyFieldNames);
+    MetaDataStruct stFirstMetaData;
+    ASSERT_EQ(clDecoder.Append(ToFrame(szFirstLog).data(), stFirstMetaData), STATUS::SUCCESS);
+
+    // The field arrays are appended before "sats" is found to hold records instead of values
+    CompositeField stBadMessage = stMessage;
+    stBadMessage.EmplaceVarField<CompositeFieldArray>(stMessage.GetFieldInfo()->GetFieldDefByName("sats")->index);
+    EXPECT_THROW(static_cast<void>(clDecoder.Append(stBadMessage, stMetaData)), std::runtime_error);
+
+    EXPECT_EQ(clDecoder.GetTable().size(), 1U);
+    EXPECT_EQ(clDecoder.GetTable().GetValues<uint8_t>("u8"), (std::vector<uint8_t>{200}));
+    EXPECT_EQ(clDecoder.GetTable().GetColumn("sats").GetOffsets(), (std::vector<size_t>{0, 3}));
+    EXPECT_EQ(clDecoder.GetTable().GetWeeks().size(), 1U);
+    EXPECT_EQ(clDecoder.GetChildTable("obs").GetValues<uint32_t>("prn"), (std::vector<uint32_t>{1, 2}));
+    EXPECT_EQ(clDecoder.GetChildTable("obs").GetParentIndex(), (std::vector<size_t>{0, 0}));
+    EXPECT_EQ(clDecoder.GetChildTable("stations").size(), 2U);
+
+    ASSERT_EQ(clDecoder.Append(stMessage, stMetaData), STATUS::SUCCESS);
+    ExpectTables(clDecoder);
+}
+
+TEST_F(ColumnarBatchDecoderTest, ClearKeepsColumns)
+{
+    ColumnarBatchDecoder clDecoder(pclMyMessageDb, "VIEWTEST", vMyFieldNames);
+    clDecoder.Reserve(2, 4);
+    MetaDataStruct stMetaData;
+    ASSERT_EQ(clDecoder.Append(ToFrame(szFirstLog).data(), stMetaData), STATUS::SUCCESS);
+    clDecoder.Clear();
+    EXPECT_TRUE(clDecoder.GetTable().empty());
+    EXPECT_TRUE(clDecoder.GetTable().GetValues<uint8_t>("u8").empty());
+    EXPECT_EQ(clDecoder.GetTable().GetColumn("sats").GetOffsets(), (std::vector<size_t>{0}));
+    EXPECT_TRUE(clDecoder.GetChildTable("obs").GetParentIndex().empty());
+
+    for (std::string_view szLog : {szFirstLog, szSecondLog})
+    {
+        ASSERT_EQ(clDecoder.Append(ToFrame(szLog).data(), stMetaData), STATUS::SUCCESS);
+    }
+    ExpectTables(clDecoder);
+}
+
+TEST_F(ColumnarBatchDecoderTest, UnknownFields)
+{
+    EXPECT_THROW(ColumnarBatchDecoder(pclMyMessageDb, "NOTALOG"), std::runtime_error);
+    EXPECT_THROW(ColumnarBatchDecoder(pclMyMessageDb, "VIEWTEST", {"nope"}), std::runtime_error);
+    EXPECT_THROW(ColumnarBatchDecoder(pclMyMessageDb, "VIEWTEST", {"obs.nope"}), std::runtime_error);
+    EXPECT_THROW(ColumnarBatchDecoder(pclMyMessageDb, "VIEWTEST", {"u8.nope"}), std::runtime_error);
+}
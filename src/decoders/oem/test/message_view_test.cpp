@@ -0,0 +1,192 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ! \file message_view_test.cpp
+// ===============================================================================
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "message_view_db_views.hpp"
+#include "novatel_edie/decoders/common/json_db_reader.hpp"
+#include "novatel_edie/decoders/common/message_view.hpp"
+#include "novatel_edie/decoders/oem/encoder.hpp"
+#include "novatel_edie/decoders/oem/header_decoder.hpp"
+#include "novatel_edie/decoders/oem/message_decoder.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+namespace {
+
+//! A VIEWTEST log, with the message definition CRC of the test database (0x1234) in its header.
+constexpr std::string_view szAsciiLog = "#VIEWTESTA,COM1,0,50.0,FINESTEERING,2167,244820.000,02000000,1234,16248;"
+                                        "200,4000000000,-12,1.25,BLUE,0a0b0c,\"a station\",3,1,2,65535,TRUE,"
+                                        "2,1,-1,2,-2,2,5,\"first\",6,\"second\",-9,7,8*00000000\r\n";
+
+} // namespace
+
+// -------------------------------------------------------------------------------------------------------
+// Message View Tests
+// -------------------------------------------------------------------------------------------------------
+class MessageViewTest : public ::testing::Test
+{
+  protected:
+    static void SetUpTestSuite()
+    {
+        pclMyMessageDb = LoadJsonDbFile(std::filesystem::path(std::getenv("TEST_RESOURCE_PATH")) / "message_view_db.json");
+    }
+
+    static void TearDownTestSuite() { pclMyMessageDb.reset(); }
+
+    void SetUp() override
+    {
+        ASSERT_EQ(DecodeLog(szAsciiLog), STATUS::SUCCESS);
+        ASSERT_EQ(stMyMetaData.uiMessageCrc, test_views::VIEWTEST::messageCrc);
+    }
+
+    STATUS DecodeLog(std::string_view szLog_)
+    {
+        vMyLog.assign(szLog_.begin(), szLog_.end());
+        vMyLog.push_back('\0');
+        stMyMetaData = MetaDataStruct();
+        const STATUS eStatus = clMyHeaderDecoder.Decode(vMyLog.data(), stMyHeader, stMyMetaData);
+        if (eStatus != STATUS::SUCCESS) { return eStatus; }
+        return clMyMessageDecoder.Decode(vMyLog.data() + stMyMetaData.uiHeaderLength, stMyMessage, stMyMetaData);
+    }
+
+    // Re-encode the decoded log in another format and decode it again
+    STATUS Reencode(ENCODE_FORMAT eFormat_)
+    {
+        std::vector<unsigned char> vBuffer(MESSAGE_SIZE_MAX);
+        unsigned char* pucBuffer = vBuffer.data();
+        MessageDataStruct stMessageData;
+        const STATUS eStatus = clMyEncoder.Encode(&pucBuffer, static_cast<uint32_t>(vBuffer.size()), stMyHeader, stMyMessage, stMessageData,
+                                                  stMyMetaData.eFormat, eFormat_);
+        if (eStatus != STATUS::SUCCESS) { return eStatus; }
+        return DecodeLog(std::string_view(reinterpret_cast<const char*>(stMessageData.pucMessage), stMessageData.uiMessageLength));
+    }
+
+    static void ExpectLogValues(const MessageView<test_views::VIEWTEST>& clView_)
+    {
+        EXPECT_EQ(clView_.u8(), 200U);
+        EXPECT_EQ(clView_.u32(), 4000000000U);
+        EXPECT_EQ(clView_.i16(), -12);
+        EXPECT_DOUBLE_EQ(clView_.value(), 1.25);
+        EXPECT_EQ(clView_.color(), 7);
+        ASSERT_EQ(clView_.bytes().size(), 3U);
+        EXPECT_EQ(clView_.bytes()[2], 0x0CU);
+        EXPECT_EQ(clView_.station(), "a station");
+        const TypedBuffer<uint16_t> sats = clView_.sats();
+        ASSERT_EQ(sats.size(), 3U);
+        EXPECT_EQ(sats[0], 1U);
+        EXPECT_EQ(sats[2], 65535U);
+        EXPECT_TRUE(clView_.valid());
+        EXPECT_EQ(clView_.switch_(), -9);
+        EXPECT_EQ(clView_.reserved(), 7U);
+        EXPECT_EQ(clView_.reserved_2(), 8U);
+
+        const auto obs = clView_.obs();
+        ASSERT_EQ(obs.size(), 2U);
+        EXPECT_EQ(obs[0].prn(), 1U);
+        EXPECT_EQ(obs[0].snr(), -1);
+        EXPECT_EQ(obs[1].prn(), 2U);
+        EXPECT_EQ(obs[1].snr(), -2);
+
+        std::vector<std::string> names;
+        for (const auto& station : clView_.stations()) { names.push_back(std::to_string(station.id()) + station.name()); }
+        EXPECT_EQ(names, (std::vector<std::string>{"5first", "6second"}));
+    }
+
+    static MessageDatabase::Ptr pclMyMessageDb;
+
+    HeaderDecoder clMyHeaderDecoder{pclMyMessageDb};
+    MessageDecoder clMyMessageDecoder{pclMyMessageDb};
+    Encoder clMyEncoder{pclMyMessageDb};
+    std::vector<unsigned char> vMyLog;
+    IntermediateHeader stMyHeader;
+    MetaDataStruct stMyMetaData;
+    CompositeField stMyMessage;
+};
+
+MessageDatabase::Ptr MessageViewTest::pclMyMessageDb = nullptr;
+
+TEST_F(MessageViewTest, AsciiLog)
+{
+    ASSERT_TRUE(MessageView<test_views::VIEWTEST>::CanBind(stMyMessage, stMyMetaData));
+    ExpectLogValues(MessageView<test_views::VIEWTEST>(stMyMessage, stMyMetaData));
+}
+
+TEST_F(MessageViewTest, BinaryLog)
+{
+    ASSERT_EQ(Reencode(ENCODE_FORMAT::BINARY), STATUS::SUCCESS);
+    ASSERT_EQ(stMyMetaData.eFormat, HEADER_FORMAT::BINARY);
+    ExpectLogValues(MessageView<test_views::VIEWTEST>(stMyMessage, stMyMetaData));
+}
+
+TEST_F(MessageViewTest, BinaryLogViewDecoding)
+{
+    ASSERT_EQ(Reencode(ENCODE_FORMAT::BINARY), STATUS::SUCCESS);
+    const std::vector<unsigned char> vBinaryLog = vMyLog;
+    clMyMessageDecoder.SetViewDecoding(true);
+    ASSERT_EQ(DecodeLog(std::string_view(reinterpret_cast<const char*>(vBinaryLog.data()), vBinaryLog.size() - 1)), STATUS::SUCCESS);
+    ExpectLogValues(MessageView<test_views::VIEWTEST>(stMyMessage, stMyMetaData));
+}
+
+TEST_F(MessageViewTest, MatchesFieldValues)
+{
+    const MessageView<test_views::VIEWTEST> clView(stMyMessage, stMyMetaData);
+    EXPECT_EQ(clView.u32(), stMyMessage.GetFieldValueByName<uint32_t>("u32"));
+    EXPECT_EQ(clView.value(), stMyMessage.GetFieldValueByName<double>("value"));
+    EXPECT_EQ(clView.reserved_2(), stMyMessage.GetFieldValue<uint32_t>(*stMyMessage.GetFieldInfo()->messageOrderedFields[13]));
+}
+
+TEST_F(MessageViewTest, MessageCrcMismatch)
+{
+    MetaDataStruct stMetaData = stMyMetaData;
+    stMetaData.uiMessageCrc = 0;
+    EXPECT_FALSE(MessageView<test_views::VIEWTEST>::CanBind(stMyMessage, stMetaData));
+    EXPECT_THROW(MessageView<test_views::VIEWTEST>(stMyMessage, stMetaData), std::runtime_error);
+
+    stMetaData = stMyMetaData;
+    stMetaData.usMessageId = 42;
+    EXPECT_FALSE(MessageView<test_views::VIEWTEST>::CanBind(stMyMessage, stMetaData));
+}
+
+TEST_F(MessageViewTest, FieldDefinitionMismatch)
+{
+    const FieldInfo& clFieldInfo = *stMyMessage.GetFieldInfo();
+    EXPECT_TRUE(MatchesLayout<test_views::VIEWTEST>(&clFieldInfo));
+    EXPECT_FALSE(MatchesLayout<test_views::VIEWTEST_obs>(&clFieldInfo));
+
+    // A message definition with the same CRC but another layout is refused
+    FieldInfo clMovedField = clFieldInfo;
+    auto pclField = clMovedField.messageOrderedFields[1]->clone();
+    pclField->index += 4;
+    clMovedField.messageOrderedFields[1] = pclField;
+    clMovedField.InvalidateCaches();
+    EXPECT_FALSE(MatchesLayout<test_views::VIEWTEST>(&clMovedField));
+}
@@ -30,6 +30,7 @@
 // https://stackoverflow.com/questions/42946335/deprecated-header-codecvt-replacement
 #include <codecvt>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 
 #include <gtest/gtest.h>
@@ -1134,6 +1135,91 @@ TEST_F(OEMFramerTest, NULL_FRAME)
     ASSERT_EQ(STATUS::NULL_PROVIDED, pclMyFramer->GetFrame(nullptr, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
 }
 
+TEST_F(OEMFramerTest, FRAME_VIEW)
+{
+    constexpr unsigned char aucData[] = "garbage" "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+    WriteBytesToFramer(aucData, sizeof(aucData) - 1);
+
+    FrameView stView;
+    ASSERT_EQ(STATUS::UNKNOWN, pclMyFramer->GetFrameView(stView, stMyTestMetaData));
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(stView.data()), stView.size()), "garbage");
+    pclMyFramer->Consume();
+
+    // The frame stays in the internal buffer until it is consumed
+    for (int i = 0; i < 2; i++)
+    {
+        ASSERT_EQ(STATUS::SUCCESS, pclMyFramer->GetFrameView(stView, stMyTestMetaData));
+        ASSERT_EQ(stMyTestMetaData.eFormat, HEADER_FORMAT::ASCII);
+        ASSERT_EQ(stView.size(), sizeof(aucData) - 8);
+        ASSERT_EQ(memcmp(stView.data(), &aucData[7], stView.size()), 0);
+    }
+    pclMyFramer->Consume();
+
+    ASSERT_EQ(STATUS::BUFFER_EMPTY, pclMyFramer->GetFrameView(stView, stMyTestMetaData));
+    ASSERT_TRUE(stView.empty());
+}
+
+TEST_F(OEMFramerTest, MIRRORED_BUFFER)
+{
+    constexpr unsigned char aucData[] = "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+    constexpr uint32_t uiLength = sizeof(aucData) - 1;
+
+    // Stream enough frames through the buffer in uneven chunks that its head wraps several times
+    Framer clFramer(FIXED_BUFFER_BACKEND::MIRRORED);
+    std::vector<unsigned char> vStream;
+    const size_t uiFrameCount = 4 * RECOMMENDED_FRAME_BUFFER_SIZE / uiLength;
+    for (size_t i = 0; i < uiFrameCount; i++) { vStream.insert(vStream.end(), aucData, aucData + uiLength); }
+
+    MetaDataStruct stMetaData;
+    FrameView stView;
+    size_t uiWritten = 0;
+    size_t uiFramed = 0;
+    while (uiFramed < uiFrameCount)
+    {
+        uiWritten += clFramer.Write(vStream.data() + uiWritten, std::min<size_t>(vStream.size() - uiWritten, 3001));
+        while (clFramer.GetFrameView(stView, stMetaData) == STATUS::SUCCESS)
+        {
+            ASSERT_EQ(stView.size(), uiLength);
+            ASSERT_EQ(memcmp(stView.data(), aucData, uiLength), 0);
+            clFramer.Consume();
+            uiFramed++;
+        }
+    }
+    ASSERT_EQ(uiWritten, vStream.size());
+}
+
+TEST_F(OEMFramerTest, GET_FRAMES)
+{
+    constexpr unsigned char aucData[] = "garbage"
+                                        "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n"
+                                        "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n"
+                                        "#BESTPOSA,COM1,0,83.5,FINESTEERING";
+    WriteBytesToFramer(aucData, sizeof(aucData) - 1);
+
+    std::array<FrameDescriptor, 8> astFrames;
+    const unsigned char* pucFrameData = nullptr;
+    ASSERT_EQ(pclMyFramer->GetFrames(astFrames.data(), 0, pucFrameData, stMyTestMetaData), 0U);
+
+    // Framing stops at the incomplete log
+    ASSERT_EQ(pclMyFramer->GetFrames(astFrames.data(), astFrames.size(), pucFrameData, stMyTestMetaData), 3U);
+    ASSERT_EQ(memcmp(pucFrameData, aucData, sizeof(aucData) - 1), 0);
+
+    ASSERT_EQ(astFrames[0].eStatus, STATUS::UNKNOWN);
+    ASSERT_EQ(astFrames[0].uiOffset, 0U);
+    ASSERT_EQ(astFrames[0].uiLength, 7U);
+    for (size_t i = 1; i < 3; i++)
+    {
+        ASSERT_EQ(astFrames[i].eStatus, STATUS::SUCCESS);
+        ASSERT_EQ(astFrames[i].eFormat, HEADER_FORMAT::ASCII);
+        ASSERT_EQ(astFrames[i].uiOffset, 7U + (i - 1) * 217U);
+        ASSERT_EQ(astFrames[i].uiLength, 217U);
+    }
+
+    // The framed bytes are removed from the buffer, leaving only the incomplete log
+    ASSERT_EQ(pclMyFramer->GetFrames(astFrames.data(), astFrames.size(), pucFrameData, stMyTestMetaData), 0U);
+    FramerHelper<HEADER_FORMAT::ASCII, STATUS::INCOMPLETE>(34, MAX_ASCII_MESSAGE_LENGTH);
+}
+
 
 // -------------------------------------------------------------------------------------------------------
 // Mock Framer for testing the FramerManager - Recognizes messages starting with "<log>" and ending with "</log>"
@@ -1145,12 +1231,20 @@ class MockFramer : public FramerBase
     MockFramerState eMyState{MockFramerState::WAITING_FOR_SYNC};
 
   public:
+    static inline uint32_t uiGetFrameCount = 0;
+    static inline uint32_t uiResetStateCount = 0;
+
     MockFramer(std::shared_ptr<UCharFixedBuffer> buffer) : FramerBase("mock_framer", buffer) {}
 
-    void ResetState() override { eMyState = MockFramerState::WAITING_FOR_SYNC; }
+    void ResetState() override
+    {
+        uiResetStateCount++;
+        eMyState = MockFramerState::WAITING_FOR_SYNC;
+    }
 
     STATUS GetFrame(unsigned char* pucFrameBuffer_, uint32_t uiFrameBufferSize_, MetaDataBase& stMetaData_, bool bMetadataOnly_ = false) override
     {
+        uiGetFrameCount++;
         if (pucFrameBuffer_ == nullptr) { return STATUS::NULL_PROVIDED; }
 
         while (eMyState != MockFramerState::COMPLETE)
@@ -1255,7 +1349,7 @@ class MockFramer : public FramerBase
 };
 
 // Register the MockFramer with the framer factory
-REGISTER_FRAMER(MockFramer, MockFramer, MetaDataStruct)
+REGISTER_FRAMER(MockFramer, MockFramer, MetaDataStruct, '<')
 
 
 class FramerManagerTest : public ::testing::Test
@@ -2045,6 +2139,227 @@ TEST_F(FramerManagerTest, NULL_FRAME)
     ASSERT_EQ(STATUS::BUFFER_EMPTY, pclMyFramerManager->GetFrame(nullptr, MAX_ASCII_MESSAGE_LENGTH, stMetaData));
 }
 
+TEST_F(FramerManagerTest, FRAME_VIEW)
+{
+    constexpr unsigned char aucData[] = "<log>testing123</log>\r\n" "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+    WriteBytesToFramer(aucData, sizeof(aucData) - 1);
+
+    FrameView stView;
+    MetaDataBase* stMetaData;
+    ASSERT_EQ(STATUS::SUCCESS, pclMyFramerManager->GetFrameView(stView, stMetaData));
+    ASSERT_EQ(stMetaData->eFormat, HEADER_FORMAT::PROPRIETARY_BINARY);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(stView.data()), stView.size()), "<log>testing123</log>");
+    pclMyFramerManager->Consume();
+
+    ASSERT_EQ(STATUS::UNKNOWN, pclMyFramerManager->GetFrameView(stView, stMetaData));
+    ASSERT_EQ(stView.size(), 2U); // The '\r\n' after the mock log
+    pclMyFramerManager->Consume();
+
+    ASSERT_EQ(STATUS::SUCCESS, pclMyFramerManager->GetFrameView(stView, stMetaData));
+    ASSERT_EQ(stMetaData->eFormat, HEADER_FORMAT::ASCII);
+    ASSERT_EQ(stView.size(), 217U);
+    ASSERT_EQ(memcmp(stView.data(), &aucData[23], stView.size()), 0);
+
+    // Flushing discards an unconsumed view, so a later Consume() must not remove new data
+    ASSERT_EQ(pclMyFramerManager->Flush(nullptr, MAX_ASCII_MESSAGE_LENGTH), 217U);
+    WriteBytesToFramer(&aucData[23], 217);
+    pclMyFramerManager->Consume();
+    FramerManagerHelper<HEADER_FORMAT::ASCII, STATUS::SUCCESS>(217, MAX_ASCII_MESSAGE_LENGTH);
+}
+
+TEST_F(FramerManagerTest, GET_FRAMES)
+{
+    constexpr unsigned char aucData[] = "<log>testing123</log>\r\n"
+                                        "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n"
+                                        "#BESTPOSA,COM1";
+    WriteBytesToFramer(aucData, sizeof(aucData) - 1);
+
+    std::array<FrameDescriptor, 2> astFrames;
+    const unsigned char* pucFrameData = nullptr;
+
+    // The batch is limited by the number of descriptors
+    ASSERT_EQ(pclMyFramerManager->GetFrames(astFrames.data(), astFrames.size(), pucFrameData), 2U);
+    ASSERT_EQ(astFrames[0].eStatus, STATUS::SUCCESS);
+    ASSERT_EQ(astFrames[0].eFormat, HEADER_FORMAT::PROPRIETARY_BINARY);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(pucFrameData + astFrames[0].uiOffset), astFrames[0].uiLength), "<log>testing123</log>");
+    ASSERT_EQ(astFrames[1].eStatus, STATUS::UNKNOWN);
+    ASSERT_EQ(astFrames[1].uiOffset, 21U);
+    ASSERT_EQ(astFrames[1].uiLength, 2U); // The '\r\n' after the mock log
+
+    ASSERT_EQ(pclMyFramerManager->GetFrames(astFrames.data(), astFrames.size(), pucFrameData), 1U);
+    ASSERT_EQ(astFrames[0].eStatus, STATUS::SUCCESS);
+    ASSERT_EQ(astFrames[0].eFormat, HEADER_FORMAT::ASCII);
+    ASSERT_EQ(astFrames[0].uiOffset, 0U);
+    ASSERT_EQ(astFrames[0].uiLength, 217U);
+    ASSERT_EQ(memcmp(pucFrameData, &aucData[23], astFrames[0].uiLength), 0);
+
+    FramerManagerHelper<HEADER_FORMAT::ASCII, STATUS::INCOMPLETE>(14, MAX_ASCII_MESSAGE_LENGTH);
+}
+
+TEST_F(FramerManagerTest, GET_FRAMES_VALIDITY)
+{
+    constexpr unsigned char aucData[] = "junk#junk<log>testing123</log>"
+                                        "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n"
+                                        "junk#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n"
+                                        "#BESTPOSA,COM1";
+    constexpr size_t uiDataLength = sizeof(aucData) - 1;
+
+    for (const bool bSkipAheadResync : {false, true})
+    {
+        pclMyFramerManager->SetSkipAheadResync(bSkipAheadResync);
+        WriteBytesToFramer(aucData, uiDataLength);
+
+        // Every batch must still read the written bytes after the calls the documentation allows between batches and Write
+        std::array<FrameDescriptor, 2> astFirst;
+        const unsigned char* pucFirstData = nullptr;
+        const size_t uiFirstCount = pclMyFramerManager->GetFrames(astFirst.data(), astFirst.size(), pucFirstData);
+        ASSERT_EQ(uiFirstCount, astFirst.size());
+
+        std::array<FrameDescriptor, 16> astSecond;
+        const unsigned char* pucSecondData = nullptr;
+        const size_t uiSecondCount = pclMyFramerManager->GetFrames(astSecond.data(), astSecond.size(), pucSecondData);
+        ASSERT_GT(uiSecondCount, 0U);
+
+        FrameView stView;
+        MetaDataBase* stMetaData;
+        ASSERT_EQ(STATUS::INCOMPLETE, pclMyFramerManager->GetFrameView(stView, stMetaData));
+        pclMyFramerManager->Consume();
+        FramerManagerHelper<HEADER_FORMAT::ASCII, STATUS::INCOMPLETE>(14, MAX_ASCII_MESSAGE_LENGTH);
+        pclMyFramerManager->ResetAllFramerStates();
+        FlushFramer();
+
+        size_t uiOffset = 0;
+        for (size_t i = 0; i < uiFirstCount; i++)
+        {
+            ASSERT_EQ(memcmp(pucFirstData + astFirst[i].uiOffset, aucData + uiOffset, astFirst[i].uiLength), 0);
+            uiOffset += astFirst[i].uiLength;
+        }
+        for (size_t i = 0; i < uiSecondCount; i++)
+        {
+            ASSERT_EQ(memcmp(pucSecondData + astSecond[i].uiOffset, aucData + uiOffset, astSecond[i].uiLength), 0);
+            uiOffset += astSecond[i].uiLength;
+        }
+        ASSERT_EQ(uiOffset, uiDataLength - 14);
+        ASSERT_EQ(astSecond[uiSecondCount - 1].eStatus, STATUS::SUCCESS);
+    }
+    pclMyFramerManager->SetSkipAheadResync(false);
+}
+
+TEST_F(FramerManagerTest, SYNC_DISPATCH)
+{
+    constexpr unsigned char aucAscii[] = "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+    constexpr unsigned char aucMock[] = "<log>testing123</log>";
+    MockFramer::uiGetFrameCount = 0;
+    MockFramer::uiResetStateCount = 0;
+
+    // A frame starting with '#' is never shown to the mock framer, which only registered '<'
+    WriteBytesToFramer(aucAscii, sizeof(aucAscii) - 1);
+    FramerManagerHelper<HEADER_FORMAT::ASCII, STATUS::SUCCESS>(217, MAX_ASCII_MESSAGE_LENGTH);
+    ASSERT_EQ(MockFramer::uiGetFrameCount, 0U);
+    ASSERT_EQ(MockFramer::uiResetStateCount, 0U);
+
+    WriteBytesToFramer(aucMock, sizeof(aucMock) - 1);
+    FramerManagerHelper<HEADER_FORMAT::PROPRIETARY_BINARY, STATUS::SUCCESS>(sizeof(aucMock) - 1, MAX_ASCII_MESSAGE_LENGTH);
+    ASSERT_GT(MockFramer::uiGetFrameCount, 0U);
+    ASSERT_GT(MockFramer::uiResetStateCount, 0U);
+
+    // Bytes that start no frame are sized by every framer
+    MockFramer::uiGetFrameCount = 0;
+    WriteBytesToFramer(reinterpret_cast<const unsigned char*>("garbage"), 7);
+    FramerManagerHelper<HEADER_FORMAT::UNKNOWN, STATUS::UNKNOWN>(7, MAX_ASCII_MESSAGE_LENGTH);
+    ASSERT_GT(MockFramer::uiGetFrameCount, 0U);
+}
+
+TEST_F(FramerManagerTest, SCAN_CURSOR)
+{
+    constexpr unsigned char aucMock[] = "<log>testing123</log>";
+    constexpr uint32_t uiSplit = 12;
+    MockFramer::uiGetFrameCount = 0;
+
+    // An incomplete frame is only scanned again once more bytes arrive
+    WriteBytesToFramer(aucMock, uiSplit);
+    FramerManagerHelper<HEADER_FORMAT::UNKNOWN, STATUS::INCOMPLETE>(uiSplit, MAX_ASCII_MESSAGE_LENGTH, false);
+    const uint32_t uiGetFrameCount = MockFramer::uiGetFrameCount;
+    FramerManagerHelper<HEADER_FORMAT::UNKNOWN, STATUS::INCOMPLETE>(uiSplit, MAX_ASCII_MESSAGE_LENGTH, false);
+    ASSERT_EQ(MockFramer::uiGetFrameCount, uiGetFrameCount);
+
+    WriteBytesToFramer(aucMock + uiSplit, sizeof(aucMock) - 1 - uiSplit);
+    FramerManagerHelper<HEADER_FORMAT::PROPRIETARY_BINARY, STATUS::SUCCESS>(sizeof(aucMock) - 1, MAX_ASCII_MESSAGE_LENGTH);
+    ASSERT_EQ(MockFramer::uiGetFrameCount, uiGetFrameCount + 1);
+
+    // The cursor is reset once the frame is consumed
+    WriteBytesToFramer(aucMock, uiSplit);
+    FramerManagerHelper<HEADER_FORMAT::UNKNOWN, STATUS::INCOMPLETE>(uiSplit, MAX_ASCII_MESSAGE_LENGTH, false);
+    ASSERT_EQ(MockFramer::uiGetFrameCount, uiGetFrameCount + 2);
+    pclMyFramerManager->ResetAllFramerStates();
+    FramerManagerHelper<HEADER_FORMAT::UNKNOWN, STATUS::INCOMPLETE>(uiSplit, MAX_ASCII_MESSAGE_LENGTH, false);
+    ASSERT_EQ(MockFramer::uiGetFrameCount, uiGetFrameCount + 3);
+}
+
+TEST_F(FramerManagerTest, CHUNKED_ASCII)
+{
+    constexpr unsigned char aucData[] = "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+
+    // Deliver the frame a few bytes at a time, including splits inside the CRC and the CRLF
+    for (uint32_t uiChunkSize : {1U, 3U, 64U})
+    {
+        uint32_t uiWritten = 0;
+        while (uiWritten + uiChunkSize < sizeof(aucData) - 1)
+        {
+            WriteBytesToFramer(aucData + uiWritten, uiChunkSize);
+            uiWritten += uiChunkSize;
+            FramerManagerHelper<HEADER_FORMAT::ASCII, STATUS::INCOMPLETE>(uiWritten, MAX_ASCII_MESSAGE_LENGTH);
+        }
+        WriteBytesToFramer(aucData + uiWritten, sizeof(aucData) - 1 - uiWritten);
+        FramerManagerHelper<HEADER_FORMAT::ASCII, STATUS::SUCCESS>(217, MAX_ASCII_MESSAGE_LENGTH);
+    }
+}
+
+TEST_F(FramerManagerTest, SKIP_AHEAD_RESYNC)
+{
+    constexpr unsigned char aucData[] = "junk#junk%junk\xAA\x44junk#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+    constexpr uint32_t uiJunkLength = 20;
+    pclMyFramerManager->SetSkipAheadResync(true);
+
+    // The false candidates are skipped as one chunk
+    WriteBytesToFramer(aucData, sizeof(aucData) - 1);
+    FramerManagerHelper<HEADER_FORMAT::UNKNOWN, STATUS::UNKNOWN>(uiJunkLength, MAX_ASCII_MESSAGE_LENGTH);
+    ASSERT_EQ(memcmp(pucMyTestFrameBuffer.get(), aucData, uiJunkLength), 0);
+    FramerManagerHelper<HEADER_FORMAT::ASCII, STATUS::SUCCESS>(217, MAX_ASCII_MESSAGE_LENGTH);
+
+    // The chunk is limited by the frame buffer size
+    WriteBytesToFramer(aucData, sizeof(aucData) - 1);
+    FramerManagerHelper<HEADER_FORMAT::UNKNOWN, STATUS::UNKNOWN>(3, 3);
+    ASSERT_EQ(memcmp(pucMyTestFrameBuffer.get(), aucData, 3), 0);
+    FramerManagerHelper<HEADER_FORMAT::UNKNOWN, STATUS::UNKNOWN>(uiJunkLength - 3, MAX_ASCII_MESSAGE_LENGTH);
+    ASSERT_EQ(memcmp(pucMyTestFrameBuffer.get(), aucData + 3, uiJunkLength - 3), 0);
+    FramerManagerHelper<HEADER_FORMAT::ASCII, STATUS::SUCCESS>(217, MAX_ASCII_MESSAGE_LENGTH);
+
+    // Views and batches see the same chunk
+    WriteBytesToFramer(aucData, sizeof(aucData) - 1);
+    FrameView stView;
+    MetaDataBase* stMetaData;
+    ASSERT_EQ(STATUS::UNKNOWN, pclMyFramerManager->GetFrameView(stView, stMetaData));
+    ASSERT_EQ(stView.size(), uiJunkLength);
+    ASSERT_EQ(memcmp(stView.data(), aucData, uiJunkLength), 0);
+    pclMyFramerManager->Consume();
+    ASSERT_EQ(STATUS::SUCCESS, pclMyFramerManager->GetFrameView(stView, stMetaData));
+    ASSERT_EQ(stView.size(), 217U);
+    pclMyFramerManager->Consume();
+
+    WriteBytesToFramer(aucData, sizeof(aucData) - 1);
+    std::array<FrameDescriptor, 4> astFrames;
+    const unsigned char* pucFrameData = nullptr;
+    ASSERT_EQ(pclMyFramerManager->GetFrames(astFrames.data(), astFrames.size(), pucFrameData), 2U);
+    ASSERT_EQ(astFrames[0].eStatus, STATUS::UNKNOWN);
+    ASSERT_EQ(astFrames[0].uiLength, uiJunkLength);
+    ASSERT_EQ(astFrames[1].eStatus, STATUS::SUCCESS);
+    ASSERT_EQ(astFrames[1].uiOffset, uiJunkLength);
+    ASSERT_EQ(astFrames[1].uiLength, 217U);
+
+    pclMyFramerManager->SetSkipAheadResync(false);
+}
+
 // -------------------------------------------------------------------------------------------------------
 // Multi-Framer Framer Manager Unit Tests
 // -------------------------------------------------------------------------------------------------------
@@ -4064,6 +4379,64 @@ TEST_F(FileParserTest, RESET)
     ASSERT_TRUE(pclFp->Reset());
 }
 
+TEST_F(FileParserTest, SET_FILE)
+{
+    pclFp = std::make_unique<FileParser>(std::getenv("TEST_DATABASE_PATH"));
+    pclFp->SetReturnUnknownBytes(true);
+
+    // Concatenate the resources a few times so that the file is larger than the parser's buffer
+    const std::filesystem::path clResourcePath = std::getenv("TEST_RESOURCE_PATH");
+    const std::filesystem::path clFilePath = std::filesystem::temp_directory_path() / "edie_file_parser_set_file.bin";
+    {
+        std::ofstream clOutput(clFilePath, std::ios::binary);
+        for (int i = 0; i < 3; ++i)
+        {
+            for (const char* szFile : {"BESTUTMBIN.GPS", "ascii_sync_error.ASC", "binary_sync_error.BIN", "short_ascii_sync_error.ASC"})
+            {
+                clOutput << std::ifstream(clResourcePath / szFile, std::ios::binary).rdbuf();
+            }
+        }
+    }
+
+    auto ReadAll = [&]() {
+        std::vector<std::pair<STATUS, std::string>> vResults;
+        MetaDataStruct stMetaData;
+        MessageDataStruct stMessageData;
+        STATUS eStatus;
+        while ((eStatus = pclFp->Read(stMessageData, stMetaData)) != STATUS::STREAM_EMPTY)
+        {
+            const std::string sMessage(reinterpret_cast<const char*>(stMessageData.pucMessage), stMessageData.uiMessageLength);
+            // How a run of unknown bytes is split depends on how much of the file is buffered at once
+            if (eStatus == STATUS::UNKNOWN && !vResults.empty() && vResults.back().first == STATUS::UNKNOWN) { vResults.back().second += sMessage; }
+            else { vResults.emplace_back(eStatus, sMessage); }
+        }
+        return vResults;
+    };
+
+    ASSERT_TRUE(pclFp->SetStream(std::make_shared<std::ifstream>(clFilePath, std::ios::binary)));
+    ASSERT_FALSE(pclFp->IsFileMapped());
+    const auto vExpected = ReadAll();
+    ASSERT_FALSE(vExpected.empty());
+
+    ASSERT_TRUE(pclFp->SetFile(clFilePath));
+#if defined(__unix__) || defined(__APPLE__)
+    ASSERT_TRUE(pclFp->IsFileMapped());
+#endif
+    ASSERT_EQ(ReadAll(), vExpected);
+
+    // Reset() rewinds the mapped file
+    ASSERT_TRUE(pclFp->Reset());
+    ASSERT_EQ(ReadAll(), vExpected);
+
+    // A stream replaces the mapped file
+    ASSERT_TRUE(pclFp->SetStream(std::make_shared<std::ifstream>(clFilePath, std::ios::binary)));
+    ASSERT_FALSE(pclFp->IsFileMapped());
+    ASSERT_EQ(ReadAll(), vExpected);
+
+    ASSERT_FALSE(pclFp->SetFile(clResourcePath / "does_not_exist.GPS"));
+    std::filesystem::remove(clFilePath);
+}
+
 // -------------------------------------------------------------------------------------------------------
 // Parser Unit Tests
 // -------------------------------------------------------------------------------------------------------
@@ -4363,6 +4736,20 @@ class NovatelTypesTest : public ::testing::Test
     }
 };
 
+TEST_F(NovatelTypesTest, ASCII_OEM_CONVERTER_BOUND_AFTER_DATABASE)
+{
+    MsgDefFields.emplace_back(std::make_shared<BaseField>("Float", FIELD_TYPE::SIMPLE, "%k", DATA_TYPE::FLOAT));
+    // Number the OEM-only conversion string before the decoder binds its converters
+    static_cast<void>(BuildFieldInfo(MsgDefFields).GetDecodePlan());
+    DecoderTester clDecoder(pclMyJsonDb);
+    CompositeField vIntermediateFormat_;
+
+    const auto* testInput = "1.5";
+
+    ASSERT_EQ(clDecoder.TestDecodeAscii(MsgDefFields, &testInput, vIntermediateFormat_), STATUS::SUCCESS);
+    ASSERT_EQ(vIntermediateFormat_.GetFieldValue<float>(*MsgDefFields[0]), 1.5F);
+}
+
 TEST_F(NovatelTypesTest, ASCII_GPSTIME_MSEC_VALID)
 {
     MsgDefFields.emplace_back(std::make_shared<BaseField>("Sec1", FIELD_TYPE::SIMPLE, "%T", DATA_TYPE::ULONG));
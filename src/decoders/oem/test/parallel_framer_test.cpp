@@ -0,0 +1,153 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file parallel_framer_test.cpp
+// ===============================================================================
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "novatel_edie/decoders/oem/framer.hpp"
+#include "novatel_edie/decoders/oem/parallel_framer.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+namespace {
+
+constexpr unsigned char aucAsciiBestPos[] =
+    "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,-17.0000,"
+    "WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+
+constexpr unsigned char aucAbbrevAsciiBestPos[] =
+    "<BESTPOS COM1 0 72.0 FINESTEERING 2215 148248.000 02000020 cdba 32768\r\n"
+    "<     SOL_COMPUTED SINGLE 51.15043711386 -114.03067767000 1097.2099 -17.0000 WGS84 0.9038 0.8534 1.7480 \"\" 0.000 0.000 35 30 30 30 00 06 39 "
+    "33\r\n";
+
+constexpr unsigned char aucBinaryBestPos[] = {
+    0xAA, 0x44, 0x12, 0x1C, 0x2A, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x00, 0xA3, 0xB4, 0x73, 0x08, 0x98, 0x74, 0xA8, 0x13, 0x00, 0x00, 0x00, 0x02,
+    0xF6, 0xB1, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xFC, 0xAB, 0xE1, 0x82, 0x41, 0x93, 0x49, 0x40, 0xBA, 0x32, 0x86, 0x8A,
+    0xF6, 0x81, 0x5C, 0xC0, 0x00, 0x10, 0xE5, 0xDF, 0x71, 0x23, 0x91, 0x40, 0x00, 0x00, 0x88, 0xC1, 0x3D, 0x00, 0x00, 0x00, 0x24, 0x21, 0xA5, 0x3F,
+    0xF1, 0x8F, 0x8F, 0x3F, 0x43, 0x74, 0x3C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x15, 0x00,
+    0x00, 0x02, 0x11, 0x01, 0x55, 0xCE, 0xC3, 0x89};
+
+//! \brief Frame the data with a single Framer, the way a Parser would.
+std::vector<FrameLocation> FrameSequentially(const std::vector<unsigned char>& vData_)
+{
+    std::vector<FrameLocation> vFrames;
+    std::vector<unsigned char> vFrameBuffer(MAX_ASCII_MESSAGE_LENGTH);
+    Framer clFramer;
+    MetaDataStruct stMetaData;
+    uint64_t ullOffset = 0;
+    size_t uiWritten = 0;
+
+    while (true)
+    {
+        uiWritten += clFramer.Write(vData_.data() + uiWritten, std::min(clFramer.GetAvailableSpace(), vData_.size() - uiWritten));
+
+        STATUS eStatus;
+        while ((eStatus = clFramer.GetFrame(vFrameBuffer.data(), static_cast<uint32_t>(vFrameBuffer.size()), stMetaData)) == STATUS::SUCCESS ||
+               eStatus == STATUS::UNKNOWN)
+        {
+            if (eStatus == STATUS::SUCCESS) { vFrames.push_back(FrameLocation{ullOffset, stMetaData.uiLength, stMetaData.eFormat}); }
+            ullOffset += stMetaData.uiLength;
+        }
+
+        if (uiWritten == vData_.size()) { return vFrames; }
+    }
+}
+
+//! \brief Append a message, dropping the null terminator of string literals.
+template <size_t N> void Append(std::vector<unsigned char>& vData_, const unsigned char (&aucMessage_)[N])
+{
+    vData_.insert(vData_.end(), aucMessage_, aucMessage_ + (aucMessage_[N - 1] == '\0' ? N - 1 : N));
+}
+
+} // namespace
+
+class ParallelFramerTest : public ::testing::Test
+{
+  protected:
+    ParallelFramer clMyParallelFramer{1};
+};
+
+TEST_F(ParallelFramerTest, EMPTY)
+{
+    ASSERT_TRUE(clMyParallelFramer.Frame(nullptr, 0).empty());
+
+    const std::vector<unsigned char> vJunk(1000, 'x');
+    clMyParallelFramer.SetThreadCount(4);
+    clMyParallelFramer.SetMinChunkSize(1);
+    ASSERT_TRUE(clMyParallelFramer.Frame(vJunk.data(), vJunk.size()).empty());
+}
+
+TEST_F(ParallelFramerTest, CHUNK_BOUNDARIES)
+{
+    // A mix of formats, junk that contains sync bytes, a truncated frame and a frame inside junk
+    std::vector<unsigned char> vData;
+    for (int i = 0; i < 4; ++i)
+    {
+        Append(vData, aucAsciiBestPos);
+        Append(vData, aucBinaryBestPos);
+        Append(vData, reinterpret_cast<const unsigned char(&)[13]>("#junk<junk*\xAA"));
+        Append(vData, aucAbbrevAsciiBestPos);
+        vData.insert(vData.end(), aucAsciiBestPos, aucAsciiBestPos + 100);
+        Append(vData, aucBinaryBestPos);
+    }
+    const std::vector<FrameLocation> vExpected = FrameSequentially(vData);
+    ASSERT_GT(vExpected.size(), 12U);
+
+    // With a chunk per thread, every thread count places the chunk boundaries differently
+    clMyParallelFramer.SetMinChunkSize(1);
+    for (size_t uiThreadCount = 1; uiThreadCount <= 64; ++uiThreadCount)
+    {
+        clMyParallelFramer.SetThreadCount(uiThreadCount);
+        ASSERT_EQ(clMyParallelFramer.Frame(vData.data(), vData.size()), vExpected) << uiThreadCount << " threads";
+    }
+}
+
+TEST_F(ParallelFramerTest, FILES)
+{
+    std::vector<unsigned char> vData;
+    for (const char* szFileName : {"ascii_sync_error.ASC", "binary_sync_error.BIN", "abbreviated_ascii_sync_error.ASC", "short_ascii_sync_error.ASC",
+                                   "BESTUTMBIN.GPS", "short_binary_sync_error.BIN", "nmea_sync_error.txt"})
+    {
+        std::ifstream clFile(std::filesystem::path(std::getenv("TEST_RESOURCE_PATH")) / szFileName, std::ios::binary);
+        ASSERT_TRUE(clFile.is_open()) << szFileName;
+        vData.insert(vData.end(), std::istreambuf_iterator<char>(clFile), std::istreambuf_iterator<char>());
+    }
+    const std::vector<FrameLocation> vExpected = FrameSequentially(vData);
+    ASSERT_FALSE(vExpected.empty());
+
+    clMyParallelFramer.SetMinChunkSize(4096);
+    for (size_t uiThreadCount : {1, 2, 3, 4, 8, 16})
+    {
+        clMyParallelFramer.SetThreadCount(uiThreadCount);
+        ASSERT_EQ(clMyParallelFramer.Frame(vData.data(), vData.size()), vExpected) << uiThreadCount << " threads";
+    }
+}
@@ -0,0 +1,412 @@
+// ===============================================================================
+// |                                                                             |
+// |  COPYRIGHT NovAtel Inc, 2022. All rights reserved.                          |
+// |                                                                             |
+// |  Permission is hereby granted, free of charge, to any person obtaining a    |
+// |  copy of this software and associated documentation files (the "Software"), |
+// |  to deal in the Software without restriction, including without limitation  |
+// |  the rights to use, copy, modify, merge, publish, distribute, sublicense,   |
+// |  and/or sell copies of the Software, and to permit persons to whom the      |
+// |  Software is furnished to do so, subject to the following conditions:       |
+// |                                                                             |
+// |  The above copyright notice and this permission notice shall be included    |
+// |  in all copies or substantial portions of the Software.                     |
+// |                                                                             |
+// |  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR |
+// |  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   |
+// |  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    |
+// |  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER |
+// |  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    |
+// |  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        |
+// |  DEALINGS IN THE SOFTWARE.                                                  |
+// |                                                                             |
+// ===============================================================================
+// ! \file parser_allocation_test.cpp
+// ===============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include "novatel_edie/decoders/common/json_db_reader.hpp"
+#include "novatel_edie/decoders/oem/encoder.hpp"
+#include "novatel_edie/decoders/oem/header_decoder.hpp"
+#include "novatel_edie/decoders/oem/message_decoder.hpp"
+#include "novatel_edie/decoders/oem/parser.hpp"
+#include "novatel_edie/decoders/oem/rangecmp/range_decompressor.hpp"
+
+using namespace novatel::edie;
+using namespace novatel::edie::oem;
+
+// Count every allocation made through any replaceable global operator new in this binary, including the array, nothrow
+// and aligned forms. It is built on its own, so that the replacements do not affect the other OEM tests.
+static std::atomic<uint64_t> ullAllocationCount{0};
+
+static void* Allocate(const size_t uiSize_) noexcept
+{
+    ++ullAllocationCount;
+    return std::malloc(uiSize_ == 0 ? 1 : uiSize_);
+}
+
+static void* AllocateAligned(const size_t uiSize_, const std::align_val_t eAlignment_) noexcept
+{
+    ++ullAllocationCount;
+    const auto uiAlignment = static_cast<size_t>(eAlignment_);
+#ifdef _WIN32
+    return _aligned_malloc(uiSize_ == 0 ? 1 : uiSize_, uiAlignment);
+#else
+    // aligned_alloc() requires the size to be a multiple of the alignment
+    return std::aligned_alloc(uiAlignment, (std::max<size_t>(uiSize_, 1) + uiAlignment - 1) / uiAlignment * uiAlignment);
+#endif
+}
+
+static void FreeAligned(void* pvMemory_) noexcept
+{
+#ifdef _WIN32
+    _aligned_free(pvMemory_);
+#else
+    std::free(pvMemory_);
+#endif
+}
+
+static void* ThrowIfNull(void* pvMemory_)
+{
+    if (pvMemory_ == nullptr) { throw std::bad_alloc(); }
+    return pvMemory_;
+}
+
+void* operator new(size_t uiSize_) { return ThrowIfNull(Allocate(uiSize_)); }
+void* operator new[](size_t uiSize_) { return ThrowIfNull(Allocate(uiSize_)); }
+void* operator new(size_t uiSize_, const std::nothrow_t&) noexcept { return Allocate(uiSize_); }
+void* operator new[](size_t uiSize_, const std::nothrow_t&) noexcept { return Allocate(uiSize_); }
+void* operator new(size_t uiSize_, std::align_val_t eAlignment_) { return ThrowIfNull(AllocateAligned(uiSize_, eAlignment_)); }
+void* operator new[](size_t uiSize_, std::align_val_t eAlignment_) { return ThrowIfNull(AllocateAligned(uiSize_, eAlignment_)); }
+void* operator new(size_t uiSize_, std::align_val_t eAlignment_, const std::nothrow_t&) noexcept { return AllocateAligned(uiSize_, eAlignment_); }
+void* operator new[](size_t uiSize_, std::align_val_t eAlignment_, const std::nothrow_t&) noexcept { return AllocateAligned(uiSize_, eAlignment_); }
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* pvMemory_) noexcept { std::free(pvMemory_); }
+void operator delete[](void* pvMemory_) noexcept { std::free(pvMemory_); }
+void operator delete(void* pvMemory_, size_t) noexcept { std::free(pvMemory_); }
+void operator delete[](void* pvMemory_, size_t) noexcept { std::free(pvMemory_); }
+void operator delete(void* pvMemory_, const std::nothrow_t&) noexcept { std::free(pvMemory_); }
+void operator delete[](void* pvMemory_, const std::nothrow_t&) noexcept { std::free(pvMemory_); }
+void operator delete(void* pvMemory_, std::align_val_t) noexcept { FreeAligned(pvMemory_); }
+void operator delete[](void* pvMemory_, std::align_val_t) noexcept { FreeAligned(pvMemory_); }
+void operator delete(void* pvMemory_, size_t, std::align_val_t) noexcept { FreeAligned(pvMemory_); }
+void operator delete[](void* pvMemory_, size_t, std::align_val_t) noexcept { FreeAligned(pvMemory_); }
+void operator delete(void* pvMemory_, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(pvMemory_); }
+void operator delete[](void* pvMemory_, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(pvMemory_); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+
+//! A database with one log covering the field kinds common logs are made of.
+constexpr std::string_view szDatabase = R"({
+  "meta": {"messageFamily": "OEM", "version": "1.0.0", "subset": ""},
+  "enums": [
+    {"name": "Responses", "_id": "0", "enumerators": []},
+    {"name": "Commands", "_id": "1", "enumerators": []},
+    {"name": "PortAddress", "_id": "2", "enumerators": [{"name": "COM1", "value": 32, "description": ""}]},
+    {"name": "GPSTimeStatus", "_id": "3", "enumerators": [{"name": "FINESTEERING", "value": 180, "description": ""}]},
+    {"name": "SolStatus", "_id": "4", "enumerators": [{"name": "SOL_COMPUTED", "value": 0, "description": ""},
+                                                     {"name": "INSUFFICIENT_OBS", "value": 1, "description": ""}]}
+  ],
+  "messages": [{"_id": "0", "messageID": 42, "name": "ALLOCTEST", "description": "", "latestMsgDefCrc": "0", "fields": {"0": [
+    {"name": "status", "description": "", "type": "ENUM", "enumID": "4",
+     "dataType": {"name": "ENUM", "length": 4, "description": ""}, "conversionString": "%s"},
+    {"name": "lat", "description": "", "type": "SIMPLE", "dataType": {"name": "DOUBLE", "length": 8, "description": ""}, "conversionString": "%lf"},
+    {"name": "hgt", "description": "", "type": "SIMPLE", "dataType": {"name": "FLOAT", "length": 4, "description": ""}, "conversionString": "%f"},
+    {"name": "station", "description": "", "type": "STRING", "arrayLength": 32,
+     "dataType": {"name": "CHAR", "length": 1, "description": ""}, "conversionString": "%s"},
+    {"name": "sats", "description": "", "type": "VARIABLE_LENGTH_ARRAY", "arrayLength": 16,
+     "dataType": {"name": "USHORT", "length": 2, "description": ""}, "conversionString": "%hu"},
+    {"name": "obs", "description": "", "type": "FIELD_ARRAY", "arrayLength": 8,
+     "dataType": {"name": "UNKNOWN", "length": 4, "description": ""}, "conversionString": null, "fields": [
+       {"name": "prn", "description": "", "type": "SIMPLE", "dataType": {"name": "ULONG", "length": 4, "description": ""}, "conversionString": "%lu"},
+       {"name": "id", "description": "", "type": "STRING", "arrayLength": 32,
+        "dataType": {"name": "CHAR", "length": 1, "description": ""}, "conversionString": "%s"}]},
+    {"name": "flags", "description": "", "type": "SIMPLE", "dataType": {"name": "HEXBYTE", "length": 1, "description": ""}, "conversionString": "%02x"}
+  ]}}]
+})";
+
+//! An ALLOCTEST log. The CRC is not checked on decode, the log is re-encoded before being given to the Parser.
+constexpr std::string_view szAsciiLog =
+    "#ALLOCTESTA,COM1,0,50.0,FINESTEERING,2167,244820.000,02000000,0000,16248;SOL_COMPUTED,51.15043874397,1097.6822,"
+    "\"a station with a long name\",4,1,5,12,31,3,101,\"first observation\",102,\"second observation\",103,\"third observation\",0b*00000000\r\n";
+
+//! Real logs, decoded with the message database of the repository.
+constexpr std::string_view szBestPosLog =
+    "#BESTPOSA,COM1,0,83.5,FINESTEERING,2163,329760.000,02400000,b1f6,65535;SOL_COMPUTED,SINGLE,51.15043874397,-114.03066788586,1097.6822,"
+    "-17.0000,WGS84,1.3648,1.1806,3.1112,\"\",0.000,0.000,18,18,18,0,00,02,11,01*c3194e35\r\n";
+
+constexpr std::string_view szRangeCmpLog =
+    "#RANGECMPA,COM1,0,43.5,FINESTEERING,2241,407907.000,02000020,9691,32768;71,24dc101876a708c09a8b780a2f49349f321ab88082030000,"
+    "2b5c301155be0630c58b780a7872f3a3401ae87f82030000,44dc10086c740610e4cb710bb6287afb5306be3b21030000,"
+    "4b5c30019a0705b00acc710b8c235fa46006f83a21030000,64dc1018b622f65f47bc400a9195ddc3311ff5a5e6030000,"
+    "6b5c30113e50f86f50bc400a41ca84c0401f1da5e6030000,a4dc101831a4f10f79839b0b4c1d13e07301b5a8e7020000,"
+    "ab5c3011bbcff4bfb5839b0b0fea048f9101e8a7e7020000,c4dc10189e2ff69fe40ecd0a75c8b0e742167c64a9030000,"
+    "cb5c30114c5af86ffc0ecd0aa7b0b1f85016b86349030000,e4dc10081c0509901ec84e0a3e8fa3ba31047433c3030000,"
+    "eb5c30014e07072032c84e0a053954b94004c832a3030000,04dd10186c300ff0a19f930b8da441e553107f9f20030000,"
+    "0b5d3011f0d50be0c19f930b03810e936110c79ea0020000,24dd101853c2fe5f990ec309b5f76b96200395f1e4030000,"
+    "2b5d30117608ffdfb50ec3097f01d980300395f1e4030000,44dd10082d050db04c74bb0be1aa17cb5309fc2720030000,"
+    "4b5d300147250a807174bb0b375cabfe8109fc27a0020000,84dd10082f16f4dfbe87d90b924156b773197d0ee5020000,"
+    "8b5d300186b7f61ff087d90ba88446eff019b80de5020000,04de1508d67dff8faab3c014382132de53c31fbe28030000,"
+    "0bde3502929aff1fbab3c014ee0aace063c3b8bd28030000,049f111899e5f4cfc400110aab9943c72035fb60e51b0000,"
+    "0b3fb1103d5df77fe400110a8e4aa6c53035ce60851b0000,649f111844fa050026ab6409785fe6ba202ebb48e3170000,"
+    "6b3fb11034a604a040ab6409109f969f302e9148e3170000,849f1108e7fa02d0ab85e50aa17b65b7313d3a9d21270000,"
+    "8b3fb1005e510230c285e50a80b3c0d5403d0a9de1260000,a49f01085960f62f1096c90a781c6cc9423cbb0be42a0000,"
+    "c49f11086ad4ff7fd4392f09f696b6da202c02b1e5330000,cb3fb10019deff7fe5392f099a1755b8302cceb085330000,"
+    "e49f0108aed110f0cb018c0aaa01eef8552f7626c1020000,249c0118aba3f3ff1a704c0aa4c26ea1772b5501600e0000,"
+    "a49c1118dccb0b60024c0f0abee32cc4302d9bf461370000,ab3cb110c82c09401b4c0f0a59653fc3302d97f441370000,"
+    "c4dc5308f6f602301fbab50b58dedace31137f54c6030000,c4dc33029145027025bab50b72b22c9b20133454c6030000,"
+    "e4dc530828d8f5ef94a1720d83a39baa4207665d2d030000,e4dc33020238f89fdaa1720df9d23ebb3007185d2d030000,"
+    "04dd53082dfc0190e5d9ac0cfe2c86ac840b8f9ba2020000,04dd33026a850140e3d9ac0cb793ca9e500b5f9b42030000,"
+    "24dd53084b8bf79f4ce4850c18b91dc6420c314f46030000,24dd33026385f97f50e4850c9b9c66b2300c32ae26030000,"
+    "44dd53082872f3afa946930d30ea29954221c60d2b030000,44dd33027561f66fd146930dc66ad0aa2021810d8b030000,"
+    "64dd53084827fcbf2156770cc746adcf310a552fc4030000,64dd3302750dfd2f3356770c5df8b9b9100abfb8e4030000,"
+    "84dd53082f28f8ff79291d0d8cf6bfe2321e939965030000,84dd33027cfdf9df9d291d0d164a43e6201e5499a5030000,"
+    "a4dd5308e8b5024048e4f20b8536ada6211b25fde3030000,a4dd3302a913027061e4f20b596163fc101bd8fce3030000,"
+    "c4dd53086b8f0be0992f8f0c028b02c042156fc261030000,c4dd330299db08c0bd2f8f0c55adb8ad10152ec2e1030000,"
+    "e4dd5308d4ec0940ec470a0d19d926ef3204ae7a80030000,e4dd3302c39a07f0fb470a0d5615c4ef3004f20261030000,"
+    "849e1418e5280d60406b030cd3782fae4024733041030000,843e7401222d0aa0986b030c21b711f420243530a1030000,"
+    "a49e1408467b0520e135950a3eba8d9c202eb0f2e3030000,a43e7411193d0430a935950a214664ac102e7af2e3030000,"
+    "c49e1418f491f8fff846a00c9ee815c8302c36e643030000,c43e74014241fa9f0447a00c65b21ea5302cfae503030000,"
+    "e49e1418ce8bfcff35336b0ce953a2ea710c317e82020000,e4de34105a54fd2f2b336b0c18cbd5bf310c0e7e62030000,"
+    "049f1408f9a90a70c8229c0b0dfb69f13016f722c2030000,043f74110e3f0890af229c0b74440ea82016ba22a2030000,"
+    "649f1418d043f65f3e910c0b912cddce2014504fea030000,643f7411d778f8af2c910c0b963451f02014154fea030000,"
+    "a49f14087314f8ff102c5d0bebba659a30253589c6030000,a43f740124e0f9ef452c5d0b1cfdbec72025f588c6030000,"
+    "649c1408119700e088fe6a0a396808b820133270e6030000,643c7401ce7400908afe6a0a14e2a3c12013f56fe6030000*f0022933\r\n";
+
+//! The number of reads made before counting, for the Parser and its scratch messages to reach their working size.
+constexpr int iWarmUpReads = 4;
+constexpr int iCountedReads = 64;
+
+} // namespace
+
+// -------------------------------------------------------------------------------------------------------
+// Allocation Counter Tests
+// -------------------------------------------------------------------------------------------------------
+TEST(AllocationCounterTest, COUNTS_EVERY_FORM)
+{
+    // Call the allocation functions directly, since allocations made by new-expressions may be elided
+    constexpr auto eAlignment = static_cast<std::align_val_t>(64);
+    const uint64_t ullStart = ullAllocationCount;
+
+    ::operator delete(::operator new(16));
+    ::operator delete[](::operator new[](16));
+    ::operator delete(::operator new(16, std::nothrow), std::nothrow);
+    ::operator delete[](::operator new[](16, std::nothrow), std::nothrow);
+
+    void* pvAligned = ::operator new(16, eAlignment);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(pvAligned) % static_cast<size_t>(eAlignment), 0U);
+    ::operator delete(pvAligned, eAlignment);
+    ::operator delete[](::operator new[](16, eAlignment), eAlignment);
+    ::operator delete(::operator new(16, eAlignment, std::nothrow), eAlignment, std::nothrow);
+    ::operator delete[](::operator new[](16, eAlignment, std::nothrow), eAlignment, std::nothrow);
+
+    ASSERT_EQ(ullAllocationCount - ullStart, 8U);
+}
+
+// -------------------------------------------------------------------------------------------------------
+// Parser Allocation Tests
+// -------------------------------------------------------------------------------------------------------
+class ParserAllocationTest : public ::testing::Test
+{
+  protected:
+    static void SetUpTestSuite()
+    {
+        pclMyMessageDb = ParseJsonDb(szDatabase);
+
+        // Re-encode the log so that the Parser sees valid CRCs
+        HeaderDecoder clHeaderDecoder(pclMyMessageDb);
+        MessageDecoder clMessageDecoder(pclMyMessageDb);
+        Encoder clEncoder(pclMyMessageDb);
+
+        const auto* pucLog = reinterpret_cast<const unsigned char*>(szAsciiLog.data());
+        IntermediateHeader stHeader;
+        CompositeField stMessage;
+        MetaDataStruct stMetaData;
+        ASSERT_EQ(clHeaderDecoder.Decode(pucLog, stHeader, stMetaData), STATUS::SUCCESS);
+        ASSERT_EQ(clMessageDecoder.Decode(pucLog + stMetaData.uiHeaderLength, stMessage, stMetaData), STATUS::SUCCESS);
+
+        for (auto [eFormat, pvLog] : {std::pair{ENCODE_FORMAT::ASCII, &vMyAsciiLog}, std::pair{ENCODE_FORMAT::BINARY, &vMyBinaryLog}})
+        {
+            std::vector<unsigned char> vBuffer(MESSAGE_SIZE_MAX);
+            unsigned char* pucBuffer = vBuffer.data();
+            MessageDataStruct stMessageData;
+            ASSERT_EQ(clEncoder.Encode(&pucBuffer, static_cast<uint32_t>(vBuffer.size()), stHeader, stMessage, stMessageData, stMetaData.eFormat, eFormat),
+                      STATUS::SUCCESS);
+            pvLog->assign(stMessageData.pucMessage, stMessageData.pucMessage + stMessageData.uiMessageLength);
+        }
+    }
+
+    static void TearDownTestSuite() { pclMyMessageDb.reset(); }
+
+    //! Read the log repeatedly and return the number of allocations made by each counted read.
+    static double AllocationsPerRead(const std::vector<unsigned char>& vLog_, ENCODE_FORMAT eEncodeFormat_)
+    {
+        Parser clParser(pclMyMessageDb);
+        clParser.SetEncodeFormat(eEncodeFormat_);
+
+        MessageDataStruct stMessageData;
+        MetaDataStruct stMetaData;
+        uint64_t ullAllocations = 0;
+
+        for (int i = 0; i < iWarmUpReads + iCountedReads; ++i)
+        {
+            EXPECT_EQ(clParser.Write(vLog_.data(), static_cast<uint32_t>(vLog_.size())), vLog_.size());
+
+            const uint64_t ullStart = ullAllocationCount;
+            EXPECT_EQ(clParser.Read(stMessageData, stMetaData), STATUS::SUCCESS);
+            if (i >= iWarmUpReads) { ullAllocations += ullAllocationCount - ullStart; }
+        }
+
+        EXPECT_EQ(stMetaData.messageName, "ALLOCTEST");
+        return static_cast<double>(ullAllocations) / iCountedReads;
+    }
+
+    static MessageDatabase::Ptr pclMyMessageDb;
+    static std::vector<unsigned char> vMyAsciiLog;
+    static std::vector<unsigned char> vMyBinaryLog;
+};
+
+MessageDatabase::Ptr ParserAllocationTest::pclMyMessageDb = nullptr;
+std::vector<unsigned char> ParserAllocationTest::vMyAsciiLog;
+std::vector<unsigned char> ParserAllocationTest::vMyBinaryLog;
+
+TEST_F(ParserAllocationTest, ASCII_READ_IS_ALLOCATION_FREE)
+{
+    for (ENCODE_FORMAT eFormat : {ENCODE_FORMAT::ASCII, ENCODE_FORMAT::ABBREV_ASCII, ENCODE_FORMAT::BINARY, ENCODE_FORMAT::FLATTENED_BINARY,
+                                  ENCODE_FORMAT::JSON})
+    {
+        EXPECT_EQ(AllocationsPerRead(vMyAsciiLog, eFormat), 0.0) << "Encode format " << static_cast<int>(eFormat);
+    }
+}
+
+TEST_F(ParserAllocationTest, BINARY_READ_IS_ALLOCATION_FREE)
+{
+    for (ENCODE_FORMAT eFormat : {ENCODE_FORMAT::ASCII, ENCODE_FORMAT::ABBREV_ASCII, ENCODE_FORMAT::BINARY, ENCODE_FORMAT::FLATTENED_BINARY,
+                                  ENCODE_FORMAT::JSON})
+    {
+        EXPECT_EQ(AllocationsPerRead(vMyBinaryLog, eFormat), 0.0) << "Encode format " << static_cast<int>(eFormat);
+    }
+}
+
+TEST_F(ParserAllocationTest, READ_INTERMEDIATE_REUSES_MESSAGE)
+{
+    Parser clParser(pclMyMessageDb);
+
+    MessageDataStruct stMessageData;
+    IntermediateHeader stHeader;
+    CompositeField stMessage;
+    MetaDataStruct stMetaData;
+    uint64_t ullAllocations = 0;
+
+    for (int i = 0; i < iWarmUpReads + iCountedReads; ++i)
+    {
+        const auto& vLog = i % 2 == 0 ? vMyAsciiLog : vMyBinaryLog;
+        ASSERT_EQ(clParser.Write(vLog.data(), static_cast<uint32_t>(vLog.size())), vLog.size());
+
+        const uint64_t ullStart = ullAllocationCount;
+        ASSERT_EQ(clParser.ReadIntermediate(stMessageData, stHeader, stMessage, stMetaData), STATUS::SUCCESS);
+        if (i >= iWarmUpReads) { ullAllocations += ullAllocationCount - ullStart; }
+    }
+
+    EXPECT_EQ(ullAllocations, 0U);
+}
+
+// -------------------------------------------------------------------------------------------------------
+// Allocation Tests of Real Logs
+// -------------------------------------------------------------------------------------------------------
+class RealLogAllocationTest : public ::testing::Test
+{
+  protected:
+    static void SetUpTestSuite() { pclMyMessageDb = LoadJsonDbFile(std::getenv("TEST_DATABASE_PATH")); }
+
+    static void TearDownTestSuite() { pclMyMessageDb.reset(); }
+
+    //! Read the log repeatedly and return the number of allocations made by each counted read.
+    static double AllocationsPerRead(std::string_view svLog_, ENCODE_FORMAT eEncodeFormat_, std::string_view svMessageName_)
+    {
+        Parser clParser(pclMyMessageDb);
+        clParser.SetEncodeFormat(eEncodeFormat_);
+
+        const auto* pucLog = reinterpret_cast<const unsigned char*>(svLog_.data());
+        MessageDataStruct stMessageData;
+        MetaDataStruct stMetaData;
+        uint64_t ullAllocations = 0;
+
+        for (int i = 0; i < iWarmUpReads + iCountedReads; ++i)
+        {
+            EXPECT_EQ(clParser.Write(pucLog, static_cast<uint32_t>(svLog_.size())), svLog_.size());
+
+            const uint64_t ullStart = ullAllocationCount;
+            EXPECT_EQ(clParser.Read(stMessageData, stMetaData), STATUS::SUCCESS);
+            if (i >= iWarmUpReads) { ullAllocations += ullAllocationCount - ullStart; }
+        }
+
+        EXPECT_EQ(stMetaData.messageName, svMessageName_);
+        return static_cast<double>(ullAllocations) / iCountedReads;
+    }
+
+    static MessageDatabase::Ptr pclMyMessageDb;
+};
+
+MessageDatabase::Ptr RealLogAllocationTest::pclMyMessageDb = nullptr;
+
+TEST_F(RealLogAllocationTest, BESTPOS_READ_IS_ALLOCATION_FREE)
+{
+    for (ENCODE_FORMAT eFormat : {ENCODE_FORMAT::ASCII, ENCODE_FORMAT::ABBREV_ASCII, ENCODE_FORMAT::BINARY, ENCODE_FORMAT::FLATTENED_BINARY,
+                                  ENCODE_FORMAT::JSON})
+    {
+        EXPECT_EQ(AllocationsPerRead(szBestPosLog, eFormat, "BESTPOS"), 0.0) << "Encode format " << static_cast<int>(eFormat);
+    }
+}
+
+TEST_F(RealLogAllocationTest, RANGECMP_READ_IS_ALLOCATION_FREE)
+{
+    // The Parser decompresses RANGECMP to RANGE
+    for (ENCODE_FORMAT eFormat : {ENCODE_FORMAT::ASCII, ENCODE_FORMAT::BINARY})
+    {
+        EXPECT_EQ(AllocationsPerRead(szRangeCmpLog, eFormat, "RANGE"), 0.0) << "Encode format " << static_cast<int>(eFormat);
+    }
+}
+
+TEST_F(RealLogAllocationTest, RANGECMP_DECOMPRESSION_IS_ALLOCATION_FREE)
+{
+    RangeDecompressor clDecompressor(pclMyMessageDb);
+    std::vector<unsigned char> vBuffer(MESSAGE_SIZE_MAX);
+    uint64_t ullAllocations = 0;
+
+    for (int i = 0; i < iWarmUpReads + iCountedReads; ++i)
+    {
+        // Decompression rewrites the buffer in place
+        std::memcpy(vBuffer.data(), szRangeCmpLog.data(), szRangeCmpLog.size());
+        MetaDataStruct stMetaData;
+        stMetaData.usMessageId = static_cast<uint16_t>(RANGECMP_MSG_ID);
+        stMetaData.uiLength = static_cast<uint32_t>(szRangeCmpLog.size());
+
+        const uint64_t ullStart = ullAllocationCount;
+        ASSERT_EQ(clDecompressor.Decompress(vBuffer.data(), static_cast<uint32_t>(vBuffer.size()), stMetaData), STATUS::SUCCESS);
+        if (i >= iWarmUpReads) { ullAllocations += ullAllocationCount - ullStart; }
+    }
+
+    EXPECT_EQ(ullAllocations, 0U);
+}